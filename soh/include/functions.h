@@ -2258,6 +2258,10 @@ void ArenaImpl_SetDebugInfo(ArenaNode* node, const char* file, s32 line, Arena*
 void ArenaImpl_LockInit(Arena* arena);
 void ArenaImpl_Lock(Arena* arena);
 void ArenaImpl_Unlock(Arena* arena);
+s32 ArenaImpl_GetFreeListIndex(size_t size);
+void ArenaImpl_InsertFreeBlock(Arena* arena, ArenaNode* node);
+void ArenaImpl_RemoveFreeBlock(Arena* arena, ArenaNode* node);
+ArenaNode* ArenaImpl_FindFreeBlock(Arena* arena, size_t size);
 ArenaNode* ArenaImpl_GetNextBlock(ArenaNode* node);
 ArenaNode* ArenaImpl_GetPrevBlock(ArenaNode* node);
 ArenaNode* ArenaImpl_GetLastBlock(Arena* arena);
@@ -346,6 +346,15 @@ typedef struct {
     /* 0x04 */ Actor* head; // pointer to head of the linked list of this category (most recent actor added)
 } ActorListEntry; // size = 0x08
 
+#define ACTOR_GRID_CELL_SIZE 256.0f
+#define ACTOR_GRID_BUCKET_COUNT 256 // must be a power of two
+
+// SoH [Port] Uniform XZ grid over every actor in the actor lists, hashed into a fixed number of buckets
+typedef struct {
+    /* ---- */ Actor* buckets[ACTOR_GRID_BUCKET_COUNT];
+    /* ---- */ u32    nextListOrder;
+} ActorGrid;
+
 typedef struct {
     /* 0x0000 */ u8     freezeFlashTimer;
     /* 0x0001 */ char   unk_01[0x01];
@@ -369,7 +378,8 @@ typedef struct {
     /* 0x0128 */ TitleCardContext titleCtx;
     /* 0x0138 */ char   unk_138[0x04];
     /* 0x013C */ void*  absoluteSpace; // Space used to allocate actor overlays of alloc type 1
-} ActorContext; // size = 0x140
+    /* ---- */ ActorGrid grid;
+} ActorContext; // size = 0x140 (original), plus the SoH ActorGrid
 
 typedef struct {
     /* 0x00 */ char  unk_00[0x4];
@@ -2035,6 +2045,12 @@ typedef struct {
 
 struct ArenaNode;
 
+// #region SOH [General] Free blocks are kept in size class lists so allocating doesn't walk every block
+// 0x10 byte classes up to ARENA_SMALL_BLOCK_MAX, then one list per power of two
+#define ARENA_SMALL_BLOCK_MAX 0x200
+#define ARENA_FREE_LIST_COUNT 56
+// #endregion
+
 typedef struct Arena {
     /* 0x00 */ struct ArenaNode* head;
     /* 0x04 */ void* start;
@@ -2042,6 +2058,9 @@ typedef struct Arena {
     /* 0x20 */ u8 unk_20;
     /* 0x21 */ u8 isInit;
     /* 0x22 */ u8 flag;
+    // #region SOH [General]
+    /*      */ struct ArenaNode* freeLists[ARENA_FREE_LIST_COUNT];
+    // #endregion
 } Arena; // size = 0x24
 
 typedef struct ArenaNode {
@@ -2050,6 +2069,14 @@ typedef struct ArenaNode {
     /* 0x04 */ size_t size;
     /* 0x08 */ struct ArenaNode* next;
     /* 0x0C */ struct ArenaNode* prev;
+    // #region SOH [General] Links in the free list of the block's size class, only valid while isFree is set
+    /*      */ struct ArenaNode* freeNext;
+    /*      */ struct ArenaNode* freePrev;
+#if UINTPTR_MAX == 0xFFFFFFFF
+    // Block payloads follow their node, so the node has to stay a multiple of 16 bytes on 32 bit targets too
+    /*      */ u8 pad[8];
+#endif
+    // #endregion
     // /* 0x10 */ const char* filename;
     // /* 0x14 */ s32 line;
     // /* 0x18 */ OSId threadId;
@@ -266,6 +266,13 @@ typedef struct Actor {
     /* 0x134 */ ActorFunc draw; // Draw Routine. Called by `Actor_Draw`
     /* 0x138 */ ActorResetFunc reset;
     /* 0x13C */ char dbgPad[0x10]; // Padding that only exists in the debug rom
+    // #region SOH [Port] ActorGrid bookkeeping, see soh/ActorGrid.h
+    /* ---- */ struct Actor* gridPrev; // Previous actor in the same grid bucket
+    /* ---- */ struct Actor* gridNext; // Next actor in the same grid bucket
+    /* ---- */ s16 gridCellX; // Cell the actor was last binned into
+    /* ---- */ s16 gridCellZ;
+    /* ---- */ u32 listOrder; // Grows with each list insertion, higher is nearer the list head. 0 if not in a list
+    // #endregion
 } Actor; // size = 0x14C
 
 typedef enum {
@@ -249,6 +249,10 @@ typedef struct {
     /* 0x00 */ EffectSs* table; // "data_table"
     /* 0x04 */ s32 searchStartIndex;
     /* 0x08 */ s32 tableSize;
+    // SoH [Port] Max-trees over the table, so EffectSs_FindSlot does not have to scan it
+    /* ---- */ u16* freeTree;  // leaf i is 1 if table[i] is free
+    /* ---- */ u16* evictTree; // leaf i is the eviction key of table[i], see EffectSs_GetEvictKey
+    /* ---- */ s32 treeLeafCount;
 } EffectSsInfo; // size = 0x0C
 
 /* G Effect Regs */
@@ -1,5 +1,6 @@
 #include "ActorDB.h"
 
+#include <algorithm>
 #include <assert.h>
 
 ActorDB* ActorDB::Instance;
@@ -14,6 +15,20 @@ ActorDB* ActorDB::Instance;
 #undef DEFINE_ACTOR_INTERNAL
 #undef DEFINE_ACTOR_UNSET
 
+static std::string ToLowerAscii(const std::string& str) {
+    std::string lower = str;
+    for (char& c : lower) {
+        if (c >= 'A' && c <= 'Z') {
+            c += 'a' - 'A';
+        }
+    }
+    return lower;
+}
+
+static uint32_t GetTrigram(const std::string& str, size_t pos) {
+    return ((uint8_t)str[pos] << 16) | ((uint8_t)str[pos + 1] << 8) | (uint8_t)str[pos + 2];
+}
+
 struct AddPair {
     const char* name;
     ActorInit& init;
@@ -492,6 +507,14 @@ ActorDB::Entry& ActorDB::AddEntry(const std::string& name, const std::string& de
     newEntry.SetName(name);
     newEntry.SetDesc(desc);
 
+    const std::string& searchDesc = newEntry.searchDesc;
+    for (size_t i = 0; i + 3 <= searchDesc.size(); i++) {
+        std::vector<int>& ids = descTrigrams[GetTrigram(searchDesc, i)];
+        if (ids.empty() || ids.back() != newEntry.entry.id) {
+            ids.push_back(newEntry.entry.id);
+        }
+    }
+
     newEntry.entry.valid = true;
 
     return newEntry;
@@ -551,6 +574,41 @@ int ActorDB::RetrieveId(const std::string& name) {
     return entry->second;
 }
 
+std::vector<u16> ActorDB::SearchDescriptions(const std::string& query) const {
+    const std::string search = ToLowerAscii(query);
+    std::vector<u16> ids;
+
+    // Too short for a trigram, check every description
+    if (search.size() < 3) {
+        for (size_t i = 0; i < db.size(); i++) {
+            if (db[i].searchDesc.find(search) != std::string::npos) {
+                ids.push_back(i);
+            }
+        }
+        return ids;
+    }
+
+    // Every match contains all of the query's trigrams, so only the actors listed under its rarest one need checking
+    const std::vector<int>* candidates = nullptr;
+    for (size_t i = 0; i + 3 <= search.size(); i++) {
+        auto it = descTrigrams.find(GetTrigram(search, i));
+        if (it == descTrigrams.end()) {
+            return ids;
+        }
+        if (candidates == nullptr || it->second.size() < candidates->size()) {
+            candidates = &it->second;
+        }
+    }
+
+    for (int id : *candidates) {
+        if (db[id].searchDesc.find(search) != std::string::npos) {
+            ids.push_back(id);
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
 int ActorDB::GetEntryCount() {
     return db.size();
 }
@@ -593,6 +651,7 @@ void ActorDB::Entry::SetName(const std::string& newName) {
 void ActorDB::Entry::SetDesc(const std::string& newDesc) {
     desc = newDesc;
     entry.desc = desc.c_str();
+    searchDesc = ToLowerAscii(desc);
 }
 
 #include "src/overlays/actors/ovl_En_Partner/z_en_partner.h"
@@ -55,12 +55,16 @@ class ActorDB {
 
         std::string name;
         std::string desc;
+        // Lowercase desc for case insensitive searches
+        std::string searchDesc;
         ActorDBEntry entry;
     };
     Entry& AddEntry(const ActorDBInit& init);
 
     Entry& RetrieveEntry(const int id);
     int RetrieveId(const std::string& name);
+    // Ids of the actors whose description contains query, ignoring case, in id order
+    std::vector<u16> SearchDescriptions(const std::string& query) const;
 
     static void AddBuiltInCustomActors();
 
@@ -72,6 +76,8 @@ class ActorDB {
 
     std::vector<Entry> db;
     std::unordered_map<std::string, int> nameTable;
+    // Trigram of a lowercase description -> ids of the actors whose description contains it
+    std::unordered_map<uint32_t, std::vector<int>> descTrigrams;
     size_t nextFreeId = 0;
 };
 
@@ -0,0 +1,90 @@
+#include "ActorGrid.h"
+#include "functions.h"
+
+#include <cstring>
+
+static void ActorGrid_Link(ActorContext* actorCtx, Actor* actor, s32 cellX, s32 cellZ) {
+    Actor** head = &actorCtx->grid.buckets[ActorGrid_GetBucket(cellX, cellZ)];
+
+    actor->gridCellX = cellX;
+    actor->gridCellZ = cellZ;
+    actor->gridPrev = nullptr;
+    actor->gridNext = *head;
+    if (*head != nullptr) {
+        (*head)->gridPrev = actor;
+    }
+    *head = actor;
+}
+
+static void ActorGrid_Unlink(ActorContext* actorCtx, Actor* actor) {
+    if (actor->gridPrev != nullptr) {
+        actor->gridPrev->gridNext = actor->gridNext;
+    } else {
+        actorCtx->grid.buckets[ActorGrid_GetBucket(actor->gridCellX, actor->gridCellZ)] = actor->gridNext;
+    }
+    if (actor->gridNext != nullptr) {
+        actor->gridNext->gridPrev = actor->gridPrev;
+    }
+    actor->gridPrev = nullptr;
+    actor->gridNext = nullptr;
+}
+
+extern "C" void ActorGrid_Init(ActorContext* actorCtx) {
+    memset(&actorCtx->grid, 0, sizeof(actorCtx->grid));
+}
+
+extern "C" void ActorGrid_Insert(ActorContext* actorCtx, Actor* actor) {
+    // A fresh ActorContext is zeroed, so the first actor gets order 1 and 0 keeps meaning "not listed"
+    if (++actorCtx->grid.nextListOrder == 0) {
+        actorCtx->grid.nextListOrder = 1;
+    }
+    actor->listOrder = actorCtx->grid.nextListOrder;
+    ActorGrid_Link(actorCtx, actor, ActorGrid_GetCell(actor->world.pos.x), ActorGrid_GetCell(actor->world.pos.z));
+}
+
+extern "C" void ActorGrid_Remove(ActorContext* actorCtx, Actor* actor) {
+    if (actor->listOrder == 0) {
+        return;
+    }
+    ActorGrid_Unlink(actorCtx, actor);
+    actor->listOrder = 0;
+}
+
+extern "C" void ActorGrid_Rebin(ActorContext* actorCtx, Actor* actor) {
+    const s32 cellX = ActorGrid_GetCell(actor->world.pos.x);
+    const s32 cellZ = ActorGrid_GetCell(actor->world.pos.z);
+
+    if (actor->listOrder == 0 || (cellX == actor->gridCellX && cellZ == actor->gridCellZ)) {
+        return;
+    }
+    ActorGrid_Unlink(actorCtx, actor);
+    ActorGrid_Link(actorCtx, actor, cellX, cellZ);
+}
+
+extern "C" void ActorGrid_RebinAll(ActorContext* actorCtx) {
+    for (s32 i = 0; i < ACTORCAT_MAX; i++) {
+        for (Actor* actor = actorCtx->actorLists[i].head; actor != nullptr; actor = actor->next) {
+            ActorGrid_Rebin(actorCtx, actor);
+        }
+    }
+}
+
+extern "C" Actor* ActorGrid_FindFirst(ActorContext* actorCtx, const Vec3f* pos, f32 range, s16 actorId,
+                                      s32 actorCategory, const Actor* exclude) {
+    Actor* first = nullptr;
+
+    ActorGrid_ForEachNear(actorCtx, pos, range, [&](Actor* actor) {
+        if (actor == exclude || (actorId != -1 && actor->id != actorId) ||
+            (actorCategory != -1 && actor->category != actorCategory)) {
+            return;
+        }
+        if (first != nullptr && !ActorGrid_IsBeforeInLists(actor, first)) {
+            return;
+        }
+        if (Math_Vec3f_DistXYZ(const_cast<Vec3f*>(pos), &actor->world.pos) <= range) {
+            first = actor;
+        }
+    });
+
+    return first;
+}
@@ -0,0 +1,104 @@
+#ifndef ACTOR_GRID_H
+#define ACTOR_GRID_H
+
+#include "z64.h"
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Spatial hash over the actor lists, stored in ActorContext::grid, for radius queries that would otherwise walk every
+ * actor of one or all categories.
+ *
+ * Actors are binned by world position when they are added to a category, once Actor_Init has set it from home, after
+ * Actor_Spawn runs their init, after each init/update in Actor_UpdateAll, and in a full pass at the start and end of
+ * Actor_UpdateAll. Queries don't rebin, that would cost a walk of the actor lists per query. An actor whose position
+ * is written by a different actor during Actor_UpdateAll is found in its old cell until its own update or the pass at
+ * the end of the frame, whichever comes first.
+ *
+ * Queries return the same actor a walk of the actor lists would: candidates are compared by category, then list
+ * position, using Actor::listOrder.
+ */
+
+// Beyond this range a query touches most of the grid, so callers are better off walking the lists
+#define ACTOR_GRID_MAX_QUERY_RANGE 1024.0f
+
+static inline s32 ActorGrid_GetCell(f32 coord) {
+    f32 cell = floorf(coord / ACTOR_GRID_CELL_SIZE);
+
+    // Also catches NaN, which compares false against both bounds
+    if (!(cell >= -0x8000)) {
+        return -0x8000;
+    }
+    if (!(cell <= 0x7FFF)) {
+        return 0x7FFF;
+    }
+    return (s32)cell;
+}
+
+static inline u32 ActorGrid_GetBucket(s32 cellX, s32 cellZ) {
+    return (((u32)cellX * 73856093u) ^ ((u32)cellZ * 19349663u)) & (ACTOR_GRID_BUCKET_COUNT - 1);
+}
+
+void ActorGrid_Init(ActorContext* actorCtx);
+void ActorGrid_Insert(ActorContext* actorCtx, Actor* actor);
+void ActorGrid_Remove(ActorContext* actorCtx, Actor* actor);
+void ActorGrid_Rebin(ActorContext* actorCtx, Actor* actor);
+void ActorGrid_RebinAll(ActorContext* actorCtx);
+
+// True if actor is currently in one of the actor lists. Removal from its category clears listOrder before Actor_Delete
+// frees the actor and the arena is never unmapped, so this also works on pointers to deleted actors, until their memory
+// is handed out again.
+static inline u8 ActorGrid_Contains(ActorContext* actorCtx, const Actor* actor) {
+    return actor != NULL && actor->listOrder != 0;
+}
+
+/**
+ * Finds the actor a list walk of `actorCategory` (or of every category when -1) would return first, among actors
+ * other than `exclude` within `range` (XYZ) of `pos`. If `actorId` is -1 any actor ID matches.
+ */
+Actor* ActorGrid_FindFirst(ActorContext* actorCtx, const Vec3f* pos, f32 range, s16 actorId, s32 actorCategory,
+                           const Actor* exclude);
+
+#ifdef __cplusplus
+}
+
+// Order in which a walk of the actor lists (category by category, each from its head) visits two actors
+inline bool ActorGrid_IsBeforeInLists(const Actor* a, const Actor* b) {
+    return a->category != b->category ? a->category < b->category : a->listOrder > b->listOrder;
+}
+
+// Calls fn for every actor binned in a cell overlapping the XZ square of half-size `range` around pos, in no
+// particular order. fn does its own exact distance test.
+template <typename Fn> void ActorGrid_ForEachNear(ActorContext* actorCtx, const Vec3f* pos, f32 range, Fn&& fn) {
+    const s32 minX = ActorGrid_GetCell(pos->x - range);
+    const s32 minZ = ActorGrid_GetCell(pos->z - range);
+    const s32 maxX = ActorGrid_GetCell(pos->x + range);
+    const s32 maxZ = ActorGrid_GetCell(pos->z + range);
+
+    // Several cells can hash to the same bucket, each bucket must only be walked once
+    u32 visited[ACTOR_GRID_BUCKET_COUNT / 32] = {};
+    for (s32 cellX = minX; cellX <= maxX; cellX++) {
+        for (s32 cellZ = minZ; cellZ <= maxZ; cellZ++) {
+            const u32 bucket = ActorGrid_GetBucket(cellX, cellZ);
+            if (visited[bucket / 32] & (1u << (bucket % 32))) {
+                continue;
+            }
+            visited[bucket / 32] |= 1u << (bucket % 32);
+
+            for (Actor* actor = actorCtx->grid.buckets[bucket]; actor != nullptr;) {
+                Actor* next = actor->gridNext;
+                if (actor->gridCellX >= minX && actor->gridCellX <= maxX && actor->gridCellZ >= minZ &&
+                    actor->gridCellZ <= maxZ) {
+                    fn(actor);
+                }
+                actor = next;
+            }
+        }
+    }
+}
+#endif
+
+#endif // ACTOR_GRID_H
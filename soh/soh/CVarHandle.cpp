@@ -0,0 +1,51 @@
+#include "CVarHandle.h"
+
+#include <memory>
+#include <vector>
+#include <libultraship/libultraship.h>
+
+#include "soh/ShipInit.hpp"
+#include "soh/Enhancements/game-interactor/GameInteractor.h"
+
+// Starts at 1 so zero-initialised handles resolve on first read
+uint32_t gCVarHandleGeneration = 1;
+
+// Keeps every slot handed out during the current generation alive, so a handle never points at a CVar that was
+// erased by CVarClear or replaced by a config reload before it gets the chance to re-resolve.
+static std::vector<std::shared_ptr<Ship::CVar>> sResolvedSlots;
+
+extern "C" void CVarHandle_Resolve(CVarHandle* handle) {
+    handle->integer = nullptr;
+    handle->floatValue = nullptr;
+    handle->generation = gCVarHandleGeneration;
+
+    std::shared_ptr<Ship::CVar> cvar = Ship::Context::GetInstance()->GetConsoleVariables()->Get(handle->name);
+    if (cvar == nullptr) {
+        return;
+    }
+
+    // Mirror CVarGetInteger/CVarGetFloat, which fall back to the default on a type mismatch. Only slots that are
+    // actually pointed at are kept alive.
+    if (cvar->Type == Ship::ConsoleVariableType::Integer) {
+        handle->integer = &cvar->Integer;
+    } else if (cvar->Type == Ship::ConsoleVariableType::Float) {
+        handle->floatValue = &cvar->Float;
+    } else {
+        return;
+    }
+    sResolvedSlots.push_back(std::move(cvar));
+}
+
+extern "C" void CVarHandle_Invalidate(void) {
+    gCVarHandleGeneration++;
+    if (gCVarHandleGeneration == 0) {
+        gCVarHandleGeneration = 1;
+    }
+    sResolvedSlots.clear();
+}
+
+static void RegisterCVarHandleInvalidation() {
+    COND_HOOK(OnSceneInit, true, [](int16_t sceneNum) { CVarHandle_Invalidate(); });
+}
+
+static RegisterShipInitFunc initFunc(RegisterCVarHandleInvalidation);
@@ -0,0 +1,64 @@
+#ifndef CVAR_HANDLE_H
+#define CVAR_HANDLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A CVar key resolved once to the console variable's value slot, for reads on per-frame and per-actor hot paths.
+ *
+ * Handles re-resolve lazily whenever the global generation changes. A CVar that doesn't exist (or has another type) is
+ * cached as a miss the same way, so an unset CVar costs no more than a set one. The generation is bumped by
+ * ShipInit::Init (every menu edit, preset load and IS_RANDO change), on every scene init, and by code that creates or
+ * clears CVars outside of the menu widgets through CVarHandle_Invalidate. A CVar created or cleared anywhere else, e.g.
+ * from the console, is picked up at the next of those events.
+ *
+ * Handles are only meant to be read from the game thread.
+ *
+ * ```c
+ * static CVarHandle sDrawDistance = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("DisableDrawDistance"));
+ * s32 multiplier = CVarHandle_GetInteger(&sDrawDistance, 1);
+ * ```
+ */
+typedef struct CVarHandle {
+    const char* name;
+    const int32_t* integer;
+    const float* floatValue;
+    uint32_t generation;
+} CVarHandle;
+
+#define CVAR_HANDLE_INIT(cvarName) \
+    { cvarName, NULL, NULL, 0 }
+
+extern uint32_t gCVarHandleGeneration;
+
+void CVarHandle_Resolve(CVarHandle* handle);
+void CVarHandle_Invalidate(void);
+
+static inline uint8_t CVarHandle_NeedsResolve(const CVarHandle* handle) {
+    return handle->generation != gCVarHandleGeneration;
+}
+
+static inline int32_t CVarHandle_GetInteger(CVarHandle* handle, int32_t defaultValue) {
+    if (CVarHandle_NeedsResolve(handle)) {
+        CVarHandle_Resolve(handle);
+    }
+    return handle->integer != NULL ? *handle->integer : defaultValue;
+}
+
+static inline float CVarHandle_GetFloat(CVarHandle* handle, float defaultValue) {
+    if (CVarHandle_NeedsResolve(handle)) {
+        CVarHandle_Resolve(handle);
+    }
+    return handle->floatValue != NULL ? *handle->floatValue : defaultValue;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CVAR_HANDLE_H
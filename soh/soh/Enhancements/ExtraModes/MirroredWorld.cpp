@@ -67,6 +67,8 @@ static void UpdateMirrorModeState(int32_t sceneNum) {
     } else {
         CVarClear(CVAR_MIRRORED_WORLD_NAME);
     }
+    // Runs from OnSceneInit, possibly after the scene init invalidation, and the CVar is read through handles
+    CVarHandle_Invalidate();
 
     ApplyMirrorWorldGfxPatches();
 }
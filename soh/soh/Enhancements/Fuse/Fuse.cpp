@@ -4,6 +4,7 @@
 #include "soh/Enhancements/Fuse/Hooks/FuseHooks_Objects.h"
 #include "soh/Enhancements/Fuse/ShieldBashRules.h"
 #include "soh/SaveManager.h"
+#include "soh/Enhancements/savestates.h"
 #include "libultraship/bridge/consolevariablebridge.h"
 
 #include <algorithm>
@@ -30,6 +31,7 @@ extern "C" {
 #include "functions.h"
 }
 
+#include "soh/ActorGrid.h"
 #include "src/overlays/actors/ovl_En_Dekubaba/z_en_dekubaba.h"
 #include "src/overlays/actors/ovl_En_Bom/z_en_bom.h"
 #include "src/overlays/actors/ovl_En_Tite/z_en_tite.h"
@@ -100,26 +102,24 @@ Actor* Fuse_FindNearbyBombable(PlayState* play, const Vec3f* pos, float radius)
         return nullptr;
     }
 
-    const float radiusSq = radius * radius;
     Actor* nearest = nullptr;
-    float nearestDistSq = radiusSq;
+    float nearestDistSq = radius * radius;
 
-    for (int i = 0; i < ACTORCAT_MAX; ++i) {
-        Actor* actor = play->actorCtx.actorLists[i].head;
-        while (actor != nullptr) {
-            if (Fuse_IsBombableActorId(actor->id)) {
-                const float dx = actor->world.pos.x - pos->x;
-                const float dy = actor->world.pos.y - pos->y;
-                const float dz = actor->world.pos.z - pos->z;
-                const float distSq = (dx * dx) + (dy * dy) + (dz * dz);
-                if (distSq <= nearestDistSq) {
-                    nearestDistSq = distSq;
-                    nearest = actor;
-                }
-            }
-            actor = actor->next;
+    ActorGrid_ForEachNear(&play->actorCtx, pos, radius, [&](Actor* actor) {
+        if (!Fuse_IsBombableActorId(actor->id)) {
+            return;
         }
-    }
+        const float dx = actor->world.pos.x - pos->x;
+        const float dy = actor->world.pos.y - pos->y;
+        const float dz = actor->world.pos.z - pos->z;
+        const float distSq = (dx * dx) + (dy * dy) + (dz * dz);
+        // On a tie keep the actor a walk of the actor lists would reach last
+        if (distSq < nearestDistSq ||
+            (distSq == nearestDistSq && (nearest == nullptr || ActorGrid_IsBeforeInLists(nearest, actor)))) {
+            nearestDistSq = distSq;
+            nearest = actor;
+        }
+    });
 
     return nearest;
 }
@@ -444,16 +444,7 @@ extern "C" int32_t Fuse_GetPlayerMeleeHammerizeLevel(PlayState* play) {
         return 0;
     }
 
-    const MaterialDef* def = Fuse::GetMaterialDef(slot.materialId);
-    if (!def) {
-        return 0;
-    }
-
-    uint8_t level = 0;
-    if (!HasModifier(def->modifiers, def->modifierCount, ModifierId::Hammerize, &level) || level == 0) {
-        return 0;
-    }
-
+    const uint8_t level = FuseMaterials::GetModifierLevel(slot.materialId, ModifierId::Hammerize);
     return std::min<int32_t>(level, 2);
 }
 
@@ -924,7 +915,7 @@ static inline int RangedSlotToIndex(RangedFuseSlot slot) {
 
 static bool IsMaterialIdInRange(MaterialId id) {
     const int value = static_cast<int>(id);
-    return value >= static_cast<int>(MaterialId::None) && value <= static_cast<int>(MaterialId::Bomb);
+    return value >= static_cast<int>(MaterialId::None) && value < static_cast<int>(kMaterialIdCount);
 }
 
 #ifndef NDEBUG
@@ -1591,29 +1582,6 @@ extern "C" void Fuse_ShieldTriggerMegaStun(PlayState* play, Player* player, int
     Fuse_TriggerMegaStun(play, player, static_cast<MaterialId>(materialId), itemId);
 }
 
-// -----------------------------------------------------------------------------
-// Logging
-// -----------------------------------------------------------------------------
-void Fuse::Log(const char* fmt, ...) {
-    char buf[1024];
-
-    va_list args;
-    va_start(args, fmt);
-#ifdef _WIN32
-    _vsnprintf_s(buf, sizeof(buf), _TRUNCATE, fmt, args);
-#else
-    vsnprintf(buf, sizeof(buf), fmt, args);
-#endif
-    va_end(args);
-
-#ifdef _WIN32
-    OutputDebugStringA(buf);
-#endif
-
-    fputs(buf, stdout);
-    fflush(stdout);
-}
-
 // -----------------------------------------------------------------------------
 // Save synchronization helpers (equipped sword only)
 // -----------------------------------------------------------------------------
@@ -1754,13 +1722,8 @@ static bool Fuse_ShieldHasModifier(PlayState* play, ModifierId modifierId, int*
         *outDurabilityMax = slot.durabilityMax;
     }
 
-    const MaterialDef* def = Fuse::GetMaterialDef(slot.materialId);
-    if (!def) {
-        return false;
-    }
-
-    uint8_t level = 0;
-    if (!HasModifier(def->modifiers, def->modifierCount, modifierId, &level) || level == 0) {
+    const uint8_t level = FuseMaterials::GetModifierLevel(slot.materialId, modifierId);
+    if (level == 0) {
         return false;
     }
 
@@ -2072,13 +2035,7 @@ uint8_t Fuse::GetSwordModifierLevel(ModifierId id) {
         return 0;
     }
 
-    const MaterialDef* def = Fuse::GetMaterialDef(Fuse::GetSwordMaterial());
-    if (!def) {
-        return 0;
-    }
-
-    uint8_t level = 0;
-    return HasModifier(def->modifiers, def->modifierCount, id, &level) ? level : 0;
+    return FuseMaterials::GetModifierLevel(Fuse::GetSwordMaterial(), id);
 }
 
 bool Fuse::SwordHasModifier(ModifierId id) {
@@ -2102,17 +2059,11 @@ static bool Fuse_ModifierAppliesForItem(ModifierId id, FuseItemType itemType) {
 }
 
 uint8_t Fuse::GetMaterialModifierLevel(MaterialId materialId, FuseItemType itemType, ModifierId id) {
-    const MaterialDef* def = Fuse::GetMaterialDef(materialId);
-    if (!def) {
-        return 0;
-    }
-
     if (!Fuse_ModifierAppliesForItem(id, itemType)) {
         return 0;
     }
 
-    uint8_t level = 0;
-    return HasModifier(def->modifiers, def->modifierCount, id, &level) ? level : 0;
+    return FuseMaterials::GetModifierLevel(materialId, id);
 }
 
 float Fuse::GetRangeUpScale(uint8_t level) {
@@ -3448,16 +3399,15 @@ static void ApplyMeleeHitMaterialEffects(PlayState* play, Actor* victim, Actor*
         return;
     }
 
-    uint8_t stunLevel = 0;
-    if (allowStun && HasModifier(def->modifiers, def->modifierCount, ModifierId::Stun, &stunLevel) && stunLevel > 0) {
+    const uint8_t stunLevel = FuseMaterials::GetModifierLevel(def->id, ModifierId::Stun);
+    if (allowStun && stunLevel > 0) {
         Fuse_EnqueuePendingStun(victim, stunLevel, materialId, itemId);
     }
 
-    uint8_t freezeLevel = 0;
+    const uint8_t freezeLevel = FuseMaterials::GetModifierLevel(def->id, ModifierId::Freeze);
     const bool shatteredThisHit = (play && sFreezeShatterFrame.find(victim) != sFreezeShatterFrame.end() &&
                                    sFreezeShatterFrame[victim] == play->gameplayFrames);
-    if (!shatteredThisHit && HasModifier(def->modifiers, def->modifierCount, ModifierId::Freeze, &freezeLevel) &&
-        freezeLevel > 0) {
+    if (!shatteredThisHit && freezeLevel > 0) {
         const char* slotLabel = (itemId == ITEM_HAMMER) ? "Hammer" : "Sword";
         Fuse::QueueSwordFreeze(play, victim, freezeLevel, srcLabel, slotLabel, materialId);
     }
@@ -3509,9 +3459,8 @@ void Fuse::OnSwordMeleeHit(PlayState* play, Actor* victim, int baseWeaponDamage,
     }
 
     if (def) {
-        uint8_t knockbackLevel = 0;
-        if (HasModifier(def->modifiers, def->modifierCount, ModifierId::Knockback, &knockbackLevel) &&
-            knockbackLevel > 0) {
+        const uint8_t knockbackLevel = FuseMaterials::GetModifierLevel(def->id, ModifierId::Knockback);
+        if (knockbackLevel > 0) {
             Player* player = GET_PLAYER(play);
             ApplyFuseKnockback(play, player, victim, knockbackLevel, "Sword", materialId,
                                Fuse::GetSwordFuseDurability(), Fuse::GetSwordFuseMaxDurability(), "hit");
@@ -3554,3 +3503,203 @@ void Fuse::OnHammerMeleeHit(PlayState* play, Actor* victim, int baseWeaponDamage
     ApplyMeleeHitMaterialEffects(play, victim, player ? &player->actor : nullptr, materialId, ITEM_HAMMER,
                                  baseWeaponDamage, "hammer", false);
 }
+
+// -----------------------------------------------------------------------------
+// Save states
+// -----------------------------------------------------------------------------
+// The actor tables only ever hold the actors hit by fused items recently, this leaves room for hundreds per table
+static constexpr size_t kFuseSaveStateCapacity = 64 * 1024;
+
+// Actor keyed tables are stored as (slot, value) pairs in slot order, ended by slot -1, so the same state always
+// saves to the same bytes. They are written by walking the slots and looking each actor up, rather than sorting a copy,
+// since this runs on every rewind capture. Actors no longer in the actor lists are dropped, they would have been
+// cleaned up before the table was read again.
+template <typename T> static void SaveActorTable(SaveStateArena& arena, const std::unordered_map<Actor*, T>& table) {
+    if (!table.empty()) {
+        for (int16_t slot = 0; Actor* actor = SaveState_GetSlotActor(slot); slot++) {
+            const auto it = table.find(actor);
+            if (it != table.end()) {
+                arena.Write(slot);
+                arena.Write(it->second);
+            }
+        }
+    }
+    arena.Write<int16_t>(-1);
+}
+
+template <typename T> static void LoadActorTable(SaveStateArena& arena, std::unordered_map<Actor*, T>& table) {
+    table.clear();
+    int16_t slot;
+    T value;
+    while (arena.Read(slot) && slot != -1 && arena.Read(value)) {
+        if (Actor* actor = SaveState_GetSlotActor(slot)) {
+            table[actor] = value;
+        }
+    }
+}
+
+static void SaveActorSet(SaveStateArena& arena, const std::unordered_set<Actor*>& set) {
+    if (!set.empty()) {
+        for (int16_t slot = 0; Actor* actor = SaveState_GetSlotActor(slot); slot++) {
+            if (set.contains(actor)) {
+                arena.Write(slot);
+            }
+        }
+    }
+    arena.Write<int16_t>(-1);
+}
+
+static void LoadActorSet(SaveStateArena& arena, std::unordered_set<Actor*>& set) {
+    set.clear();
+    int16_t slot;
+    while (arena.Read(slot) && slot != -1) {
+        if (Actor* actor = SaveState_GetSlotActor(slot)) {
+            set.insert(actor);
+        }
+    }
+}
+
+// Queued requests keep their order, the victim pointer stored with each request is replaced on load
+template <typename T> static void SaveRequestQueue(SaveStateArena& arena, const std::vector<T>& queue) {
+    for (const T& request : queue) {
+        const int16_t slot = SaveState_GetActorSlot(request.victim);
+        if (slot != -1) {
+            arena.Write(slot);
+            arena.Write(request);
+        }
+    }
+    arena.Write<int16_t>(-1);
+}
+
+template <typename T> static void LoadRequestQueue(SaveStateArena& arena, std::vector<T>& queue) {
+    queue.clear();
+    int16_t slot;
+    T request;
+    while (arena.Read(slot) && slot != -1 && arena.Read(request)) {
+        request.victim = SaveState_GetSlotActor(slot);
+        if (request.victim != nullptr) {
+            queue.push_back(request);
+        }
+    }
+}
+
+static void Fuse_SaveState(SaveStateArena& arena) {
+    arena.Write(gFuseSave);
+    arena.Write(gFuseRuntime);
+    arena.Write(gRangedQueued);
+    arena.Write(gRangedActive);
+
+    // Sorted through a scratch buffer that keeps its capacity, so rewind captures don't allocate
+    static std::vector<std::pair<MaterialId, uint16_t>> materials;
+    materials.assign(sMaterialInventory.begin(), sMaterialInventory.end());
+    std::sort(materials.begin(), materials.end());
+    arena.Write(sMaterialInventoryInitialized);
+    arena.Write(static_cast<uint16_t>(materials.size()));
+    for (const auto& [materialId, count] : materials) {
+        arena.Write(materialId);
+        arena.Write(count);
+    }
+
+    for (size_t i = 0; i < kSwordFreezeQueueCount; i++) {
+        arena.Write(sSwordFreezeQueueFrames[i]);
+        SaveRequestQueue(arena, sSwordFreezeQueues[i]);
+    }
+    SaveRequestQueue(arena, sPendingStunQueue);
+    SaveActorTable(arena, sDekuStunCooldownUntil);
+    SaveActorTable(arena, sDekuLastSwordHitFrame);
+    arena.Write(sMegaStunCooldownUntil);
+
+    SaveActorTable(arena, sFuseFrozenTimers);
+    SaveActorTable(arena, sFreezeAppliedFrame);
+    SaveActorTable(arena, sFreezeShatterFrame);
+    SaveActorTable(arena, sFreezeLastShatterFrame);
+    SaveActorTable(arena, sFreezeNoReapplyUntilFrame);
+    SaveActorTable(arena, sShatterImpulseUntilFrame);
+    SaveActorTable(arena, sShatterImpulseDir);
+    SaveActorTable(arena, sShatterImpulseYaw);
+    SaveActorSet(arena, sShatterImpulseFlipped);
+    SaveActorTable(arena, sFuseFrozenOrigGravity);
+    SaveActorSet(arena, sHpOverrideApplied);
+    SaveActorTable(arena, sFuseFrozenPos);
+    SaveActorTable(arena, sFuseFrozenPinned);
+}
+
+static void Fuse_LoadState(SaveStateArena& arena) {
+    arena.Read(gFuseSave);
+    arena.Read(gFuseRuntime);
+    arena.Read(gRangedQueued);
+    arena.Read(gRangedActive);
+
+    arena.Read(sMaterialInventoryInitialized);
+    uint16_t materialCount = 0;
+    arena.Read(materialCount);
+    sMaterialInventory.clear();
+    for (uint16_t i = 0; i < materialCount; i++) {
+        MaterialId materialId;
+        uint16_t count;
+        if (arena.Read(materialId) && arena.Read(count)) {
+            sMaterialInventory[materialId] = count;
+        }
+    }
+
+    // The victim sets and the pending stun index mirror their queues, so they are rebuilt from them
+    for (size_t i = 0; i < kSwordFreezeQueueCount; i++) {
+        arena.Read(sSwordFreezeQueueFrames[i]);
+        LoadRequestQueue(arena, sSwordFreezeQueues[i]);
+        sSwordFreezeVictims[i].clear();
+        for (const SwordFreezeRequest& request : sSwordFreezeQueues[i]) {
+            sSwordFreezeVictims[i].insert(request.victim);
+        }
+    }
+    LoadRequestQueue(arena, sPendingStunQueue);
+    sPendingStunIndex.clear();
+    for (size_t i = 0; i < sPendingStunQueue.size(); i++) {
+        sPendingStunIndex[sPendingStunQueue[i].victim] = i;
+    }
+    LoadActorTable(arena, sDekuStunCooldownUntil);
+    LoadActorTable(arena, sDekuLastSwordHitFrame);
+    arena.Read(sMegaStunCooldownUntil);
+
+    LoadActorTable(arena, sFuseFrozenTimers);
+    LoadActorTable(arena, sFreezeAppliedFrame);
+    LoadActorTable(arena, sFreezeShatterFrame);
+    LoadActorTable(arena, sFreezeLastShatterFrame);
+    LoadActorTable(arena, sFreezeNoReapplyUntilFrame);
+    LoadActorTable(arena, sShatterImpulseUntilFrame);
+    LoadActorTable(arena, sShatterImpulseDir);
+    LoadActorTable(arena, sShatterImpulseYaw);
+    LoadActorSet(arena, sShatterImpulseFlipped);
+    LoadActorTable(arena, sFuseFrozenOrigGravity);
+    LoadActorSet(arena, sHpOverrideApplied);
+    LoadActorTable(arena, sFuseFrozenPos);
+    LoadActorTable(arena, sFuseFrozenPinned);
+}
+
+// Everything Fuse_LoadState restores, back to what a freshly started game has
+static void Fuse_ClearState() {
+    gFuseSave = FuseSaveData{};
+    gFuseRuntime = FuseRuntimeState{};
+    gRangedQueued = {};
+    gRangedActive = {};
+    sMaterialInventoryInitialized = false;
+    sMaterialInventory.clear();
+
+    ResetSwordFreezeQueueInternal();
+    ResetDekuStunQueueInternal();
+    sFuseFrozenTimers.clear();
+    sFreezeAppliedFrame.clear();
+    sFreezeShatterFrame.clear();
+    sFreezeLastShatterFrame.clear();
+    sFreezeNoReapplyUntilFrame.clear();
+    sShatterImpulseUntilFrame.clear();
+    sShatterImpulseDir.clear();
+    sShatterImpulseYaw.clear();
+    sShatterImpulseFlipped.clear();
+    sFuseFrozenOrigGravity.clear();
+    sHpOverrideApplied.clear();
+    sFuseFrozenPos.clear();
+    sFuseFrozenPinned.clear();
+}
+
+static RegisterSaveStateExtension fuseSaveStateExtension({ "Fuse", kFuseSaveStateCapacity, Fuse_SaveState,
+                                                           Fuse_LoadState, Fuse_ClearState });
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "z64.h"
+#include "soh/Enhancements/Fuse/FuseLog.h"
 #include "soh/Enhancements/Fuse/FuseMaterials.h"
 #include "soh/Enhancements/Fuse/FuseModifiers.h"
 #include "soh/Enhancements/Fuse/FuseState.h"
@@ -228,7 +229,4 @@ void ApplyLoadedHammerSlot(const FuseSlot& slot);
 bool HasLoadedHammerSlot();
 FuseSlot GetLoadedHammerSlot();
 
-// Simple logger (goes to VS Output on Windows)
-void Log(const char* fmt, ...);
-
 } // namespace Fuse
@@ -0,0 +1,283 @@
+#include "FuseLog.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace Fuse {
+namespace LogDetail {
+namespace {
+
+constexpr uint32_t kRingCapacity = 1024; // must be a power of two
+constexpr uint32_t kRingMask = kRingCapacity - 1;
+constexpr auto kWriterIdleSleep = std::chrono::milliseconds(2);
+
+struct LogRing {
+    Cell cells[kRingCapacity];
+    alignas(64) std::atomic<uint32_t> enqueuePos = 0;
+    alignas(64) uint32_t dequeuePos = 0;
+    std::atomic<uint64_t> dropped = 0;
+
+    LogRing() {
+        for (uint32_t i = 0; i < kRingCapacity; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+};
+
+LogRing sRing;
+
+// Formats one conversion spec (e.g. "%04X") with a packed argument, casting to the type the spec expects
+int FormatArg(char* out, size_t cap, const char* spec, char conversion, const char* lengthMod, const Record& record,
+              const Arg& arg) {
+    const bool isLong = lengthMod[0] == 'l' && lengthMod[1] != 'l';
+    const bool isLongLong = (lengthMod[0] == 'l' && lengthMod[1] == 'l') || lengthMod[0] == 'j';
+    const bool isSize = lengthMod[0] == 'z' || lengthMod[0] == 't';
+
+    auto asSigned = [&]() -> int64_t {
+        switch (arg.type) {
+            case ArgType::Signed:
+                return arg.i;
+            case ArgType::Unsigned:
+                return static_cast<int64_t>(arg.u);
+            case ArgType::Double:
+                return static_cast<int64_t>(arg.d);
+            case ArgType::Pointer:
+                return static_cast<int64_t>(reinterpret_cast<uintptr_t>(arg.p));
+            default:
+                return 0;
+        }
+    };
+
+    switch (conversion) {
+        case 'd':
+        case 'i':
+            if (isLongLong) {
+                return snprintf(out, cap, spec, static_cast<long long>(asSigned()));
+            } else if (isLong) {
+                return snprintf(out, cap, spec, static_cast<long>(asSigned()));
+            } else if (isSize) {
+                return snprintf(out, cap, spec, static_cast<ptrdiff_t>(asSigned()));
+            }
+            return snprintf(out, cap, spec, static_cast<int>(asSigned()));
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+            if (isLongLong) {
+                return snprintf(out, cap, spec, static_cast<unsigned long long>(asSigned()));
+            } else if (isLong) {
+                return snprintf(out, cap, spec, static_cast<unsigned long>(asSigned()));
+            } else if (isSize) {
+                return snprintf(out, cap, spec, static_cast<size_t>(asSigned()));
+            }
+            return snprintf(out, cap, spec, static_cast<unsigned int>(asSigned()));
+        case 'c':
+            return snprintf(out, cap, spec, static_cast<int>(asSigned()));
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            return snprintf(out, cap, spec,
+                            arg.type == ArgType::Double ? arg.d : static_cast<double>(asSigned()));
+        case 's':
+            if (arg.type != ArgType::String) {
+                return snprintf(out, cap, "%s", "(?)");
+            }
+            return snprintf(out, cap, spec,
+                            arg.stringOffset < kStringBytes ? &record.strings[arg.stringOffset] : "");
+        case 'p':
+            return snprintf(out, cap, spec, arg.type == ArgType::Pointer ? arg.p : nullptr);
+        default:
+            return snprintf(out, cap, "%s", spec);
+    }
+}
+
+size_t FormatRecord(const Record& record, char* out, size_t cap) {
+    size_t len = 0;
+    uint8_t argIndex = 0;
+    const char* fmt = record.fmt;
+
+    auto append = [&](int written) {
+        if (written > 0) {
+            len = std::min(len + static_cast<size_t>(written), cap - 1);
+        }
+    };
+
+    while (*fmt != '\0' && len < cap - 1) {
+        if (*fmt != '%') {
+            out[len++] = *fmt++;
+            continue;
+        }
+        if (fmt[1] == '%') {
+            out[len++] = '%';
+            fmt += 2;
+            continue;
+        }
+
+        // Collect "%[flags][width][.precision][length]conversion"
+        char spec[32];
+        size_t specLen = 0;
+        spec[specLen++] = *fmt++;
+        while (*fmt != '\0' && strchr("-+ #0123456789.", *fmt) != nullptr && specLen < sizeof(spec) - 4) {
+            spec[specLen++] = *fmt++;
+        }
+        char lengthMod[3] = {};
+        size_t lengthLen = 0;
+        while (*fmt != '\0' && strchr("hlzjtL", *fmt) != nullptr && lengthLen < 2) {
+            lengthMod[lengthLen++] = *fmt;
+            spec[specLen++] = *fmt++;
+        }
+        if (*fmt == '\0') {
+            break;
+        }
+        const char conversion = *fmt++;
+        spec[specLen++] = conversion;
+        spec[specLen] = '\0';
+
+        if (argIndex >= record.argCount) {
+            append(snprintf(&out[len], cap - len, "%s", spec));
+            continue;
+        }
+        append(FormatArg(&out[len], cap - len, spec, conversion, lengthMod, record, record.args[argIndex++]));
+    }
+
+    out[len] = '\0';
+    return len;
+}
+
+class LogWriter {
+  public:
+    ~LogWriter() {
+        Stop();
+    }
+
+    void EnsureStarted() {
+        std::call_once(mStartFlag, [this]() {
+            mRunning.store(true, std::memory_order_release);
+            mThread = std::thread(&LogWriter::Run, this);
+        });
+    }
+
+    void Flush() {
+        const uint32_t target = sRing.enqueuePos.load(std::memory_order_acquire);
+        while (static_cast<int32_t>(mWrittenPos.load(std::memory_order_acquire) - target) < 0 &&
+               mRunning.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(kWriterIdleSleep);
+        }
+    }
+
+  private:
+    void Stop() {
+        if (!mThread.joinable()) {
+            return;
+        }
+        mRunning.store(false, std::memory_order_release);
+        mThread.join();
+        Drain();
+    }
+
+    bool Drain() {
+        static char sLine[1024];
+        bool wroteAny = false;
+
+        while (true) {
+            Cell& cell = sRing.cells[sRing.dequeuePos & kRingMask];
+            const uint32_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence != sRing.dequeuePos + 1) {
+                break;
+            }
+
+            FormatRecord(cell.record, sLine, sizeof(sLine));
+            cell.sequence.store(sRing.dequeuePos + kRingCapacity, std::memory_order_release);
+            sRing.dequeuePos++;
+            mWrittenPos.store(sRing.dequeuePos, std::memory_order_release);
+
+#ifdef _WIN32
+            OutputDebugStringA(sLine);
+#endif
+            fputs(sLine, stdout);
+            wroteAny = true;
+        }
+
+        const uint64_t dropped = sRing.dropped.load(std::memory_order_relaxed);
+        if (dropped != mReportedDropped) {
+            snprintf(sLine, sizeof(sLine), "[Fuse] dropped %llu log records (ring full)\n",
+                     static_cast<unsigned long long>(dropped - mReportedDropped));
+#ifdef _WIN32
+            OutputDebugStringA(sLine);
+#endif
+            fputs(sLine, stdout);
+            mReportedDropped = dropped;
+            wroteAny = true;
+        }
+
+        if (wroteAny) {
+            fflush(stdout);
+        }
+        return wroteAny;
+    }
+
+    void Run() {
+        while (mRunning.load(std::memory_order_acquire)) {
+            if (!Drain()) {
+                std::this_thread::sleep_for(kWriterIdleSleep);
+            }
+        }
+    }
+
+    std::once_flag mStartFlag;
+    std::atomic<bool> mRunning = false;
+    std::atomic<uint32_t> mWrittenPos = 0;
+    uint64_t mReportedDropped = 0;
+    std::thread mThread;
+};
+
+LogWriter sWriter;
+
+} // namespace
+
+Cell* BeginRecord() {
+    sWriter.EnsureStarted();
+
+    uint32_t pos = sRing.enqueuePos.load(std::memory_order_relaxed);
+    while (true) {
+        Cell* cell = &sRing.cells[pos & kRingMask];
+        const uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const int32_t diff = static_cast<int32_t>(sequence - pos);
+        if (diff == 0) {
+            if (sRing.enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell->claimedPos = pos;
+                return cell;
+            }
+        } else if (diff < 0) {
+            sRing.dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        } else {
+            pos = sRing.enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace LogDetail
+
+uint64_t GetDroppedLogRecords() {
+    return LogDetail::sRing.dropped.load(std::memory_order_relaxed);
+}
+
+void FlushLog() {
+    LogDetail::sWriter.Flush();
+}
+
+} // namespace Fuse
@@ -0,0 +1,157 @@
+#pragma once
+#ifndef __cplusplus
+#error "This header is C++-only. Use FuseCBridge.h from C files."
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Records below this level are compiled out entirely. Override per build with -DFUSE_LOG_MIN_LEVEL=...
+#define FUSE_LOG_LEVEL_TRACE 0
+#define FUSE_LOG_LEVEL_DEBUG 1
+#define FUSE_LOG_LEVEL_INFO 2
+#define FUSE_LOG_LEVEL_WARN 3
+#define FUSE_LOG_LEVEL_ERROR 4
+
+#ifndef FUSE_LOG_MIN_LEVEL
+#define FUSE_LOG_MIN_LEVEL FUSE_LOG_LEVEL_DEBUG
+#endif
+
+namespace Fuse {
+
+enum class LogLevel : uint8_t {
+    Trace = FUSE_LOG_LEVEL_TRACE,
+    Debug = FUSE_LOG_LEVEL_DEBUG,
+    Info = FUSE_LOG_LEVEL_INFO,
+    Warn = FUSE_LOG_LEVEL_WARN,
+    Error = FUSE_LOG_LEVEL_ERROR,
+};
+
+namespace LogDetail {
+
+constexpr size_t kMaxArgs = 12;
+constexpr size_t kStringBytes = 192;
+
+enum class ArgType : uint8_t {
+    Signed,
+    Unsigned,
+    Double,
+    Pointer,
+    String,
+};
+
+struct Arg {
+    ArgType type;
+    union {
+        int64_t i;
+        uint64_t u;
+        double d;
+        const void* p;
+        uint16_t stringOffset;
+    };
+};
+
+// A fixed-size log record. The format string must outlive the writer thread (i.e. be a literal); string arguments
+// are copied into the record, everything else is stored by value and formatted on the writer thread.
+struct Record {
+    const char* fmt;
+    uint8_t argCount;
+    uint16_t stringBytes;
+    Arg args[kMaxArgs];
+    char strings[kStringBytes];
+};
+
+struct Cell {
+    std::atomic<uint32_t> sequence;
+    uint32_t claimedPos;
+    Record record;
+};
+
+// Claims a slot in the MPSC ring, or returns nullptr (and counts a dropped record) when the ring is full
+Cell* BeginRecord();
+
+inline void CommitRecord(Cell* cell) {
+    cell->sequence.store(cell->claimedPos + 1, std::memory_order_release);
+}
+
+inline void PackString(Record& record, const char* str) {
+    Arg& arg = record.args[record.argCount++];
+    arg.type = ArgType::String;
+    arg.stringOffset = record.stringBytes;
+
+    const size_t available = kStringBytes - record.stringBytes;
+    if (available == 0) {
+        return;
+    }
+    const char* src = str != nullptr ? str : "(null)";
+    size_t len = strnlen(src, available - 1);
+    memcpy(&record.strings[record.stringBytes], src, len);
+    record.strings[record.stringBytes + len] = '\0';
+    record.stringBytes += static_cast<uint16_t>(len + 1);
+}
+
+template <typename T> inline void PackArg(Record& record, T value) {
+    if constexpr (std::is_same_v<T, const char*> || std::is_same_v<T, char*>) {
+        PackString(record, value);
+    } else if constexpr (std::is_enum_v<T>) {
+        PackArg(record, static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        Arg& arg = record.args[record.argCount++];
+        arg.type = ArgType::Signed;
+        arg.i = value;
+    } else if constexpr (std::is_integral_v<T>) {
+        Arg& arg = record.args[record.argCount++];
+        arg.type = ArgType::Unsigned;
+        arg.u = value;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        Arg& arg = record.args[record.argCount++];
+        arg.type = ArgType::Double;
+        arg.d = value;
+    } else if constexpr (std::is_pointer_v<T> || std::is_null_pointer_v<T>) {
+        Arg& arg = record.args[record.argCount++];
+        arg.type = ArgType::Pointer;
+        arg.p = value;
+    } else {
+        static_assert(!sizeof(T), "Fuse::Log only accepts integers, floats, enums, pointers and C strings");
+    }
+}
+
+} // namespace LogDetail
+
+// Queues a printf-style message for the background writer. The call costs a slot claim and a few stores; formatting,
+// stdout and the debugger output all happen off the game thread.
+template <LogLevel Level, typename... Args> inline void LogAt(const char* fmt, Args... args) {
+    if constexpr (static_cast<int>(Level) >= FUSE_LOG_MIN_LEVEL) {
+        static_assert(sizeof...(Args) <= LogDetail::kMaxArgs, "Too many Fuse::Log arguments");
+
+        LogDetail::Cell* cell = LogDetail::BeginRecord();
+        if (cell == nullptr) {
+            return;
+        }
+        LogDetail::Record& record = cell->record;
+        record.fmt = fmt;
+        record.argCount = 0;
+        record.stringBytes = 0;
+        (LogDetail::PackArg(record, args), ...);
+        LogDetail::CommitRecord(cell);
+    }
+}
+
+// Simple logger (goes to VS Output on Windows)
+template <typename... Args> inline void Log(const char* fmt, Args... args) {
+    LogAt<LogLevel::Debug>(fmt, args...);
+}
+
+// For messages emitted every frame; compiled out unless FUSE_LOG_MIN_LEVEL is lowered to trace
+template <typename... Args> inline void LogTrace(const char* fmt, Args... args) {
+    LogAt<LogLevel::Trace>(fmt, args...);
+}
+
+uint64_t GetDroppedLogRecords();
+// Blocks until every record queued so far has been written
+void FlushLog();
+
+} // namespace Fuse
@@ -3,49 +3,77 @@
 
 namespace {
 
-static const ModifierSpec kRockMods[] = {
+constexpr ModifierSpec kRockMods[] = {
     { ModifierId::Hammerize, 1 },
     { ModifierId::Knockback, 1 },
     { ModifierId::PoundUp, 1 },
     { ModifierId::NegateKnockback, 1 },
 };
 
-static const ModifierSpec kDekuNutMods[] = {
+constexpr ModifierSpec kDekuNutMods[] = {
     { ModifierId::Stun, 1 },
     { ModifierId::MegaStun, 1 },
 };
 
-static const ModifierSpec kFrozenShardMods[] = {
+constexpr ModifierSpec kFrozenShardMods[] = {
     { ModifierId::Freeze, 1 },
 };
 
-static const ModifierSpec kStickMods[] = {
+constexpr ModifierSpec kStickMods[] = {
     { ModifierId::RangeUp, 3 },
     { ModifierId::WideRange, 3 },
 };
 
-static const ModifierSpec kBombMods[] = {
+constexpr ModifierSpec kBombMods[] = {
     { ModifierId::Explosion, 1 },
 };
 
+template <size_t N> constexpr size_t CountOf(const ModifierSpec (&)[N]) {
+    return N;
+}
+
 constexpr MaterialDef kMaterialDefs[] = {
     { MaterialId::None, "None", 0, 0, nullptr, 0 },
-    { MaterialId::Rock, "ROCK", 1, 10, kRockMods, 4 },
-    { MaterialId::DekuNut, "Deku Nut", 0, 5, kDekuNutMods, 2 },
-    { MaterialId::Stick, "Stick", 2, 3, kStickMods, 2 },
-    { MaterialId::FrozenShard, "Frozen Shard", 0, 8, kFrozenShardMods, 1 },
-    { MaterialId::Bomb, "Bomb", 1, 1, kBombMods, 1 },
+    { MaterialId::Rock, "ROCK", 1, 10, kRockMods, CountOf(kRockMods) },
+    { MaterialId::DekuNut, "Deku Nut", 0, 5, kDekuNutMods, CountOf(kDekuNutMods) },
+    { MaterialId::Stick, "Stick", 2, 3, kStickMods, CountOf(kStickMods) },
+    { MaterialId::FrozenShard, "Frozen Shard", 0, 8, kFrozenShardMods, CountOf(kFrozenShardMods) },
+    { MaterialId::Bomb, "Bomb", 1, 1, kBombMods, CountOf(kBombMods) },
 };
 
+constexpr size_t kNoDef = static_cast<size_t>(-1);
+
+// MaterialId -> index in kMaterialDefs. An id outside the enum range fails to compile here.
+constexpr auto kMaterialDefIndex = [] {
+    std::array<size_t, kMaterialIdCount> index{};
+    index.fill(kNoDef);
+    for (size_t i = 0; i < std::size(kMaterialDefs); i++) {
+        index[static_cast<size_t>(kMaterialDefs[i].id)] = i;
+    }
+    return index;
+}();
+
+// MaterialId x ModifierId -> level, built from the rows above
+constexpr auto kModifierLevels = [] {
+    std::array<ModifierLevels, kMaterialIdCount> levels{};
+    for (const MaterialDef& def : kMaterialDefs) {
+        for (size_t i = 0; i < def.modifierCount; i++) {
+            levels[static_cast<size_t>(def.id)][static_cast<size_t>(def.modifiers[i].id)] = def.modifiers[i].level;
+        }
+    }
+    return levels;
+}();
+
+constexpr ModifierLevels kNoModifiers{};
+
 } // namespace
 
 const MaterialDef* FuseMaterials::GetMaterialDef(MaterialId id) {
-    for (const auto& def : kMaterialDefs) {
-        if (def.id == id) {
-            return &def;
-        }
+    const size_t value = static_cast<size_t>(id);
+    if (value >= kMaterialIdCount || kMaterialDefIndex[value] == kNoDef) {
+        return nullptr;
     }
-    return nullptr;
+    return &kMaterialDefs[kMaterialDefIndex[value]];
 }
 
 const MaterialDef* FuseMaterials::GetMaterialDefs(size_t* count) {
@@ -54,3 +82,13 @@ const MaterialDef* FuseMaterials::GetMaterialDefs(size_t* count) {
     }
     return kMaterialDefs;
 }
+
+const ModifierLevels& FuseMaterials::GetModifierLevels(MaterialId id) {
+    const size_t value = static_cast<size_t>(id);
+    return value < kMaterialIdCount ? kModifierLevels[value] : kNoModifiers;
+}
+
+uint8_t FuseMaterials::GetModifierLevel(MaterialId material, ModifierId modifier) {
+    const size_t modifierValue = static_cast<size_t>(modifier);
+    return modifierValue < kModifierIdCount ? GetModifierLevels(material)[modifierValue] : 0;
+}
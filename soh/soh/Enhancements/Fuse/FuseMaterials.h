@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 
@@ -14,6 +15,9 @@ enum class MaterialId : uint16_t {
     Bomb = 5,
 };
 
+// One past the highest MaterialId. New materials are added to the enum, here, and as a row in FuseMaterials.cpp.
+inline constexpr size_t kMaterialIdCount = static_cast<size_t>(MaterialId::Bomb) + 1;
+
 struct MaterialDef {
     MaterialId id;
     const char* name;
@@ -23,7 +27,13 @@ struct MaterialDef {
     size_t modifierCount;
 };
 
+// Level of every modifier a material grants, indexed by ModifierId. 0 if the material doesn't grant it.
+using ModifierLevels = std::array<uint8_t, kModifierIdCount>;
+
 namespace FuseMaterials {
 const MaterialDef* GetMaterialDef(MaterialId id);
 const MaterialDef* GetMaterialDefs(size_t* count);
+// All modifier levels of a material, all 0 for unknown materials
+const ModifierLevels& GetModifierLevels(MaterialId id);
+uint8_t GetModifierLevel(MaterialId material, ModifierId modifier);
 }
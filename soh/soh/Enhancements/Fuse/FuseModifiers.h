@@ -19,10 +19,10 @@ enum class ModifierId : uint16_t {
     Explosion = 10,
 };
 
+// One past the highest ModifierId
+inline constexpr size_t kModifierIdCount = static_cast<size_t>(ModifierId::Explosion) + 1;
+
 struct ModifierSpec {
     ModifierId id;
     uint8_t level; // 1–3
 };
-
-// Helper API:
-bool HasModifier(const ModifierSpec* mods, size_t count, ModifierId id, uint8_t* outLevel = nullptr);
@@ -69,9 +69,9 @@ extern "C" void FuseHooks_OnBoomerangHitActor(PlayState* play, Actor* victim, co
         uint8_t freezeLevel = 0;
         uint8_t explosionLevel = 0;
         if (def) {
-            HasModifier(def->modifiers, def->modifierCount, ModifierId::Knockback, &knockbackLevel);
-            HasModifier(def->modifiers, def->modifierCount, ModifierId::Stun, &stunLevel);
-            HasModifier(def->modifiers, def->modifierCount, ModifierId::Freeze, &freezeLevel);
+            knockbackLevel = FuseMaterials::GetModifierLevel(def->id, ModifierId::Knockback);
+            stunLevel = FuseMaterials::GetModifierLevel(def->id, ModifierId::Stun);
+            freezeLevel = FuseMaterials::GetModifierLevel(def->id, ModifierId::Freeze);
             explosionLevel =
                 Fuse::GetMaterialModifierLevel(materialId, FuseItemType::Boomerang, ModifierId::Explosion);
         }
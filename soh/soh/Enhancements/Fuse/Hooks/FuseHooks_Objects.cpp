@@ -5,6 +5,7 @@
 #include "functions.h"
 
 #include "soh/Enhancements/Fuse/Fuse.h"
+#include "soh/ActorGrid.h"
 
 #include <cstdint>
 #include <cmath>
@@ -109,14 +110,7 @@ static bool IsActorStillInLists(PlayState* play, Actor* target) {
     if (!play || !target)
         return false;
 
-    ActorContext* actorCtx = &play->actorCtx;
-    for (int cat = 0; cat < ACTORCAT_MAX; cat++) {
-        for (Actor* a = actorCtx->actorLists[cat].head; a; a = a->next) {
-            if (a == target)
-                return true;
-        }
-    }
-    return false;
+    return ActorGrid_Contains(&play->actorCtx, target);
 }
 
 static bool IsPlayerSafeForInput(const Player* player) {
@@ -173,29 +167,22 @@ static bool IsAnyLiftableRockNearPlayer(PlayState* play, Player* player) {
 
     const Vec3f p = player->actor.world.pos;
 
-    ActorContext* actorCtx = &play->actorCtx;
-    for (int cat = 0; cat < ACTORCAT_MAX; cat++) {
-        for (Actor* a = actorCtx->actorLists[cat].head; a; a = a->next) {
-            if (a->id != kLiftableRockActorId)
-                continue;
-            if (player->heldActor == a)
-                continue;
+    bool found = false;
+    ActorGrid_ForEachNear(&play->actorCtx, &p, kRockGateRadius, [&](Actor* a) {
+        if (found || a->id != kLiftableRockActorId || player->heldActor == a)
+            return;
 
-            const float dx = a->world.pos.x - p.x;
-            const float dy = a->world.pos.y - p.y;
-            const float dz = a->world.pos.z - p.z;
+        const float dx = a->world.pos.x - p.x;
+        const float dy = a->world.pos.y - p.y;
+        const float dz = a->world.pos.z - p.z;
 
-            if (std::fabs(dy) > kRockGateMaxYDiff)
-                continue;
+        if (std::fabs(dy) > kRockGateMaxYDiff)
+            return;
 
-            const float distSq = dx * dx + dz * dz;
-            if (distSq <= kRockGateRadiusSq) {
-                return true;
-            }
-        }
-    }
+        found = (dx * dx + dz * dz) <= kRockGateRadiusSq;
+    });
 
-    return false;
+    return found;
 }
 
 static bool IsPlayerSwordCollider(Player* player, Collider* collider) {
@@ -319,8 +306,8 @@ static void ApplyHammerFlagsToSwordHitbox(Player* player, uint8_t level) {
         player->meleeWeaponQuads[i].info.toucher.dmgFlags = baseFlags | flags;
     }
 
-    Fuse::Log("[FuseMVP] Hammerize applied base0=0x%08X new0=0x%08X\n", gSwordBaseDmgFlags[0],
-              player->meleeWeaponQuads[0].info.toucher.dmgFlags);
+    Fuse::LogTrace("[FuseMVP] Hammerize applied base0=0x%08X new0=0x%08X\n", gSwordBaseDmgFlags[0],
+                   player->meleeWeaponQuads[0].info.toucher.dmgFlags);
 }
 
 // -----------------------------------------------------------------------------
@@ -561,8 +548,8 @@ void OnFrame_Objects_Pre(PlayState* play) {
 
     if (gHammerizeAppliedFrame != -1 && play->gameplayFrames > gHammerizeAppliedFrame) {
         RestoreSwordBaseDmgFlags(player);
-        Fuse::Log("[FuseMVP] Restored sword flags at frame=%d (from appliedFrame=%d)\n", play->gameplayFrames,
-                  gHammerizeAppliedFrame);
+        Fuse::LogTrace("[FuseMVP] Restored sword flags at frame=%d (from appliedFrame=%d)\n", play->gameplayFrames,
+                       gHammerizeAppliedFrame);
         gHammerizeAppliedFrame = -1;
     }
 
@@ -580,7 +567,7 @@ void OnFrame_Objects_Pre(PlayState* play) {
         ApplyHammerFlagsToSwordHitbox(player, hammerLevel);
         gHammerizeAppliedFrame = play->gameplayFrames;
         hammerApplied = true;
-        Fuse::Log("[FuseMVP] Hammerize applied at frame=%d\n", gHammerizeAppliedFrame);
+        Fuse::LogTrace("[FuseMVP] Hammerize applied at frame=%d\n", gHammerizeAppliedFrame);
     } else {
         RestoreSwordBaseDmgFlags(player);
     }
@@ -622,8 +609,8 @@ void OnPlayerUpdate(PlayState* play) {
             uint8_t poundLevel = 0;
             uint8_t megaStunLevel = 0;
             if (def) {
-                HasModifier(def->modifiers, def->modifierCount, ModifierId::PoundUp, &poundLevel);
-                HasModifier(def->modifiers, def->modifierCount, ModifierId::MegaStun, &megaStunLevel);
+                poundLevel = FuseMaterials::GetModifierLevel(def->id, ModifierId::PoundUp);
+                megaStunLevel = FuseMaterials::GetModifierLevel(def->id, ModifierId::MegaStun);
             }
 
             if (poundLevel > 0) {
@@ -195,8 +195,8 @@ extern "C" void Fuse_OnRangedHitActor(PlayState* play, RangedFuseSlotId slot, Ac
         return;
     }
 
-    uint8_t stunLevel = 0;
-    if (HasModifier(def->modifiers, def->modifierCount, ModifierId::Stun, &stunLevel) && stunLevel > 0) {
+    const uint8_t stunLevel = FuseMaterials::GetModifierLevel(def->id, ModifierId::Stun);
+    if (stunLevel > 0) {
         const Vec3f* stunPos = impactPos ? impactPos : &victim->focus.pos;
         const Vec3f& loggedPos = stunPos ? *stunPos : victim->world.pos;
         Fuse_TriggerDekuNutAtPos(play, loggedPos, RangedSlotItemId(slot));
@@ -209,8 +209,8 @@ extern "C" void Fuse_OnRangedHitActor(PlayState* play, RangedFuseSlotId slot, Ac
         return;
     }
 
-    uint8_t freezeLevel = 0;
-    if (HasModifier(def->modifiers, def->modifierCount, ModifierId::Freeze, &freezeLevel) && freezeLevel > 0) {
+    const uint8_t freezeLevel = FuseMaterials::GetModifierLevel(def->id, ModifierId::Freeze);
+    if (freezeLevel > 0) {
         Fuse::QueueSwordFreeze(play, victim, freezeLevel, "ranged", RangedSlotLabel(slot), materialId);
     }
 
@@ -228,11 +228,7 @@ static void LogRangedKnockbackStatus(const char* itemLabel, RangedFuseSlot slot,
         return;
     }
 
-    uint8_t level = 0;
-    const MaterialDef* def = Fuse::GetMaterialDef(static_cast<MaterialId>(materialId));
-    if (def) {
-        HasModifier(def->modifiers, def->modifierCount, ModifierId::Knockback, &level);
-    }
+    const uint8_t level = FuseMaterials::GetModifierLevel(static_cast<MaterialId>(materialId), ModifierId::Knockback);
 
     Fuse::Log("[FuseDBG] RangedKnockback: event=%s item=%s mat=%d lvl=%u dura=%d/%d\n", eventLabel ? eventLabel : "hit",
               itemLabel ? itemLabel : "unknown", materialId, static_cast<unsigned int>(level), curDurability,
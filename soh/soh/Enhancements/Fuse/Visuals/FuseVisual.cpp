@@ -2,6 +2,7 @@
 #include "soh/Enhancements/Fuse/Fuse.h"
 #include "soh/frame_interpolation.h" // <-- REQUIRED when using OPEN_DISPS/CLOSE_DISPS in some TUs
 #include "libultraship/bridge/consolevariablebridge.h"
+#include "soh/CVarHandle.h"
 
 #include <algorithm>
 #include <cstdint>
@@ -31,27 +32,50 @@ namespace {
     const AttachmentTransform kShieldAdult = { { 0.0f, 0.0f, 900.0f }, { 0, 0, 0 }, 0.55f };
     const AttachmentTransform kShieldChild = { { 0.0f, 0.0f, 820.0f }, { 0, 0, 0 }, 0.50f };
 
-    float CVarGetFloatCompat(const char* key, float def) {
-        float f = CVarGetFloat(key, def);
+    // Read on every draw, so the keys are resolved once through CVarHandle
+    struct AttachmentTransformCVars {
+        CVarHandle offsetX;
+        CVarHandle offsetY;
+        CVarHandle offsetZ;
+        CVarHandle rotX;
+        CVarHandle rotY;
+        CVarHandle rotZ;
+        CVarHandle scale;
+    };
+
+#define ATTACHMENT_TRANSFORM_CVARS(prefix)                                                                  \
+    {                                                                                                       \
+        CVAR_HANDLE_INIT(prefix ".OffsetX"), CVAR_HANDLE_INIT(prefix ".OffsetY"),                           \
+            CVAR_HANDLE_INIT(prefix ".OffsetZ"), CVAR_HANDLE_INIT(prefix ".RotX"),                          \
+            CVAR_HANDLE_INIT(prefix ".RotY"), CVAR_HANDLE_INIT(prefix ".RotZ"), CVAR_HANDLE_INIT(prefix ".Scale") \
+    }
+
+    AttachmentTransformCVars sLeftHandAdultCVars = ATTACHMENT_TRANSFORM_CVARS("gFuse.Vis.LeftHandAdult");
+    AttachmentTransformCVars sLeftHandChildCVars = ATTACHMENT_TRANSFORM_CVARS("gFuse.Vis.LeftHandChild");
+    AttachmentTransformCVars sShieldAdultCVars = ATTACHMENT_TRANSFORM_CVARS("gFuse.Vis.ShieldAdult");
+    AttachmentTransformCVars sShieldChildCVars = ATTACHMENT_TRANSFORM_CVARS("gFuse.Vis.ShieldChild");
+
+#undef ATTACHMENT_TRANSFORM_CVARS
+
+    float CVarGetFloatCompat(CVarHandle* handle, float def) {
+        float f = CVarHandle_GetFloat(handle, def);
         int idef = static_cast<int>(def);
-        int i = CVarGetInteger(key, idef);
+        int i = CVarHandle_GetInteger(handle, idef);
         if (i != idef) {
             return static_cast<float>(i);
         }
         return f;
     }
 
-    AttachmentTransform ReadAttachmentTransform(const AttachmentTransform& defaults, const char* offsetXKey,
-                                                 const char* offsetYKey, const char* offsetZKey, const char* rotXKey,
-                                                 const char* rotYKey, const char* rotZKey, const char* scaleKey) {
+    AttachmentTransform ReadAttachmentTransform(const AttachmentTransform& defaults, AttachmentTransformCVars& cvars) {
         AttachmentTransform xf = defaults;
-        xf.offset.x = CVarGetFloatCompat(offsetXKey, defaults.offset.x);
-        xf.offset.y = CVarGetFloatCompat(offsetYKey, defaults.offset.y);
-        xf.offset.z = CVarGetFloatCompat(offsetZKey, defaults.offset.z);
-        xf.rot.x = static_cast<s16>(CVarGetInteger(rotXKey, defaults.rot.x));
-        xf.rot.y = static_cast<s16>(CVarGetInteger(rotYKey, defaults.rot.y));
-        xf.rot.z = static_cast<s16>(CVarGetInteger(rotZKey, defaults.rot.z));
-        xf.scale = CVarGetFloat(scaleKey, defaults.scale);
+        xf.offset.x = CVarGetFloatCompat(&cvars.offsetX, defaults.offset.x);
+        xf.offset.y = CVarGetFloatCompat(&cvars.offsetY, defaults.offset.y);
+        xf.offset.z = CVarGetFloatCompat(&cvars.offsetZ, defaults.offset.z);
+        xf.rot.x = static_cast<s16>(CVarHandle_GetInteger(&cvars.rotX, defaults.rot.x));
+        xf.rot.y = static_cast<s16>(CVarHandle_GetInteger(&cvars.rotY, defaults.rot.y));
+        xf.rot.z = static_cast<s16>(CVarHandle_GetInteger(&cvars.rotZ, defaults.rot.z));
+        xf.scale = CVarHandle_GetFloat(&cvars.scale, defaults.scale);
         xf.scale = std::clamp(xf.scale, 0.01f, 5.0f);
         return xf;
     }
@@ -141,28 +165,16 @@ namespace {
 
     AttachmentTransform GetLeftHandTransform() {
         if (LINK_IS_ADULT) {
-            return ReadAttachmentTransform(kLeftHandAdult, "gFuse.Vis.LeftHandAdult.OffsetX",
-                                           "gFuse.Vis.LeftHandAdult.OffsetY", "gFuse.Vis.LeftHandAdult.OffsetZ",
-                                           "gFuse.Vis.LeftHandAdult.RotX", "gFuse.Vis.LeftHandAdult.RotY",
-                                           "gFuse.Vis.LeftHandAdult.RotZ", "gFuse.Vis.LeftHandAdult.Scale");
+            return ReadAttachmentTransform(kLeftHandAdult, sLeftHandAdultCVars);
         }
-        return ReadAttachmentTransform(kLeftHandChild, "gFuse.Vis.LeftHandChild.OffsetX",
-                                       "gFuse.Vis.LeftHandChild.OffsetY", "gFuse.Vis.LeftHandChild.OffsetZ",
-                                       "gFuse.Vis.LeftHandChild.RotX", "gFuse.Vis.LeftHandChild.RotY",
-                                       "gFuse.Vis.LeftHandChild.RotZ", "gFuse.Vis.LeftHandChild.Scale");
+        return ReadAttachmentTransform(kLeftHandChild, sLeftHandChildCVars);
     }
 
     AttachmentTransform GetShieldTransform() {
         if (LINK_IS_ADULT) {
-            return ReadAttachmentTransform(kShieldAdult, "gFuse.Vis.ShieldAdult.OffsetX", "gFuse.Vis.ShieldAdult.OffsetY",
-                                           "gFuse.Vis.ShieldAdult.OffsetZ", "gFuse.Vis.ShieldAdult.RotX",
-                                           "gFuse.Vis.ShieldAdult.RotY", "gFuse.Vis.ShieldAdult.RotZ",
-                                           "gFuse.Vis.ShieldAdult.Scale");
+            return ReadAttachmentTransform(kShieldAdult, sShieldAdultCVars);
         }
-        return ReadAttachmentTransform(kShieldChild, "gFuse.Vis.ShieldChild.OffsetX", "gFuse.Vis.ShieldChild.OffsetY",
-                                       "gFuse.Vis.ShieldChild.OffsetZ", "gFuse.Vis.ShieldChild.RotX",
-                                       "gFuse.Vis.ShieldChild.RotY", "gFuse.Vis.ShieldChild.RotZ",
-                                       "gFuse.Vis.ShieldChild.Scale");
+        return ReadAttachmentTransform(kShieldChild, sShieldChildCVars);
     }
 
     bool IsSegmentValid(uintptr_t segment) {
@@ -15,6 +15,7 @@
 #include "soh/Enhancements/randomizer/randomizer_check_tracker.h"
 #include "soh/Enhancements/randomizer/randomizer_entrance_tracker.h"
 #include "soh/Enhancements/randomizer/randomizer_item_tracker.h"
+#include "soh/Enhancements/audio/AudioCollection.h"
 
 namespace fs = std::filesystem;
 
@@ -128,6 +129,7 @@ void applyPreset(std::string presetName, std::vector<PresetSection> includeSecti
             }
         }
     }
+    AudioCollection::Instance->RebuildReplacementTable();
     ShipInit::InitAll();
     OTRGlobals::Instance->ScaleImGui();
 }
@@ -335,14 +335,19 @@ AudioCollection::AudioCollection() {
         //SEQUENCE_MAP_ENTRY(NA_SE_VO_DUMMY_0x89_YOBI,     "NA_SE_VO_DUMMY_0x89_YOBI",            "NA_SE_VO_DUMMY_0x89_YOBI",       SEQ_VOICE, true, false), // ..
     };
     // clang-format on
+
+    for (size_t seqId = 0; seqId < replacementTable.size(); seqId++) {
+        replacementTable[seqId].store(static_cast<uint16_t>(seqId), std::memory_order_relaxed);
+    }
+    RebuildReplacementTable();
 }
 
-std::string AudioCollection::GetCvarKey(std::string sfxKey) {
+std::string AudioCollection::GetCvarKey(const std::string& sfxKey) {
     auto prefix = CVAR_AUDIO("ReplacedSequences.");
     return prefix + sfxKey + ".value";
 }
 
-std::string AudioCollection::GetCvarLockKey(std::string sfxKey) {
+std::string AudioCollection::GetCvarLockKey(const std::string& sfxKey) {
     auto prefix = std::string(CVAR_AUDIO("ReplacedSequences."));
     return prefix + sfxKey + ".locked";
 }
@@ -371,27 +376,27 @@ void AudioCollection::AddToCollection(char* otrPath, uint16_t seqNum) {
 }
 
 uint16_t AudioCollection::GetReplacementSequence(uint16_t seqId) {
-    // if Hyrule Field Morning is about to play, but Hyrule Field is swapped, get the replacement sequence
-    // for Hyrule Field instead. Otherwise, leave it alone, so that without any sfx editor modifications we will
-    // play the normal track as usual.
-    if (seqId == NA_BGM_FIELD_MORNING) {
-        if (CVarGetInteger(CVAR_AUDIO("ReplacedSequences.NA_BGM_FIELD_LOGIC.value"), NA_BGM_FIELD_LOGIC) !=
-            NA_BGM_FIELD_LOGIC) {
-            seqId = NA_BGM_FIELD_LOGIC;
-        }
-    }
+    return replacementTable[seqId].load(std::memory_order_relaxed);
+}
 
-    if (sequenceMap.find(seqId) == sequenceMap.end()) {
-        return seqId;
+void AudioCollection::RebuildReplacementTable() {
+    for (const auto& [seqId, sequenceInfo] : sequenceMap) {
+        const std::string cvarKey = GetCvarKey(sequenceInfo.sfxKey);
+        int replacementSeq = CVarGetInteger(cvarKey.c_str(), seqId);
+        if (!sequenceMap.contains(replacementSeq)) {
+            replacementSeq = seqId;
+        }
+        replacementTable[seqId].store(static_cast<uint16_t>(replacementSeq), std::memory_order_relaxed);
     }
 
-    const auto& sequenceInfo = sequenceMap.at(seqId);
-    const std::string cvarKey = GetCvarKey(sequenceInfo.sfxKey);
-    int replacementSeq = CVarGetInteger(cvarKey.c_str(), seqId);
-    if (!sequenceMap.contains(replacementSeq)) {
-        replacementSeq = seqId;
+    // if Hyrule Field Morning is about to play, but Hyrule Field is swapped, get the replacement sequence
+    // for Hyrule Field instead. Otherwise, leave it alone, so that without any sfx editor modifications we will
+    // play the normal track as usual.
+    if (CVarGetInteger(CVAR_AUDIO("ReplacedSequences.NA_BGM_FIELD_LOGIC.value"), NA_BGM_FIELD_LOGIC) !=
+        NA_BGM_FIELD_LOGIC) {
+        replacementTable[NA_BGM_FIELD_MORNING].store(
+            replacementTable[NA_BGM_FIELD_LOGIC].load(std::memory_order_relaxed), std::memory_order_relaxed);
     }
-    return static_cast<uint16_t>(replacementSeq);
 }
 
 void AudioCollection::RemoveFromShufflePool(SequenceInfo* seqInfo) {
@@ -432,6 +437,10 @@ extern "C" void AudioCollection_AddToCollection(char* otrPath, uint16_t seqNum)
     AudioCollection::Instance->AddToCollection(otrPath, seqNum);
 }
 
+extern "C" void AudioCollection_RebuildReplacementTable(void) {
+    AudioCollection::Instance->RebuildReplacementTable();
+}
+
 bool AudioCollection::HasSequenceNum(uint16_t seqId) {
     return sequenceMap.contains(seqId);
 }
@@ -1,5 +1,7 @@
 #pragma once
 #ifdef __cplusplus
+#include <array>
+#include <atomic>
 #include <map>
 #include <string>
 #include <set>
@@ -45,10 +47,13 @@ class AudioCollection {
     std::set<SequenceInfo*, compareSequenceLabel> excludedSequences;
     bool shufflePoolInitialized = false;
 
+    // Replacement of every sequence id, read by the audio thread without locking
+    std::array<std::atomic<uint16_t>, 0x10000> replacementTable;
+
   public:
     static AudioCollection* Instance;
     AudioCollection();
-    std::map<uint16_t, SequenceInfo> GetAllSequences() const {
+    const std::map<uint16_t, SequenceInfo>& GetAllSequences() const {
         return sequenceMap;
     }
     std::set<SequenceInfo*, compareSequenceLabel> GetIncludedSequences() const {
@@ -61,15 +66,18 @@ class AudioCollection {
     void RemoveFromShufflePool(SequenceInfo*);
     void AddToCollection(char* otrPath, uint16_t seqNum);
     uint16_t GetReplacementSequence(uint16_t seqId);
+    // Recomputes the replacement table from the ReplacedSequences CVars, must be called whenever they change
+    void RebuildReplacementTable();
     void InitializeShufflePool();
     const char* GetSequenceName(uint16_t seqId);
     bool HasSequenceNum(uint16_t seqId);
     size_t SequenceMapSize();
-    std::string GetCvarKey(std::string sfxKey);
-    std::string GetCvarLockKey(std::string sfxKey);
+    std::string GetCvarKey(const std::string& sfxKey);
+    std::string GetCvarLockKey(const std::string& sfxKey);
 };
 #else
 void AudioCollection_AddToCollection(char* otrPath, uint16_t seqNum);
+void AudioCollection_RebuildReplacementTable(void);
 const char* AudioCollection_GetSequenceName(uint16_t seqId);
 bool AudioCollection_HasSequenceNum(uint16_t seqId);
 size_t AudioCollection_SequenceMapSize();
@@ -137,6 +137,7 @@ void RandomizeGroup(SeqType type) {
             values.pop_back();
         }
     }
+    AudioCollection::Instance->RebuildReplacementTable();
 }
 
 void ResetGroup(const std::map<u16, SequenceInfo>& map, SeqType type) {
@@ -153,6 +154,7 @@ void ResetGroup(const std::map<u16, SequenceInfo>& map, SeqType type) {
             }
         }
     }
+    AudioCollection::Instance->RebuildReplacementTable();
 }
 
 void LockGroup(const std::map<u16, SequenceInfo>& map, SeqType type) {
@@ -335,6 +337,7 @@ void Draw_SfxTab(const std::string& tabId, SeqType type, const std::string& tabN
 
                 if (ImGui::Selectable(seqData.label.c_str())) {
                     CVarSetInteger(cvarKey.c_str(), value);
+                    AudioCollection::Instance->RebuildReplacementTable();
                     Ship::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesNextFrame();
                     UpdateCurrentBGM(defaultValue, type);
                 }
@@ -362,6 +365,7 @@ void Draw_SfxTab(const std::string& tabId, SeqType type, const std::string& tabN
                                                        .Color(THEME_COLOR))) {
             CVarClear(cvarKey.c_str());
             CVarClear(cvarLockKey.c_str());
+            AudioCollection::Instance->RebuildReplacementTable();
             Ship::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesNextFrame();
             UpdateCurrentBGM(defaultValue, seqData.category);
         }
@@ -386,6 +390,7 @@ void Draw_SfxTab(const std::string& tabId, SeqType type, const std::string& tabN
                 if (locked) {
                     CVarClear(cvarLockKey.c_str());
                 }
+                AudioCollection::Instance->RebuildReplacementTable();
                 Ship::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesNextFrame();
                 UpdateCurrentBGM(defaultValue, type);
             }
@@ -4,6 +4,7 @@
 #include "soh/Enhancements/game-interactor/GameInteractor.h"
 
 #include <string>
+#include <cstring>
 #include <libultraship/bridge.h>
 #include <math.h>
 #include <libultraship/libultraship.h>
@@ -13,6 +14,8 @@
 #include "soh/SohGui/SohGui.hpp"
 #include "soh/OTRGlobals.h"
 #include "soh/ResourceManagerHelpers.h"
+#include "soh/Enhancements/debugger/frameProfiler.h"
+#include "soh/CVarHandle.h"
 
 extern "C" {
 #include "z64.h"
@@ -61,12 +64,79 @@ namespace SohGui {
 extern std::shared_ptr<SohMenu> mSohMenu;
 }
 
-#define PATCH_GFX(path, name, cvar, index, instruction)             \
-    if (CVarGetInteger(cvar, 0)) {                                  \
-        ResourceMgr_PatchGfxByName(path, name, index, instruction); \
-    } else {                                                        \
-        ResourceMgr_UnpatchGfxByName(path, name);                   \
+// A single patched display list instruction. The instruction is resolved the first time the patch is applied and the
+// display list is only written when the patched instruction changes, so re-applying the same color every frame is
+// just a compare.
+struct CosmeticGfxPatch {
+    const char* path;
+    const char* name;
+    int index;
+    std::shared_ptr<Ship::IResource> resource;
+    Gfx* gfx = nullptr;
+    Gfx original;
+    Gfx current;
+    bool resolved = false;
+    bool patched = false;
+
+    CosmeticGfxPatch(const char* path, const char* name, int index);
+    void Apply(bool enabled, Gfx instruction);
+    void Invalidate();
+};
+
+// Every patch site that has run, so they can be re-resolved when the display lists are reloaded
+static std::vector<CosmeticGfxPatch*> sGfxPatches;
+
+CosmeticGfxPatch::CosmeticGfxPatch(const char* path, const char* name, int index)
+    : path(path), name(name), index(index) {
+    sGfxPatches.push_back(this);
+}
+
+void CosmeticGfxPatch::Apply(bool enabled, Gfx instruction) {
+    if (!enabled && !patched) {
+        return;
+    }
+
+    if (!resolved) {
+        gfx = ResourceMgr_GetGfxPatchSlotByName(path, index, resource);
+        if (gfx != nullptr) {
+            original = *gfx;
+        }
+        resolved = true;
+    }
+    if (gfx == nullptr) {
+        return;
+    }
+
+    if (!enabled) {
+        *gfx = original;
+        patched = false;
+    } else if (!patched || memcmp(&current, &instruction, sizeof(Gfx)) != 0) {
+        *gfx = instruction;
+        current = instruction;
+        patched = true;
     }
+}
+
+// Restores the original instruction and forgets the resolved display list, the next Apply loads it again
+void CosmeticGfxPatch::Invalidate() {
+    if (patched) {
+        *gfx = original;
+        patched = false;
+    }
+    resource = nullptr;
+    gfx = nullptr;
+    resolved = false;
+}
+
+// Each expansion owns its patch, so the name only has to be unique for readability and debugging
+#define PATCH_GFX_IF(path, name, enabled, index, instruction)     \
+    do {                                                          \
+        static CosmeticGfxPatch patch(path, name, index);         \
+        patch.Apply(enabled, instruction);                        \
+    } while (0)
+
+#define PATCH_GFX(path, name, cvar, index, instruction) \
+    PATCH_GFX_IF(path, name, CVarGetInteger(cvar, 0), index, instruction)
 
 // This is used for the greg bridge
 #define dgEndGrayscaleAndEndDlistDL "__OTR__helpers/cosmetics/gEndGrayscaleAndEndDlistDL"
@@ -109,6 +179,9 @@ typedef struct {
     bool supportsAlpha;
     bool supportsRainbow;
     bool advancedOption;
+    // Set by CosmeticsUpdateTick, lets the patches use the rainbow color without reading it back from the CVar
+    bool rainbowActive = false;
+    Color_RGBA8 rainbowColor = { 0, 0, 0, 0 };
 } CosmeticOption;
 
 Color_RGBA8 ColorRGBA8(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
@@ -498,6 +571,7 @@ void SetMarginAll(const char* ButtonName, bool SetActivated, const char* tooltip
                 CVarSetInteger(cvarNameMargins.c_str(), SetActivated);
             }
         }
+        CVarHandle_Invalidate();
     }
 }
 
@@ -513,6 +587,7 @@ void ResetPositionAll() {
             CVarSetInteger(cvarPosType.c_str(), 0);
             CVarSetInteger(cvarNameMargins.c_str(), false); // Turn margin off to everythings as that original position.
         }
+        CVarHandle_Invalidate();
     }
 }
 
@@ -521,11 +596,14 @@ int hue = 0;
 // Runs every frame to update rainbow hue, a potential future optimization is to only run this a once or twice a second
 // and increase the speed of the rainbow hue rotation.
 void CosmeticsUpdateTick() {
+    FRAME_PROFILER_SCOPE("CosmeticsUpdateTick");
     int index = 0;
     float rainbowSpeed = CVarGetFloat(CVAR_COSMETIC("RainbowSpeed"), 0.6f);
+    bool rainbowSync = CVarGetInteger(CVAR_COSMETIC("RainbowSync"), 0);
+    double frequency = 2 * M_PI / (360 * rainbowSpeed);
     for (auto& [id, cosmeticOption] : cosmeticOptions) {
-        if (cosmeticOption.supportsRainbow && CVarGetInteger(cosmeticOption.rainbowCvar, 0)) {
-            double frequency = 2 * M_PI / (360 * rainbowSpeed);
+        cosmeticOption.rainbowActive = cosmeticOption.supportsRainbow && CVarGetInteger(cosmeticOption.rainbowCvar, 0);
+        if (cosmeticOption.rainbowActive) {
             Color_RGBA8 newColor;
             newColor.r = static_cast<uint8_t>(sin(frequency * (hue + index) + 0) * 127) + 128;
             newColor.g = static_cast<uint8_t>(sin(frequency * (hue + index) + (2 * M_PI / 3)) * 127) + 128;
@@ -541,12 +619,18 @@ void CosmeticsUpdateTick() {
             cosmeticOption.currentColor.z = newColor.b / 255.0f;
             cosmeticOption.currentColor.w = newColor.a / 255.0f;
 
-            CVarSetColor(cosmeticOption.valuesCvar, newColor);
+            // Gameplay code reads these colors straight from the CVar, so it still has to be written when it changes
+            if (memcmp(&newColor, &cosmeticOption.rainbowColor, sizeof(Color_RGBA8)) != 0) {
+                cosmeticOption.rainbowColor = newColor;
+                CVarSetColor(cosmeticOption.valuesCvar, newColor);
+            }
+        } else {
+            cosmeticOption.rainbowColor = { 0, 0, 0, 0 };
         }
         // If we don't want the rainbow color on items to be synced, offset the index for each item in the loop.
         // Technically this would work if you replaced "60" with 1 but the hue would be so close it's
         // indistinguishable, 60 gives us a big enough gap to notice the difference.
-        if (!CVarGetInteger(CVAR_COSMETIC("RainbowSync"), 0)) {
+        if (!rainbowSync) {
             index += static_cast<int>(60 * rainbowSpeed);
         }
     }
@@ -557,22 +641,34 @@ void CosmeticsUpdateTick() {
     }
 }
 
+// The color an option's patches use, rainbow colors come straight from CosmeticsUpdateTick
+static Color_RGBA8 GetPatchColor(const CosmeticOption& option) {
+    if (option.rainbowActive) {
+        return option.rainbowColor;
+    }
+    return CVarGetColor(option.valuesCvar, option.defaultColor);
+}
+
 /*
     This is called every time a color is changed in the UI, and every frame to update colors that have rainbow mode
    enabled The columns/arguments for PATCH_GFX are as follows:
     1. Display List: This should be a valid display list pointer, if you have errors listing one here make sure to
    include the appropriate header file up top
-    2. Patch Name: Each of these MUST be unique, used for restoring the original DList command, if these are not unique
-   bugs WILL happen
+    2. Patch Name: Each of these should be unique, they identify the patch when debugging. The original DList command
+   is kept by the patch site itself
     3. Changed Cvar: What determines if a patch should be applied or reset.
     4. GFX Command Index: Index of the GFX command you want to replace, the instructions on finding this are in the
    giant comment block above the cosmeticOptions map
     5. GFX Command: The GFX command you want to insert
 */
 void ApplyOrResetCustomGfxPatches(bool manualChange) {
+    // Manual changes come from the editor, which sets and clears the .Changed CVars the HUD reads through handles
+    if (manualChange) {
+        CVarHandle_Invalidate();
+    }
     static CosmeticOption& magicFaroresPrimary = cosmeticOptions.at("Magic.FaroresPrimary");
-    if (manualChange || CVarGetInteger(magicFaroresPrimary.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(magicFaroresPrimary.valuesCvar, magicFaroresPrimary.defaultColor);
+    if (manualChange || magicFaroresPrimary.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(magicFaroresPrimary);
         PATCH_GFX(sInnerCylinderDL, "Magic_FaroresPrimary1", magicFaroresPrimary.changedCvar, 24,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(sOuterCylinderDL, "Magic_FaroresPrimary2", magicFaroresPrimary.changedCvar, 24,
@@ -580,8 +676,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& magicFaroresSecondary = cosmeticOptions.at("Magic.FaroresSecondary");
-    if (manualChange || CVarGetInteger(magicFaroresSecondary.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(magicFaroresSecondary.valuesCvar, magicFaroresSecondary.defaultColor);
+    if (manualChange || magicFaroresSecondary.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(magicFaroresSecondary);
         PATCH_GFX(sInnerCylinderDL, "Magic_FaroresSecondary1", magicFaroresSecondary.changedCvar, 25,
                   gsDPSetEnvColor(color.r, color.g, color.b, 255));
         PATCH_GFX(sOuterCylinderDL, "Magic_FaroresSecondary2", magicFaroresSecondary.changedCvar, 25,
@@ -589,8 +685,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& linkGoronTunic = cosmeticOptions.at("Link.GoronTunic");
-    if (manualChange || CVarGetInteger(linkGoronTunic.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(linkGoronTunic.valuesCvar, linkGoronTunic.defaultColor);
+    if (manualChange || linkGoronTunic.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(linkGoronTunic);
         PATCH_GFX(gGiGoronTunicColorDL, "Link_GoronTunic1", linkGoronTunic.changedCvar, 3,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiGoronCollarColorDL, "Link_GoronTunic2", linkGoronTunic.changedCvar, 3,
@@ -602,8 +698,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& linkZoraTunic = cosmeticOptions.at("Link.ZoraTunic");
-    if (manualChange || CVarGetInteger(linkZoraTunic.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(linkZoraTunic.valuesCvar, linkZoraTunic.defaultColor);
+    if (manualChange || linkZoraTunic.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(linkZoraTunic);
         PATCH_GFX(gGiZoraTunicColorDL, "Link_ZoraTunic1", linkZoraTunic.changedCvar, 3,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiZoraCollarColorDL, "Link_ZoraTunic2", linkZoraTunic.changedCvar, 3,
@@ -615,8 +711,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& linkHair = cosmeticOptions.at("Link.Hair");
-    if (manualChange || CVarGetInteger(linkHair.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(linkHair.valuesCvar, linkHair.defaultColor);
+    if (manualChange || linkHair.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(linkHair);
         PATCH_GFX(gLinkChildHeadNearDL, "Link_Hair1", linkHair.changedCvar, 10,
                   gsDPSetGrayscaleColor(color.r, color.g, color.b, 255));
         PATCH_GFX(gLinkChildHeadFarDL, "Link_Hair2", linkHair.changedCvar, 10,
@@ -641,8 +737,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& linkLinen = cosmeticOptions.at("Link.Linen");
-    if (manualChange || CVarGetInteger(linkLinen.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(linkLinen.valuesCvar, linkLinen.defaultColor);
+    if (manualChange || linkLinen.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(linkLinen);
         PATCH_GFX(gLinkAdultLeftArmNearDL, "Link_Linen1", linkLinen.changedCvar, 30,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gLinkAdultLeftArmNearDL, "Link_Linen2", linkLinen.changedCvar, 83,
@@ -715,8 +811,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& linkBoots = cosmeticOptions.at("Link.Boots");
-    if (manualChange || CVarGetInteger(linkBoots.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(linkBoots.valuesCvar, linkBoots.defaultColor);
+    if (manualChange || linkBoots.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(linkBoots);
         PATCH_GFX(gLinkChildRightShinNearDL, "Link_Boots1", linkBoots.changedCvar, 10,
                   gsDPSetGrayscaleColor(color.r, color.g, color.b, 255));
         PATCH_GFX(gLinkChildRightShinFarDL, "Link_Boots2", linkBoots.changedCvar, 10,
@@ -755,8 +851,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& mirrorShieldBody = cosmeticOptions.at("MirrorShield.Body");
-    if (manualChange || CVarGetInteger(mirrorShieldBody.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(mirrorShieldBody.valuesCvar, mirrorShieldBody.defaultColor);
+    if (manualChange || mirrorShieldBody.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(mirrorShieldBody);
         PATCH_GFX(gGiMirrorShieldDL, "MirrorShield_Body1", mirrorShieldBody.changedCvar, 5,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiMirrorShieldDL, "MirrorShield_Body2", mirrorShieldBody.changedCvar, 6,
@@ -775,8 +871,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& mirrorShieldMirror = cosmeticOptions.at("MirrorShield.Mirror");
-    if (manualChange || CVarGetInteger(mirrorShieldMirror.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(mirrorShieldMirror.valuesCvar, mirrorShieldMirror.defaultColor);
+    if (manualChange || mirrorShieldMirror.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(mirrorShieldMirror);
         PATCH_GFX(gGiMirrorShieldDL, "MirrorShield_Mirror1", mirrorShieldMirror.changedCvar, 47,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiMirrorShieldDL, "MirrorShield_Mirror2", mirrorShieldMirror.changedCvar, 48,
@@ -795,8 +891,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   111, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& mirrorShieldEmblem = cosmeticOptions.at("MirrorShield.Emblem");
-    if (manualChange || CVarGetInteger(mirrorShieldEmblem.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(mirrorShieldEmblem.valuesCvar, mirrorShieldEmblem.defaultColor);
+    if (manualChange || mirrorShieldEmblem.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(mirrorShieldEmblem);
         PATCH_GFX(gGiMirrorShieldSymbolDL, "MirrorShield_Emblem1", mirrorShieldEmblem.changedCvar, 5,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 140));
         PATCH_GFX(gGiMirrorShieldSymbolDL, "MirrorShield_Emblem2", mirrorShieldEmblem.changedCvar, 6,
@@ -816,8 +912,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& swordsKokiriBlade = cosmeticOptions.at("Swords.KokiriBlade");
-    if (manualChange || CVarGetInteger(swordsKokiriBlade.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(swordsKokiriBlade.valuesCvar, swordsKokiriBlade.defaultColor);
+    if (manualChange || swordsKokiriBlade.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(swordsKokiriBlade);
         PATCH_GFX(gLinkChildLeftFistAndKokiriSwordNearDL, "Swords_KokiriBlade1", swordsKokiriBlade.changedCvar, 79,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gLinkChildLeftFistAndKokiriSwordFarDL, "Swords_KokiriBlade2", swordsKokiriBlade.changedCvar, 75,
@@ -829,8 +925,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
     /*
     static CosmeticOption& swordsKokiriHilt = cosmeticOptions.at("Swords.KokiriHilt");
-    if (manualChange || CVarGetInteger(swordsKokiriHilt.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(swordsKokiriHilt.valuesCvar, swordsKokiriHilt.defaultColor);
+    if (manualChange || swordsKokiriHilt.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(swordsKokiriHilt);
         PATCH_GFX(gLinkChildLeftFistAndKokiriSwordNearDL,         "Swords_KokiriHilt1", swordsKokiriHilt.changedCvar, 4,
     gsDPSetGrayscaleColor(color.r, color.g, color.b, 255)); PATCH_GFX(gLinkChildLeftFistAndKokiriSwordFarDL,
     "Swords_KokiriHilt2",       swordsKokiriHilt.changedCvar,         4, gsDPSetGrayscaleColor(color.r, color.g,
@@ -886,8 +982,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
     */
     static CosmeticOption& swordsMasterBlade = cosmeticOptions.at("Swords.MasterBlade");
-    if (manualChange || CVarGetInteger(swordsMasterBlade.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(swordsMasterBlade.valuesCvar, swordsMasterBlade.defaultColor);
+    if (manualChange || swordsMasterBlade.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(swordsMasterBlade);
         PATCH_GFX(gLinkAdultLeftHandHoldingMasterSwordFarDL, "Swords_MasterBlade1", swordsMasterBlade.changedCvar, 60,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gLinkAdultLeftHandHoldingMasterSwordNearDL, "Swords_MasterBlade2", swordsMasterBlade.changedCvar, 17,
@@ -903,8 +999,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
     /*
     static CosmeticOption& swordsMasterHilt = cosmeticOptions.at("Swords.MasterHilt");
-    if (manualChange || CVarGetInteger(swordsMasterHilt.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(swordsMasterHilt.valuesCvar, swordsMasterHilt.defaultColor);
+    if (manualChange || swordsMasterHilt.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(swordsMasterHilt);
         PATCH_GFX(gLinkAdultLeftHandHoldingMasterSwordNearDL,     "Swords_MasterHilt1", swordsMasterHilt.changedCvar,
     20, gsDPSetGrayscaleColor(color.r, color.g, color.b, 255)); PATCH_GFX(gLinkAdultLeftHandHoldingMasterSwordFarDL,
     "Swords_MasterHilt2",       swordsMasterHilt.changedCvar,        20, gsDPSetGrayscaleColor(color.r, color.g,
@@ -967,8 +1063,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
     */
     static CosmeticOption& swordsBiggoronBlade = cosmeticOptions.at("Swords.BiggoronBlade");
-    if (manualChange || CVarGetInteger(swordsBiggoronBlade.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(swordsBiggoronBlade.valuesCvar, swordsBiggoronBlade.defaultColor);
+    if (manualChange || swordsBiggoronBlade.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(swordsBiggoronBlade);
         PATCH_GFX(gLinkAdultLeftHandHoldingBgsFarDL, "Swords_BiggoronBlade1", swordsBiggoronBlade.changedCvar, 108,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gLinkAdultLeftHandHoldingBgsNearDL, "Swords_BiggoronBlade2", swordsBiggoronBlade.changedCvar, 63,
@@ -980,8 +1076,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
     /*
     static CosmeticOption& swordsBiggoronHilt = cosmeticOptions.at("Swords.BiggoronHilt");
-    if (manualChange || CVarGetInteger(swordsBiggoronHilt.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(swordsBiggoronHilt.valuesCvar, swordsBiggoronHilt.defaultColor);
+    if (manualChange || swordsBiggoronHilt.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(swordsBiggoronHilt);
         PATCH_GFX(gLinkAdultLeftHandHoldingBgsNearDL,             "Swords_BiggoronHilt1",
     swordsBiggoronHilt.changedCvar,      20, gsDPSetGrayscaleColor(color.r, color.g, color.b, 255));
         PATCH_GFX(gLinkAdultLeftHandHoldingBgsFarDL,              "Swords_BiggoronHilt2",
@@ -1008,8 +1104,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
     */
     static CosmeticOption& glovesGoronBracelet = cosmeticOptions.at("Gloves.GoronBracelet");
-    if (manualChange || CVarGetInteger(glovesGoronBracelet.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(glovesGoronBracelet.valuesCvar, glovesGoronBracelet.defaultColor);
+    if (manualChange || glovesGoronBracelet.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(glovesGoronBracelet);
         PATCH_GFX(gGiGoronBraceletDL, "Gloves_GoronBracelet1", glovesGoronBracelet.changedCvar, 5,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiGoronBraceletDL, "Gloves_GoronBracelet2", glovesGoronBracelet.changedCvar, 6,
@@ -1025,24 +1121,24 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         }
     }
     static CosmeticOption& glovesSilverGauntlets = cosmeticOptions.at("Gloves.SilverGauntlets");
-    if (manualChange || CVarGetInteger(glovesSilverGauntlets.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(glovesSilverGauntlets.valuesCvar, glovesSilverGauntlets.defaultColor);
+    if (manualChange || glovesSilverGauntlets.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(glovesSilverGauntlets);
         PATCH_GFX(gGiSilverGauntletsColorDL, "Gloves_SilverGauntlets1", glovesSilverGauntlets.changedCvar, 3,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiSilverGauntletsColorDL, "Gloves_SilverGauntlets2", glovesSilverGauntlets.changedCvar, 4,
                   gsDPSetEnvColor(color.r / 3, color.g / 3, color.b / 3, 255));
     }
     static CosmeticOption& glovesGoldenGauntlets = cosmeticOptions.at("Gloves.GoldenGauntlets");
-    if (manualChange || CVarGetInteger(glovesGoldenGauntlets.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(glovesGoldenGauntlets.valuesCvar, glovesGoldenGauntlets.defaultColor);
+    if (manualChange || glovesGoldenGauntlets.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(glovesGoldenGauntlets);
         PATCH_GFX(gGiGoldenGauntletsColorDL, "Gloves_GoldenGauntlets1", glovesGoldenGauntlets.changedCvar, 3,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiGoldenGauntletsColorDL, "Gloves_GoldenGauntlets2", glovesGoldenGauntlets.changedCvar, 4,
                   gsDPSetEnvColor(color.r / 3, color.g / 3, color.b / 3, 255));
     }
     static CosmeticOption& glovesGauntletsGem = cosmeticOptions.at("Gloves.GauntletsGem");
-    if (manualChange || CVarGetInteger(glovesGauntletsGem.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(glovesGauntletsGem.valuesCvar, glovesGauntletsGem.defaultColor);
+    if (manualChange || glovesGauntletsGem.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(glovesGauntletsGem);
         PATCH_GFX(gGiGauntletsDL, "Gloves_GauntletsGem1", glovesGauntletsGem.changedCvar, 84,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiGauntletsDL, "Gloves_GauntletsGem2", glovesGauntletsGem.changedCvar, 85,
@@ -1058,8 +1154,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& equipmentBoomerangBody = cosmeticOptions.at("Equipment.BoomerangBody");
-    if (manualChange || CVarGetInteger(equipmentBoomerangBody.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentBoomerangBody.valuesCvar, equipmentBoomerangBody.defaultColor);
+    if (manualChange || equipmentBoomerangBody.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentBoomerangBody);
         PATCH_GFX(gGiBoomerangDL, "Equipment_BoomerangBody1", equipmentBoomerangBody.changedCvar, 5,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiBoomerangDL, "Equipment_BoomerangBody2", equipmentBoomerangBody.changedCvar, 6,
@@ -1072,8 +1168,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& equipmentBoomerangGem = cosmeticOptions.at("Equipment.BoomerangGem");
-    if (manualChange || CVarGetInteger(equipmentBoomerangGem.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentBoomerangGem.valuesCvar, equipmentBoomerangGem.defaultColor);
+    if (manualChange || equipmentBoomerangGem.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentBoomerangGem);
         PATCH_GFX(gGiBoomerangDL, "Equipment_BoomerangGem1", equipmentBoomerangGem.changedCvar, 84,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiBoomerangDL, "Equipment_BoomerangGem2", equipmentBoomerangGem.changedCvar, 85,
@@ -1088,8 +1184,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
     /*
     static CosmeticOption& equipmentSlingshotBody = cosmeticOptions.at("Equipment.SlingshotBody");
-    if (manualChange || CVarGetInteger(equipmentSlingshotBody.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentSlingshotBody.valuesCvar, equipmentSlingshotBody.defaultColor);
+    if (manualChange || equipmentSlingshotBody.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentSlingshotBody);
         PATCH_GFX(gGiSlingshotDL,                                 "Equipment_SlingshotBody1",
     equipmentSlingshotBody.changedCvar,  10, gsDPSetPrimColor(0, 0, MAX(color.r - 100, 0), MAX(color.g - 100, 0),
     MAX(color.b - 100, 0), 255)); PATCH_GFX(gGiSlingshotDL,                                 "Equipment_SlingshotBody2",
@@ -1128,8 +1224,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
     */
     static CosmeticOption& equipmentSlingshotString = cosmeticOptions.at("Equipment.SlingshotString");
-    if (manualChange || CVarGetInteger(equipmentSlingshotString.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentSlingshotString.valuesCvar, equipmentSlingshotString.defaultColor);
+    if (manualChange || equipmentSlingshotString.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentSlingshotString);
         PATCH_GFX(gGiSlingshotDL, "Equipment_SlingshotString1", equipmentSlingshotString.changedCvar, 75,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiSlingshotDL, "Equipment_SlingshotString2", equipmentSlingshotString.changedCvar, 76,
@@ -1139,8 +1235,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& equipmentBowTips = cosmeticOptions.at("Equipment.BowTips");
-    if (manualChange || CVarGetInteger(equipmentBowTips.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentBowTips.valuesCvar, equipmentBowTips.defaultColor);
+    if (manualChange || equipmentBowTips.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentBowTips);
         PATCH_GFX(gGiBowDL, "Equipment_BowTips1", equipmentBowTips.changedCvar, 86,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiBowDL, "Equipment_BowTips2", equipmentBowTips.changedCvar, 87,
@@ -1153,8 +1249,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& equipmentBowString = cosmeticOptions.at("Equipment.BowString");
-    if (manualChange || CVarGetInteger(equipmentBowString.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentBowString.valuesCvar, equipmentBowString.defaultColor);
+    if (manualChange || equipmentBowString.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentBowString);
         PATCH_GFX(gGiBowDL, "Equipment_BowString1", equipmentBowString.changedCvar, 105,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiBowDL, "Equipment_BowString2", equipmentBowString.changedCvar, 106,
@@ -1163,8 +1259,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& equipmentBowBody = cosmeticOptions.at("Equipment.BowBody");
-    if (manualChange || CVarGetInteger(equipmentBowBody.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentBowBody.valuesCvar, equipmentBowBody.defaultColor);
+    if (manualChange || equipmentBowBody.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentBowBody);
         PATCH_GFX(gGiBowDL, "Equipment_BowBody1", equipmentBowBody.changedCvar, 5,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiBowDL, "Equipment_BowBody2", equipmentBowBody.changedCvar, 6,
@@ -1177,8 +1273,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& equipmentBowHandle = cosmeticOptions.at("Equipment.BowHandle");
-    if (manualChange || CVarGetInteger(equipmentBowHandle.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentBowHandle.valuesCvar, equipmentBowHandle.defaultColor);
+    if (manualChange || equipmentBowHandle.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentBowHandle);
         PATCH_GFX(gGiBowDL, "Equipment_BowHandle1", equipmentBowHandle.changedCvar, 51,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiBowDL, "Equipment_BowHandle2", equipmentBowHandle.changedCvar, 52,
@@ -1192,8 +1288,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& equipmentHammerHead = cosmeticOptions.at("Equipment.HammerHead");
-    if (manualChange || CVarGetInteger(equipmentHammerHead.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentHammerHead.valuesCvar, equipmentHammerHead.defaultColor);
+    if (manualChange || equipmentHammerHead.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentHammerHead);
         PATCH_GFX(gGiHammerDL, "Equipment_HammerHead1", equipmentHammerHead.changedCvar, 5,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiHammerDL, "Equipment_HammerHead2", equipmentHammerHead.changedCvar, 6,
@@ -1208,8 +1304,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& equipmentHammerHandle = cosmeticOptions.at("Equipment.HammerHandle");
-    if (manualChange || CVarGetInteger(equipmentHammerHandle.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentHammerHandle.valuesCvar, equipmentHammerHandle.defaultColor);
+    if (manualChange || equipmentHammerHandle.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentHammerHandle);
         PATCH_GFX(gGiHammerDL, "Equipment_HammerHandle1", equipmentHammerHandle.changedCvar, 84,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiHammerDL, "Equipment_HammerHandle2", equipmentHammerHandle.changedCvar, 85,
@@ -1221,15 +1317,15 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& equipmentHookshotChain = cosmeticOptions.at("Equipment.HookshotChain");
-    if (manualChange || CVarGetInteger(equipmentHookshotChain.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentHookshotChain.valuesCvar, equipmentHookshotChain.defaultColor);
+    if (manualChange || equipmentHookshotChain.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentHookshotChain);
         PATCH_GFX(gLinkAdultHookshotChainDL, "Equipment_HookshotChain1", equipmentHookshotChain.changedCvar, 17,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
 
     static CosmeticOption& equipmentChuFace = cosmeticOptions.at("Equipment.ChuFace");
-    if (manualChange || CVarGetInteger(equipmentChuFace.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentChuFace.valuesCvar, equipmentChuFace.defaultColor);
+    if (manualChange || equipmentChuFace.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentChuFace);
         PATCH_GFX(gGiBombchuDL, "Equipment_ChuFace1", equipmentChuFace.changedCvar, 5,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiBombchuDL, "Equipment_ChuFace2", equipmentChuFace.changedCvar, 6,
@@ -1243,8 +1339,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         }
     }
     static CosmeticOption& equipmentChuBody = cosmeticOptions.at("Equipment.ChuBody");
-    if (manualChange || CVarGetInteger(equipmentChuBody.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentChuBody.valuesCvar, equipmentChuBody.defaultColor);
+    if (manualChange || equipmentChuBody.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentChuBody);
         PATCH_GFX(gGiBombchuDL, "Equipment_ChuBody1", equipmentChuBody.changedCvar, 39,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiBombchuDL, "Equipment_ChuBody2", equipmentChuBody.changedCvar, 40,
@@ -1258,8 +1354,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& equipmentBunnyHood = cosmeticOptions.at("Equipment.BunnyHood");
-    if (manualChange || CVarGetInteger(equipmentBunnyHood.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(equipmentBunnyHood.valuesCvar, equipmentBunnyHood.defaultColor);
+    if (manualChange || equipmentBunnyHood.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(equipmentBunnyHood);
         PATCH_GFX(gGiBunnyHoodDL, "Equipment_BunnyHood1", equipmentBunnyHood.changedCvar, 5,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiBunnyHoodDL, "Equipment_BunnyHood2", equipmentBunnyHood.changedCvar, 6,
@@ -1274,18 +1370,14 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         if (manualChange) {
             PATCH_GFX(gLinkChildBunnyHoodDL, "Equipment_BunnyHood6", equipmentBunnyHood.changedCvar, 13,
                       gsSPGrayscale(true));
-            if (CVarGetInteger(equipmentBunnyHood.changedCvar, 0)) {
-                ResourceMgr_PatchGfxByName(gLinkChildBunnyHoodDL, "Equipment_BunnyHood7", 125,
-                                           gsSPBranchListOTRFilePath(gEndGrayscaleAndEndDlistDL));
-            } else {
-                ResourceMgr_UnpatchGfxByName(gLinkChildBunnyHoodDL, "Equipment_BunnyHood7");
-            }
+            PATCH_GFX(gLinkChildBunnyHoodDL, "Equipment_BunnyHood7", equipmentBunnyHood.changedCvar, 125,
+                      gsSPBranchListOTRFilePath(gEndGrayscaleAndEndDlistDL));
         }
     }
 
     static CosmeticOption& consumableGreenRupee = cosmeticOptions.at("Consumable.GreenRupee");
-    if (manualChange || CVarGetInteger(consumableGreenRupee.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(consumableGreenRupee.valuesCvar, consumableGreenRupee.defaultColor);
+    if (manualChange || consumableGreenRupee.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(consumableGreenRupee);
         PATCH_GFX(gGiGreenRupeeInnerColorDL, "Consumable_GreenRupee1", consumableGreenRupee.changedCvar, 3,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiGreenRupeeInnerColorDL, "Consumable_GreenRupee2", consumableGreenRupee.changedCvar, 4,
@@ -1297,21 +1389,16 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   gsDPSetEnvColor(color.r * 0.75f, color.g * 0.75f, color.b * 0.75f, 255));
 
         // Greg Bridge
-        if (Randomizer_GetSettingValue(RSK_RAINBOW_BRIDGE) == RO_BRIDGE_GREG) {
-            ResourceMgr_PatchGfxByName(gRainbowBridgeDL, "RainbowBridge_StartGrayscale", 2, gsSPGrayscale(true));
-            ResourceMgr_PatchGfxByName(gRainbowBridgeDL, "RainbowBridge_MakeGreen", 10,
-                                       gsDPSetGrayscaleColor(color.r, color.g, color.b, color.a));
-            ResourceMgr_PatchGfxByName(gRainbowBridgeDL, "RainbowBridge_EndGrayscaleAndEndDlist", 79,
-                                       gsSPBranchListOTRFilePath(gEndGrayscaleAndEndDlistDL));
-        } else {
-            ResourceMgr_UnpatchGfxByName(gRainbowBridgeDL, "RainbowBridge_StartGrayscale");
-            ResourceMgr_UnpatchGfxByName(gRainbowBridgeDL, "RainbowBridge_MakeGreen");
-            ResourceMgr_UnpatchGfxByName(gRainbowBridgeDL, "RainbowBridge_EndGrayscaleAndEndDlist");
-        }
+        bool gregBridge = Randomizer_GetSettingValue(RSK_RAINBOW_BRIDGE) == RO_BRIDGE_GREG;
+        PATCH_GFX_IF(gRainbowBridgeDL, "RainbowBridge_StartGrayscale", gregBridge, 2, gsSPGrayscale(true));
+        PATCH_GFX_IF(gRainbowBridgeDL, "RainbowBridge_MakeGreen", gregBridge, 10,
+                     gsDPSetGrayscaleColor(color.r, color.g, color.b, color.a));
+        PATCH_GFX_IF(gRainbowBridgeDL, "RainbowBridge_EndGrayscaleAndEndDlist", gregBridge, 79,
+                     gsSPBranchListOTRFilePath(gEndGrayscaleAndEndDlistDL));
     }
     static CosmeticOption& consumableBlueRupee = cosmeticOptions.at("Consumable.BlueRupee");
-    if (manualChange || CVarGetInteger(consumableBlueRupee.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(consumableBlueRupee.valuesCvar, consumableBlueRupee.defaultColor);
+    if (manualChange || consumableBlueRupee.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(consumableBlueRupee);
         PATCH_GFX(gGiBlueRupeeInnerColorDL, "Consumable_BlueRupee1", consumableBlueRupee.changedCvar, 3,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiBlueRupeeInnerColorDL, "Consumable_BlueRupee2", consumableBlueRupee.changedCvar, 4,
@@ -1323,8 +1410,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   gsDPSetEnvColor(color.r * 0.75f, color.g * 0.75f, color.b * 0.75f, 255));
     }
     static CosmeticOption& consumableRedRupee = cosmeticOptions.at("Consumable.RedRupee");
-    if (manualChange || CVarGetInteger(consumableRedRupee.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(consumableRedRupee.valuesCvar, consumableRedRupee.defaultColor);
+    if (manualChange || consumableRedRupee.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(consumableRedRupee);
         PATCH_GFX(gGiRedRupeeInnerColorDL, "Consumable_RedRupee1", consumableRedRupee.changedCvar, 3,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiRedRupeeInnerColorDL, "Consumable_RedRupee2", consumableRedRupee.changedCvar, 4,
@@ -1336,8 +1423,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   gsDPSetEnvColor(color.r * 0.75f, color.g * 0.75f, color.b * 0.75f, 255));
     }
     static CosmeticOption& consumablePurpleRupee = cosmeticOptions.at("Consumable.PurpleRupee");
-    if (manualChange || CVarGetInteger(consumablePurpleRupee.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(consumablePurpleRupee.valuesCvar, consumablePurpleRupee.defaultColor);
+    if (manualChange || consumablePurpleRupee.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(consumablePurpleRupee);
         PATCH_GFX(gGiPurpleRupeeInnerColorDL, "Consumable_PurpleRupee1", consumablePurpleRupee.changedCvar, 3,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiPurpleRupeeInnerColorDL, "Consumable_PurpleRupee2", consumablePurpleRupee.changedCvar, 4,
@@ -1349,8 +1436,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   gsDPSetEnvColor(color.r * 0.75f, color.g * 0.75f, color.b * 0.75f, 255));
     }
     static CosmeticOption& consumableGoldRupee = cosmeticOptions.at("Consumable.GoldRupee");
-    if (manualChange || CVarGetInteger(consumableGoldRupee.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(consumableGoldRupee.valuesCvar, consumableGoldRupee.defaultColor);
+    if (manualChange || consumableGoldRupee.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(consumableGoldRupee);
         PATCH_GFX(gGiGoldRupeeInnerColorDL, "Consumable_GoldRupee1", consumableGoldRupee.changedCvar, 3,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiGoldRupeeInnerColorDL, "Consumable_GoldRupee2", consumableGoldRupee.changedCvar, 4,
@@ -1363,8 +1450,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& consumableHearts = cosmeticOptions.at("Consumable.Hearts");
-    if (manualChange || CVarGetInteger(consumableHearts.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(consumableHearts.valuesCvar, consumableHearts.defaultColor);
+    if (manualChange || consumableHearts.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(consumableHearts);
         /*
         PATCH_GFX(gGiRecoveryHeartDL,                             "Consumable_Hearts1", consumableHearts.changedCvar, 4,
         gsDPSetGrayscaleColor(color.r, color.g, color.b, 255)); PATCH_GFX(gGiRecoveryHeartDL, "Consumable_Hearts2",
@@ -1387,8 +1474,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
                   gsDPSetEnvColor(color.r / 2, color.g / 2, color.b / 2, 255));
     }
     static CosmeticOption& consumableMagic = cosmeticOptions.at("Consumable.Magic");
-    if (manualChange || CVarGetInteger(consumableMagic.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(consumableMagic.valuesCvar, consumableMagic.defaultColor);
+    if (manualChange || consumableMagic.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(consumableMagic);
         PATCH_GFX(gGiMagicJarSmallDL, "Consumable_Magic1", consumableMagic.changedCvar, 31,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiMagicJarSmallDL, "Consumable_Magic2", consumableMagic.changedCvar, 32,
@@ -1404,8 +1491,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& npcGoldenSkulltula = cosmeticOptions.at("NPC.GoldenSkulltula");
-    if (manualChange || CVarGetInteger(npcGoldenSkulltula.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(npcGoldenSkulltula.valuesCvar, npcGoldenSkulltula.defaultColor);
+    if (manualChange || npcGoldenSkulltula.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(npcGoldenSkulltula);
         PATCH_GFX(gSkulltulaTokenDL, "NPC_GoldenSkulltula1", npcGoldenSkulltula.changedCvar, 5,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gSkulltulaTokenDL, "NPC_GoldenSkulltula2", npcGoldenSkulltula.changedCvar, 6,
@@ -1429,8 +1516,8 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& npcGerudo = cosmeticOptions.at("NPC.Gerudo");
-    if (manualChange || CVarGetInteger(npcGerudo.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(npcGerudo.valuesCvar, npcGerudo.defaultColor);
+    if (manualChange || npcGerudo.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(npcGerudo);
         PATCH_GFX(gGerudoPurpleTorsoDL, "NPC_Gerudo1", npcGerudo.changedCvar, 139,
                   gsDPSetEnvColor(color.r, color.g, color.b, 255));
         PATCH_GFX(gGerudoPurpleRightThighDL, "NPC_Gerudo2", npcGerudo.changedCvar, 11,
@@ -1450,39 +1537,39 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& npcMetalTrap = cosmeticOptions.at("NPC.MetalTrap");
-    if (manualChange || CVarGetInteger(npcMetalTrap.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(npcMetalTrap.valuesCvar, npcMetalTrap.defaultColor);
+    if (manualChange || npcMetalTrap.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(npcMetalTrap);
         PATCH_GFX(gSlidingBladeTrapDL, "NPC_MetalTrap1", npcMetalTrap.changedCvar, 59,
                   gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
 
     static CosmeticOption& n64LogoRed = cosmeticOptions.at("Title.N64LogoRed");
-    if (manualChange || CVarGetInteger(n64LogoRed.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(n64LogoRed.valuesCvar, n64LogoRed.defaultColor);
+    if (manualChange || n64LogoRed.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(n64LogoRed);
         PATCH_GFX(gNintendo64LogoDL, "Title_N64LogoRed1", n64LogoRed.changedCvar, 17,
                   gsDPSetPrimColor(0, 0, 255, 255, 255, 255))
         PATCH_GFX(gNintendo64LogoDL, "Title_N64LogoRed2", n64LogoRed.changedCvar, 18,
                   gsDPSetEnvColor(color.r, color.g, color.b, 128));
     }
     static CosmeticOption& n64LogoBlue = cosmeticOptions.at("Title.N64LogoBlue");
-    if (manualChange || CVarGetInteger(n64LogoBlue.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(n64LogoBlue.valuesCvar, n64LogoBlue.defaultColor);
+    if (manualChange || n64LogoBlue.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(n64LogoBlue);
         PATCH_GFX(gNintendo64LogoDL, "Title_N64LogoBlue1", n64LogoBlue.changedCvar, 29,
                   gsDPSetPrimColor(0, 0, 255, 255, 255, 255))
         PATCH_GFX(gNintendo64LogoDL, "Title_N64LogoBlue2", n64LogoBlue.changedCvar, 30,
                   gsDPSetEnvColor(color.r, color.g, color.b, 128));
     }
     static CosmeticOption& n64LogoGreen = cosmeticOptions.at("Title.N64LogoGreen");
-    if (manualChange || CVarGetInteger(n64LogoGreen.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(n64LogoGreen.valuesCvar, n64LogoGreen.defaultColor);
+    if (manualChange || n64LogoGreen.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(n64LogoGreen);
         PATCH_GFX(gNintendo64LogoDL, "Title_N64LogoGreen1", n64LogoGreen.changedCvar, 56,
                   gsDPSetPrimColor(0, 0, 255, 255, 255, 255))
         PATCH_GFX(gNintendo64LogoDL, "Title_N64LogoGreen2", n64LogoGreen.changedCvar, 57,
                   gsDPSetEnvColor(color.r, color.g, color.b, 128));
     }
     static CosmeticOption& n64LogoYellow = cosmeticOptions.at("Title.N64LogoYellow");
-    if (manualChange || CVarGetInteger(n64LogoYellow.rainbowCvar, 0)) {
-        Color_RGBA8 color = CVarGetColor(n64LogoYellow.valuesCvar, n64LogoYellow.defaultColor);
+    if (manualChange || n64LogoYellow.rainbowActive) {
+        Color_RGBA8 color = GetPatchColor(n64LogoYellow);
         PATCH_GFX(gNintendo64LogoDL, "Title_N64LogoYellow1", n64LogoYellow.changedCvar, 81,
                   gsDPSetPrimColor(0, 0, 255, 255, 255, 255))
         PATCH_GFX(gNintendo64LogoDL, "Title_N64LogoYellow2", n64LogoYellow.changedCvar, 82,
@@ -1842,6 +1929,7 @@ void Draw_Placements() {
                                              .Color(THEME_COLOR)
                                              .Tooltip("This will change the width of the health bar"))) {
                 CVarSetInteger(CVAR_COSMETIC("HUD.EnemyHealthBar.Width.Changed"), 1);
+                CVarHandle_Invalidate();
             }
             ImGui::SameLine();
             ImGui::SetCursorPosY(ImGui::GetCursorPosY() + (ImGui::CalcTextSize("g").y * 2));
@@ -1849,6 +1937,7 @@ void Draw_Placements() {
                                   UIWidgets::ButtonOptions().Size(ImVec2(80, 36)).Padding(ImVec2(5.0f, 0.0f)))) {
                 CVarClear(CVAR_COSMETIC("HUD.EnemyHealthBar.Width.Value"));
                 CVarClear(CVAR_COSMETIC("HUD.EnemyHealthBar.Width.Changed"));
+                CVarHandle_Invalidate();
             }
             ImGui::EndTable();
         }
@@ -1861,6 +1950,7 @@ void Reset_Option_Single(const char* Button_Title, const char* name) {
     ImGui::SetCursorPosY(ImGui::GetCursorPosY() + (ImGui::CalcTextSize("g").y * 2));
     if (UIWidgets::Button(Button_Title, UIWidgets::ButtonOptions().Size(ImVec2(80, 36)).Padding(ImVec2(5.0f, 0.0f)))) {
         CVarClear(name);
+        CVarHandle_Invalidate();
     }
 }
 
@@ -1870,6 +1960,7 @@ void Reset_Option_Double(const char* Button_Title, const char* name) {
     if (UIWidgets::Button(Button_Title, UIWidgets::ButtonOptions().Size(ImVec2(80, 36)).Padding(ImVec2(5.0f, 0.0f)))) {
         CVarClear((std::string(name) + ".Value").c_str());
         CVarClear((std::string(name) + ".Changed").c_str());
+        CVarHandle_Invalidate();
     }
 }
 
@@ -2646,6 +2737,14 @@ void RegisterCosmeticHooks() {
 
     COND_HOOK(OnLoadGame, true, [](int32_t fileNum) { ApplyOrResetCustomGfxPatches(); });
 
+    // Toggling alt assets can swap out the display lists the patches point into
+    COND_HOOK(OnAssetAltChange, true, []() {
+        for (CosmeticGfxPatch* patch : sGfxPatches) {
+            patch->Invalidate();
+        }
+        ApplyOrResetCustomGfxPatches();
+    });
+
     COND_HOOK(OnGameFrameUpdate, true, CosmeticsUpdateTick);
 }
 
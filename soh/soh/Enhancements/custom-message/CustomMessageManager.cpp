@@ -761,39 +761,65 @@ std::string CustomMessage::PLAYER_NAME() {
     return "\x0F"s;
 }
 
-bool CustomMessageManager::InsertCustomMessage(std::string tableID, uint16_t textID, CustomMessage messages) {
-    auto foundMessageTable = messageTables.find(tableID);
-    if (foundMessageTable == messageTables.end()) {
+CustomMessageManager::MessageTableEntry* CustomMessageManager::FindTable(const std::string& tableID) {
+    const CustomMessageTableHandle handle = GetTableHandle(tableID);
+    return handle != CUSTOM_MESSAGE_TABLE_INVALID ? &messageTables[handle] : nullptr;
+}
+
+bool CustomMessageManager::InsertCustomMessage(const std::string& tableID, uint16_t textID, CustomMessage messages) {
+    MessageTableEntry* table = FindTable(tableID);
+    if (table == nullptr) {
         return false;
     }
-    auto& messageTable = foundMessageTable->second;
-    auto messageInsertResult = messageTable.emplace(textID, messages);
+    auto messageInsertResult = table->messages.emplace(textID, std::move(messages));
+    if (messageInsertResult.second) {
+        table->formatted.clear();
+    }
     return messageInsertResult.second;
 }
 
-bool CustomMessageManager::CreateGetItemMessage(std::string tableID, uint16_t giid, ItemID iid,
+bool CustomMessageManager::CreateGetItemMessage(const std::string& tableID, uint16_t giid, ItemID iid,
                                                 CustomMessage messageEntry) {
     messageEntry.Format(iid);
     const uint16_t textID = giid;
-    return InsertCustomMessage(tableID, textID, messageEntry);
+    return InsertCustomMessage(tableID, textID, std::move(messageEntry));
 }
 
-bool CustomMessageManager::CreateMessage(std::string tableID, uint16_t textID, CustomMessage messageEntry) {
-    return InsertCustomMessage(tableID, textID, messageEntry);
+bool CustomMessageManager::CreateMessage(const std::string& tableID, uint16_t textID, CustomMessage messageEntry) {
+    return InsertCustomMessage(tableID, textID, std::move(messageEntry));
 }
 
-CustomMessage CustomMessageManager::RetrieveMessage(std::string tableID, uint16_t textID, MessageFormat format) {
-    std::unordered_map<std::string, CustomMessageTable>::const_iterator foundMessageTable = messageTables.find(tableID);
-    if (foundMessageTable == messageTables.end()) {
+CustomMessage CustomMessageManager::RetrieveMessage(const std::string& tableID, uint16_t textID,
+                                                    MessageFormat format) {
+    const CustomMessage* message = TryRetrieve(tableID, textID, format);
+    if (message == nullptr) {
         throw(MessageNotFoundException(tableID, textID));
     }
-    CustomMessageTable messageTable = foundMessageTable->second;
-    std::unordered_map<uint16_t, CustomMessage>::const_iterator foundMessage = messageTable.find(textID);
-    if (foundMessage == messageTable.end()) {
-        throw(MessageNotFoundException(tableID, textID));
+    return *message;
+}
+
+const CustomMessage* CustomMessageManager::TryRetrieve(CustomMessageTableHandle table, uint16_t textID,
+                                                       MessageFormat format) {
+    if (table >= messageTables.size()) {
+        return nullptr;
+    }
+    MessageTableEntry& messageTable = messageTables[table];
+    auto foundMessage = messageTable.messages.find(textID);
+    if (foundMessage == messageTable.messages.end()) {
+        return nullptr;
+    }
+    if (format == MF_RAW) {
+        return &foundMessage->second;
     }
-    CustomMessage message = foundMessage->second;
 
+    // Every format applies to all languages at once, so one entry covers each language
+    const uint32_t key = (static_cast<uint32_t>(textID) << 8) | format;
+    auto foundFormatted = messageTable.formatted.find(key);
+    if (foundFormatted != messageTable.formatted.end()) {
+        return &foundFormatted->second;
+    }
+
+    CustomMessage message = foundMessage->second;
     if (format == MF_FORMATTED) {
         message.Format();
     } else if (format == MF_AUTO_FORMAT) {
@@ -803,21 +829,34 @@ CustomMessage CustomMessageManager::RetrieveMessage(std::string tableID, uint16_
     } else if (format == MF_ENCODE) {
         message.Encode();
     }
+    return &messageTable.formatted.emplace(key, std::move(message)).first->second;
+}
 
-    return message;
+const CustomMessage* CustomMessageManager::TryRetrieve(const std::string& tableID, uint16_t textID,
+                                                       MessageFormat format) {
+    return TryRetrieve(GetTableHandle(tableID), textID, format);
 }
 
-bool CustomMessageManager::ClearMessageTable(std::string tableID) {
-    auto foundMessageTable = messageTables.find(tableID);
-    if (foundMessageTable == messageTables.end()) {
+CustomMessageTableHandle CustomMessageManager::GetTableHandle(const std::string& tableID) const {
+    auto foundHandle = tableHandles.find(tableID);
+    return foundHandle != tableHandles.end() ? foundHandle->second : CUSTOM_MESSAGE_TABLE_INVALID;
+}
+
+bool CustomMessageManager::ClearMessageTable(const std::string& tableID) {
+    MessageTableEntry* table = FindTable(tableID);
+    if (table == nullptr) {
         return false;
     }
-    auto& messageTable = foundMessageTable->second;
-    messageTable.clear();
+    table->messages.clear();
+    table->formatted.clear();
     return true;
 }
 
-bool CustomMessageManager::AddCustomMessageTable(std::string tableID) {
-    CustomMessageTable newMessageTable;
-    return messageTables.emplace(tableID, newMessageTable).second;
+bool CustomMessageManager::AddCustomMessageTable(const std::string& tableID) {
+    if (tableHandles.contains(tableID) || messageTables.size() >= CUSTOM_MESSAGE_TABLE_INVALID) {
+        return false;
+    }
+    tableHandles.emplace(tableID, static_cast<CustomMessageTableHandle>(messageTables.size()));
+    messageTables.emplace_back();
+    return true;
 }
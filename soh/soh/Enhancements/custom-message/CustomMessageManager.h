@@ -1,4 +1,5 @@
 #pragma once
+#include <deque>
 #include <unordered_map>
 #include <cstdint>
 #include <exception>
@@ -232,6 +233,10 @@ class CustomMessage {
 
 typedef std::unordered_map<uint16_t, CustomMessage> CustomMessageTable;
 
+// Interned table ID, resolve once with CustomMessageManager::GetTableHandle to skip hashing the table name per lookup
+typedef uint16_t CustomMessageTableHandle;
+#define CUSTOM_MESSAGE_TABLE_INVALID ((CustomMessageTableHandle)0xFFFF)
+
 /**
  * @brief Encapsulates data and functions for creating custom message tables and storing and retrieving
  * `CustomMessage`s from them. It also converts a more user-friendly string syntax to the raw control
@@ -240,9 +245,18 @@ typedef std::unordered_map<uint16_t, CustomMessage> CustomMessageTable;
  */
 class CustomMessageManager {
   private:
-    std::unordered_map<std::string, CustomMessageTable> messageTables;
+    struct MessageTableEntry {
+        CustomMessageTable messages;
+        // Formatted copies of messages, keyed by textID and MessageFormat, dropped whenever messages changes
+        std::unordered_map<uint32_t, CustomMessage> formatted;
+    };
+
+    std::unordered_map<std::string, CustomMessageTableHandle> tableHandles;
+    // Indexed by handle, a deque so entries never move when a table is added
+    std::deque<MessageTableEntry> messageTables;
 
-    bool InsertCustomMessage(std::string tableID, uint16_t textID, CustomMessage message);
+    MessageTableEntry* FindTable(const std::string& tableID);
+    bool InsertCustomMessage(const std::string& tableID, uint16_t textID, CustomMessage message);
 
   public:
     static CustomMessageManager* Instance;
@@ -261,7 +275,7 @@ class CustomMessageManager {
      * @return true if adding the custom message succeeds, or
      * @return false if it does not.
      */
-    bool CreateGetItemMessage(std::string tableID, uint16_t giid, ItemID iid, CustomMessage message);
+    bool CreateGetItemMessage(const std::string& tableID, uint16_t giid, ItemID iid, CustomMessage message);
 
     /**
      * @brief Formats the provided Custom Message Entry and inserts it into the table with the provided tableID,
@@ -273,7 +287,7 @@ class CustomMessageManager {
      * @return true if adding the custom message succeeds, or
      * @return false if it does not.
      */
-    bool CreateMessage(std::string tableID, uint16_t textID, CustomMessage message);
+    bool CreateMessage(const std::string& tableID, uint16_t textID, CustomMessage message);
 
     /**
      * @brief Retrieves a message from the table with id tableID with the provided textID.
@@ -287,7 +301,28 @@ class CustomMessageManager {
      * @param format the type of formatting to apply to the retrieved message
      * @return CustomMessage
      */
-    CustomMessage RetrieveMessage(std::string tableID, uint16_t textID, MessageFormat format = MF_RAW);
+    CustomMessage RetrieveMessage(const std::string& tableID, uint16_t textID, MessageFormat format = MF_RAW);
+
+    /**
+     * @brief Looks up a message without copying it or throwing. Formatted messages are cached, so only the first
+     * lookup of a given textID and format in a table pays for formatting.
+     *
+     * @param table the handle of the custom message table, from GetTableHandle
+     * @param textID the ID of the message you want to retrieve
+     * @param format the type of formatting to apply to the retrieved message
+     * @return a pointer to the message, valid until the table is next cleared or added to, or
+     * @return nullptr if either the table or the message do not exist
+     */
+    const CustomMessage* TryRetrieve(CustomMessageTableHandle table, uint16_t textID, MessageFormat format = MF_RAW);
+    const CustomMessage* TryRetrieve(const std::string& tableID, uint16_t textID, MessageFormat format = MF_RAW);
+
+    /**
+     * @brief Resolves a table ID to its handle. Handles stay valid for the lifetime of the manager.
+     *
+     * @param tableID the ID of the custom message table
+     * @return the handle, or CUSTOM_MESSAGE_TABLE_INVALID if no table has that ID
+     */
+    CustomMessageTableHandle GetTableHandle(const std::string& tableID) const;
 
     /**
      * @brief Empties out the message table identified by tableID.
@@ -296,7 +331,7 @@ class CustomMessageManager {
      * @return true if it was cleared successfully, or
      * @return false if the table did not exist
      */
-    bool ClearMessageTable(std::string tableID);
+    bool ClearMessageTable(const std::string& tableID);
 
     /**
      * @brief Creates an empty CustomMessageTable accessible at the provided tableID
@@ -306,7 +341,7 @@ class CustomMessageManager {
      * @return false if not (i.e. because a table with that ID
      * already exists.)
      */
-    bool AddCustomMessageTable(std::string tableID);
+    bool AddCustomMessageTable(const std::string& tableID);
 };
 
 class MessageNotFoundException : public std::exception {
@@ -12,6 +12,12 @@
 #include "soh/Enhancements/cosmetics/CosmeticsEditor.h"
 #include "soh/Enhancements/audio/AudioEditor.h"
 #include "soh/Enhancements/randomizer/logic.h"
+#include "soh/Enhancements/debugger/replayHarness.h"
+#include "soh/Enhancements/debugger/arenaBenchmark.h"
+#include "soh/Enhancements/enemyrandomizer.h"
+#if !defined(__SWITCH__) && !defined(__WIIU__)
+#include "soh/Extractor/ExtractManifest.h"
+#endif
 
 #define Path _Path
 #define PATH_HACK
@@ -389,18 +395,22 @@ static bool GiveItemHandler(std::shared_ptr<Ship::Console> Console, const std::v
         ERROR_MESSAGE("[SOH] Unexpected arguments passed");
         return 1;
     }
-    GetItemEntry getItemEntry = GET_ITEM_NONE;
+    const GetItemEntry* getItemEntry = nullptr;
 
     if (args[1].compare("vanilla") == 0) {
-        getItemEntry = ItemTableManager::Instance->RetrieveItemEntry(MOD_NONE, std::stoi(args[2]));
+        getItemEntry = ItemTableManager::Instance->FindItemEntry(MOD_NONE, std::stoi(args[2]));
     } else if (args[1].compare("randomizer") == 0) {
-        getItemEntry = ItemTableManager::Instance->RetrieveItemEntry(MOD_RANDOMIZER, std::stoi(args[2]));
+        getItemEntry = ItemTableManager::Instance->FindItemEntry(MOD_RANDOMIZER, std::stoi(args[2]));
     } else {
         ERROR_MESSAGE("[SOH] Invalid argument passed, must be 'vanilla' or 'randomizer'");
         return 1;
     }
+    if (getItemEntry == nullptr) {
+        ERROR_MESSAGE("[SOH] No item with ID %s", args[2].c_str());
+        return 1;
+    }
 
-    GiveItemEntryWithoutActor(gPlayState, getItemEntry);
+    GiveItemEntryWithoutActor(gPlayState, *getItemEntry);
 
     return 0;
 }
@@ -532,6 +542,30 @@ static bool QuitHandler(std::shared_ptr<Ship::Console> Console, const std::vecto
     return 0;
 }
 
+#if !defined(__SWITCH__) && !defined(__WIIU__)
+static bool ExtractManifestCheckHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
+                                        std::string* output) {
+    std::string report;
+    if (!ExtractManifest_Check(report)) {
+        ERROR_MESSAGE("[SOH] %s", report.c_str());
+        return 1;
+    }
+    INFO_MESSAGE("[SOH] %s", report.c_str());
+    return 0;
+}
+#endif
+
+static bool EnemyPoolCheckHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
+                                  std::string* output) {
+    std::string report;
+    if (!EnemyRandomizer_CheckPools(report)) {
+        ERROR_MESSAGE("[SOH] %s", report.c_str());
+        return 1;
+    }
+    INFO_MESSAGE("[SOH] %s", report.c_str());
+    return 0;
+}
+
 static bool SaveStateHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
                              std::string* output) {
     unsigned int slot = OTRGlobals::Instance->gSaveStateMgr->GetCurrentSlot();
@@ -572,6 +606,63 @@ static bool LoadStateHandler(std::shared_ptr<Ship::Console> Console, const std::
     }
 }
 
+static bool SaveStateCheckHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
+                                  std::string* output) {
+    if (gPlayState == nullptr) {
+        ERROR_MESSAGE("[SOH] Can not check save states outside of \"GamePlay\"");
+        return 1;
+    }
+
+    std::string report;
+    if (!SaveState_CheckRoundTrip(args.size() > 1 ? args[1] : "Fuse", report)) {
+        ERROR_MESSAGE("[SOH] %s", report.c_str());
+        return 1;
+    }
+    INFO_MESSAGE("[SOH] %s", report.c_str());
+    return 0;
+}
+
+static bool RewindCheckHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
+                               std::string* output) {
+    std::string report;
+    if (!RewindRing_Check(report)) {
+        ERROR_MESSAGE("[SOH] %s", report.c_str());
+        return 1;
+    }
+    INFO_MESSAGE("[SOH] %s", report.c_str());
+    return 0;
+}
+
+static bool RewindHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
+                          std::string* output) {
+    unsigned int steps = 1;
+
+    if (args.size() > 1) {
+        try {
+            steps = std::stoi(args[1], nullptr, 10);
+        } catch (std::invalid_argument const& ex) {
+            ERROR_MESSAGE("[SOH] Rewind steps must be a number.");
+            return 1;
+        }
+    }
+
+    const SaveStateReturn rtn = OTRGlobals::Instance->gSaveStateMgr->AddRequest({ steps, RequestType::REWIND });
+
+    switch (rtn) {
+        case SaveStateReturn::SUCCESS:
+            INFO_MESSAGE("[SOH] Rewinding %u steps", steps);
+            return 0;
+        case SaveStateReturn::FAIL_STATE_EMPTY:
+            ERROR_MESSAGE("[SOH] No rewind history, enable rewind in the cheats menu");
+            return 1;
+        case SaveStateReturn::FAIL_WRONG_GAMESTATE:
+            ERROR_MESSAGE("[SOH] Can not rewind outside of \"GamePlay\"");
+            return 1;
+        default:
+            return 1;
+    }
+}
+
 static bool StateSlotSelectHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
                                    std::string* output) {
     if (args.size() < 2) {
@@ -597,6 +688,119 @@ static bool StateSlotSelectHandler(std::shared_ptr<Ship::Console> Console, const
     return 0;
 }
 
+static bool ReplayRecordHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
+                                std::string* output) {
+    if (args.size() < 3) {
+        ERROR_MESSAGE("[SOH] Unexpected arguments passed");
+        return 1;
+    }
+    if (gPlayState == nullptr) {
+        ERROR_MESSAGE("gPlayState == nullptr");
+        return 1;
+    }
+    if (ReplayHarness_IsActive()) {
+        ERROR_MESSAGE("[SOH] A replay is already running, stop it with replay_stop");
+        return 1;
+    }
+
+    int32_t frames;
+    try {
+        frames = std::stoi(args[2], nullptr, 10);
+    } catch (std::invalid_argument const& ex) {
+        ERROR_MESSAGE("[SOH] Frame count must be a number.");
+        return 1;
+    }
+    if (frames <= 0) {
+        ERROR_MESSAGE("[SOH] Frame count must be positive.");
+        return 1;
+    }
+
+    ReplayHarness_StartRecording(args[1], frames);
+    INFO_MESSAGE("[SOH] Recording %d frames to %s", frames, args[1].c_str());
+    return 0;
+}
+
+static bool ReplayPlayHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
+                              std::string* output) {
+    if (args.size() < 2) {
+        ERROR_MESSAGE("[SOH] Unexpected arguments passed");
+        return 1;
+    }
+    if (gPlayState == nullptr) {
+        ERROR_MESSAGE("gPlayState == nullptr");
+        return 1;
+    }
+    if (ReplayHarness_IsActive()) {
+        ERROR_MESSAGE("[SOH] A replay is already running, stop it with replay_stop");
+        return 1;
+    }
+
+    if (!ReplayHarness_StartPlayback(args[1])) {
+        ERROR_MESSAGE("[SOH] Could not load replay %s", args[1].c_str());
+        return 1;
+    }
+    INFO_MESSAGE("[SOH] Playing back %s", args[1].c_str());
+    return 0;
+}
+
+static bool ReplayStopHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
+                              std::string* output) {
+    if (!ReplayHarness_IsActive()) {
+        ERROR_MESSAGE("[SOH] No replay is running");
+        return 1;
+    }
+
+    ReplayHarness_Stop();
+    INFO_MESSAGE("[SOH] Replay stopped");
+    return 0;
+}
+
+static bool ArenaTraceStartHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
+                                   std::string* output) {
+    if (args.size() < 2) {
+        ERROR_MESSAGE("[SOH] Unexpected arguments passed");
+        return 1;
+    }
+    if (ArenaBenchmark_IsTracing()) {
+        ERROR_MESSAGE("[SOH] An arena trace is already running, stop it with arena_trace_stop");
+        return 1;
+    }
+
+    if (!ArenaBenchmark_StartTrace(args[1])) {
+        ERROR_MESSAGE("[SOH] Could not start an arena trace to %s", args[1].c_str());
+        return 1;
+    }
+    INFO_MESSAGE("[SOH] Tracing arena allocations to %s", args[1].c_str());
+    return 0;
+}
+
+static bool ArenaTraceStopHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
+                                  std::string* output) {
+    if (!ArenaBenchmark_IsTracing()) {
+        ERROR_MESSAGE("[SOH] No arena trace is running");
+        return 1;
+    }
+
+    INFO_MESSAGE("[SOH] Arena trace stopped after %zu operations", ArenaBenchmark_StopTrace());
+    return 0;
+}
+
+static bool ArenaBenchHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
+                              std::string* output) {
+    if (args.size() < 2) {
+        ERROR_MESSAGE("[SOH] Unexpected arguments passed");
+        return 1;
+    }
+
+    std::string report;
+    if (!ArenaBenchmark_Replay(args[1], report)) {
+        ERROR_MESSAGE("[SOH] %s", report.c_str());
+        return 1;
+    }
+    INFO_MESSAGE("[SOH] %s", report.c_str());
+    return 0;
+}
+
 static bool InvisibleHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args,
                              std::string* output) {
     if (args.size() < 2) {
@@ -1502,15 +1706,60 @@ void DebugConsole_Init(void) {
     CMD_REGISTER("file_select", { FileSelectHandler, "Returns to the file select." });
     CMD_REGISTER("reset", { ResetHandler, "Resets the game." });
     CMD_REGISTER("quit", { QuitHandler, "Quits the game." });
+#if !defined(__SWITCH__) && !defined(__WIIU__)
+    CMD_REGISTER("extract_manifest_check",
+                 { ExtractManifestCheckHandler,
+                   "Checks that the extraction manifest reports changed assets, rom, port version and config." });
+#endif
+    CMD_REGISTER("enemy_pool_check",
+                 { EnemyPoolCheckHandler, "Checks the cached enemy randomizer pools of every scene, room and MQ "
+                                          "combination against filtering the spawn table directly." });
 
     // Save States
     CMD_REGISTER("save_state", { SaveStateHandler, "Save a state." });
     CMD_REGISTER("load_state", { LoadStateHandler, "Load a state." });
+    CMD_REGISTER("savestate_check", { SaveStateCheckHandler,
+                                      "Saves and loads back one save state extension, Fuse by default, and reports "
+                                      "whether it comes back unchanged.",
+                                      {
+                                          { "Extension", Ship::ArgumentType::TEXT, true },
+                                      } });
+    CMD_REGISTER("rewind", { RewindHandler,
+                             "Rewinds to an earlier rewind capture.",
+                             {
+                                 { "Steps", Ship::ArgumentType::NUMBER, true },
+                             } });
+    CMD_REGISTER("rewind_check", { RewindCheckHandler,
+                                   "Checks that the rewind ring restores every capture of synthetic frames, across "
+                                   "keyframes and after it wraps around." });
     CMD_REGISTER("set_slot", { StateSlotSelectHandler,
                                "Selects a SaveState slot",
                                {
                                    { "Slot number", Ship::ArgumentType::NUMBER },
                                } });
+    CMD_REGISTER("replay_record", { ReplayRecordHandler,
+                                    "Records inputs from a reload of the current map into a replay file.",
+                                    {
+                                        { "File", Ship::ArgumentType::TEXT },
+                                        { "Frames", Ship::ArgumentType::NUMBER },
+                                    } });
+    CMD_REGISTER("replay_play", { ReplayPlayHandler,
+                                  "Plays back a replay file and reports frame times and desyncs.",
+                                  {
+                                      { "File", Ship::ArgumentType::TEXT },
+                                  } });
+    CMD_REGISTER("replay_stop", { ReplayStopHandler, "Stops the running replay." });
+    CMD_REGISTER("arena_trace_start", { ArenaTraceStartHandler,
+                                        "Records the Zelda arena's allocations into a trace file.",
+                                        {
+                                            { "File", Ship::ArgumentType::TEXT },
+                                        } });
+    CMD_REGISTER("arena_trace_stop", { ArenaTraceStopHandler, "Stops the running arena trace." });
+    CMD_REGISTER("arena_bench", { ArenaBenchHandler,
+                                  "Replays an arena trace on the size class and first fit allocators and reports both.",
+                                  {
+                                      { "File", Ship::ArgumentType::TEXT },
+                                  } });
 
     // Map & Location
     CMD_REGISTER("void", { VoidHandler, "Voids out of the current map." });
@@ -203,10 +203,18 @@ void MessageDebug_StartTextBox(const char* tableId, uint16_t textId, uint8_t lan
         memcpy(font->msgBuf, reinterpret_cast<void const*>(src), font->msgLength);
     } else {
         constexpr int maxBufferSize = sizeof(font->msgBuf);
-        const CustomMessage messageEntry = CustomMessageManager::Instance->RetrieveMessage(tableId, textId);
-        font->charTexBuf[0] = (messageEntry.GetTextBoxType() << 4) | messageEntry.GetTextBoxPosition();
+        const CustomMessage* messageEntry = CustomMessageManager::Instance->TryRetrieve(tableId, textId);
+        if (messageEntry == nullptr) {
+            static const CustomMessage sNotFound = [] {
+                CustomMessage message("Message not found");
+                message.Format();
+                return message;
+            }();
+            messageEntry = &sNotFound;
+        }
+        font->charTexBuf[0] = (messageEntry->GetTextBoxType() << 4) | messageEntry->GetTextBoxPosition();
         font->msgLength =
-            SohUtils::CopyStringToCharBuffer(buffer, messageEntry.GetForLanguage(language), maxBufferSize);
+            SohUtils::CopyStringToCharBuffer(buffer, messageEntry->GetForLanguage(language), maxBufferSize);
         msgCtx->msgLength = static_cast<int32_t>(font->msgLength);
     }
     msgCtx->textBoxProperties = font->charTexBuf[0];
@@ -1,5 +1,6 @@
 #include "SohStatsWindow.h"
 #include "soh/OTRGlobals.h"
+#include "frameProfiler.h"
 
 void SohStatsWindow::DrawElement() {
     const float framerate = ImGui::GetIO().Framerate;
@@ -19,6 +20,33 @@ void SohStatsWindow::DrawElement() {
     ImGui::Text("Platform: Unknown");
 #endif
     ImGui::Text("Status: %.3f ms/frame (%.1f FPS)", deltatime * 1000.0f, framerate);
+
+#ifdef ENABLE_FRAME_PROFILER
+    std::vector<FrameProfilerZoneStats> zones = FrameProfiler_GetZoneStats();
+    if (!zones.empty() && ImGui::BeginTable("FrameProfilerZones", 4, ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Zone");
+        ImGui::TableSetupColumn("Avg ms");
+        ImGui::TableSetupColumn("Max ms");
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableHeadersRow();
+        for (const auto& zone : zones) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(zone.name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", zone.averageMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", zone.maxMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", zone.averageCalls);
+        }
+        ImGui::EndTable();
+    }
+    uint64_t dropped = FrameProfiler_GetDroppedZones();
+    if (dropped != 0) {
+        ImGui::Text("Dropped zones: %llu", (unsigned long long)dropped);
+    }
+#endif
     ImGui::PopStyleColor();
     ImGui::PopFont();
 }
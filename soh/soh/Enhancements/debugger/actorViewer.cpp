@@ -64,12 +64,16 @@ typedef enum {
     ACTORVIEWER_NAMETAGS_BOTH,
 } ActorViewerNameTagsType;
 
-const std::string GetActorDescription(u16 id) {
-    return ActorDB::Instance->RetrieveEntry(id).entry.valid ? ActorDB::Instance->RetrieveEntry(id).entry.desc : "???";
+static const std::string unknownActor = "???";
+
+const std::string& GetActorDescription(u16 id) {
+    const ActorDB::Entry& actorEntry = ActorDB::Instance->RetrieveEntry(id);
+    return actorEntry.entry.valid ? actorEntry.desc : unknownActor;
 }
 
-const std::string GetActorDebugName(u16 id) {
-    return ActorDB::Instance->RetrieveEntry(id).entry.valid ? ActorDB::Instance->RetrieveEntry(id).entry.name : "???";
+const std::string& GetActorDebugName(u16 id) {
+    const ActorDB::Entry& actorEntry = ActorDB::Instance->RetrieveEntry(id);
+    return actorEntry.entry.valid ? actorEntry.name : unknownActor;
 }
 
 template <typename T> void DrawGroupWithBorder(T&& drawFunc, std::string section) {
@@ -796,54 +800,71 @@ void CreateActorSpecificData() {
     };
 }
 
-std::vector<u16> GetActorsWithDescriptionContainingString(std::string s) {
-    std::locale loc;
-    for (size_t i = 0; i < s.length(); i += 1) {
-        s[i] = std::tolower(s[i], loc);
-    }
-
-    std::vector<u16> actors;
-    for (int i = 0; i < ActorDB::Instance->GetEntryCount(); i += 1) {
-        ActorDB::Entry actorEntry = ActorDB::Instance->RetrieveEntry(i);
-        std::string desc = actorEntry.desc;
-        for (size_t j = 0; j < desc.length(); j += 1) {
-            desc[j] = std::tolower(desc[j], loc);
-        }
-        if (desc.find(s) != std::string::npos) {
-            actors.push_back((u16)i);
-        }
-    }
-    return actors;
+std::vector<u16> GetActorsWithDescriptionContainingString(const std::string& s) {
+    return ActorDB::Instance->SearchDescriptions(s);
 }
 
-void ActorViewer_AddTagForActor(Actor* actor) {
-    if (!CVarGetInteger(CVAR_ACTOR_NAME_TAGS("Enabled"), 0)) {
-        return;
-    }
+typedef enum {
+    ACTORVIEWER_NAMETAG_ID = 1 << 0,
+    ACTORVIEWER_NAMETAG_DESCRIPTION = 1 << 1,
+    ACTORVIEWER_NAMETAG_CATEGORY = 1 << 2,
+    ACTORVIEWER_NAMETAG_PARAMS = 1 << 3,
+} ActorViewerNameTagFlags;
 
-    std::vector<std::string> parts;
+// Name tag text keyed by actor id, params, category and the displayed parts, cleared on scene init
+static std::unordered_map<uint64_t, std::string> nameTagCache;
 
+static const std::string& GetNameTagText(Actor* actor) {
+    uint32_t displayFlags = 0;
     if (CVarGetInteger(CVAR_ACTOR_NAME_TAGS("DisplayID"), 0)) {
-        parts.push_back(GetActorDebugName(actor->id));
+        displayFlags |= ACTORVIEWER_NAMETAG_ID;
     }
     if (CVarGetInteger(CVAR_ACTOR_NAME_TAGS("DisplayDescription"), 0)) {
-        parts.push_back(GetActorDescription(actor->id));
+        displayFlags |= ACTORVIEWER_NAMETAG_DESCRIPTION;
     }
     if (CVarGetInteger(CVAR_ACTOR_NAME_TAGS("DisplayCategory"), 0)) {
-        parts.push_back(acMapping[actor->category]);
+        displayFlags |= ACTORVIEWER_NAMETAG_CATEGORY;
     }
     if (CVarGetInteger(CVAR_ACTOR_NAME_TAGS("DisplayParams"), 0)) {
-        parts.push_back(fmt::format("0x{:04X} ({})", (u16)actor->params, actor->params));
+        displayFlags |= ACTORVIEWER_NAMETAG_PARAMS;
+    }
+
+    uint64_t key = ((uint64_t)(u16)actor->id << 32) | ((uint32_t)(u16)actor->params << 16) | (actor->category << 8) |
+                   displayFlags;
+    auto [it, inserted] = nameTagCache.try_emplace(key);
+    std::string& tag = it->second;
+    if (!inserted) {
+        return tag;
     }
 
-    std::string tag = "";
-    for (size_t i = 0; i < parts.size(); i++) {
-        if (i != 0) {
+    auto addPart = [&tag](const std::string& part) {
+        if (!tag.empty()) {
             tag += "\n";
         }
-        tag += parts.at(i);
+        tag += part;
+    };
+    if (displayFlags & ACTORVIEWER_NAMETAG_ID) {
+        addPart(GetActorDebugName(actor->id));
+    }
+    if (displayFlags & ACTORVIEWER_NAMETAG_DESCRIPTION) {
+        addPart(GetActorDescription(actor->id));
+    }
+    if (displayFlags & ACTORVIEWER_NAMETAG_CATEGORY) {
+        addPart(acMapping[actor->category]);
+    }
+    if (displayFlags & ACTORVIEWER_NAMETAG_PARAMS) {
+        addPart(fmt::format("0x{:04X} ({})", (u16)actor->params, actor->params));
+    }
+    return tag;
+}
+
+void ActorViewer_AddTagForActor(Actor* actor) {
+    if (!CVarGetInteger(CVAR_ACTOR_NAME_TAGS("Enabled"), 0)) {
+        return;
     }
 
+    const std::string& tag = GetNameTagText(actor);
+
     bool withZBuffer = CVarGetInteger(CVAR_ACTOR_NAME_TAGS("WithZBuffer"), 0);
 
     NameTag_RegisterForActorWithOptions(actor, tag.c_str(),
@@ -1226,6 +1247,7 @@ void ActorViewerWindow::InitElement() {
 void ActorViewer_RegisterNameTagHooks() {
     COND_HOOK(OnActorInit, CVAR_ACTOR_NAME_TAGS_ENABLED,
               [](void* actor) { ActorViewer_AddTagForActor(static_cast<Actor*>(actor)); });
+    COND_HOOK(OnSceneInit, CVAR_ACTOR_NAME_TAGS_ENABLED, [](int16_t sceneNum) { nameTagCache.clear(); });
 }
 
 static RegisterShipInitFunc initFunc(ActorViewer_RegisterNameTagHooks, { CVAR_ACTOR_NAME_TAGS_ENABLED_NAME });
@@ -0,0 +1,463 @@
+#include "arenaBenchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+#include <spdlog/fmt/fmt.h>
+
+extern "C" {
+#include <z64.h>
+#include "functions.h"
+extern Arena sZeldaArena;
+}
+
+#define ARENA_TRACE_MAGIC 0x54415A53 // "SZAT"
+#define ARENA_TRACE_VERSION 1
+
+namespace {
+
+struct ArenaTraceHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t arenaSize;
+};
+
+struct ArenaTraceRecord {
+    uint32_t op;
+    uint32_t size;
+    uint64_t ptr;
+    uint64_t result;
+};
+
+// A record with its blocks resolved to slots, so the timed replay doesn't look up recorded addresses
+struct ReplayOp {
+    ArenaTraceOp op;
+    uint32_t size;
+    int32_t ptrSlot;
+    int32_t resultSlot;
+};
+
+struct ReplayStats {
+    double ms = 0.0;
+    uint32_t failed = 0;
+    double peakFragmentation = 0.0;
+    u32 peakAllocated = 0;
+};
+
+std::ofstream sTraceFile;
+size_t sTraceCount = 0;
+
+void WriteRecord(ArenaTraceOp op, void* ptr, size_t size, void* result) {
+    ArenaTraceRecord record = { static_cast<uint32_t>(op), static_cast<uint32_t>(size),
+                                reinterpret_cast<uintptr_t>(ptr), reinterpret_cast<uintptr_t>(result) };
+    sTraceFile.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    sTraceCount++;
+}
+
+std::vector<ReplayOp> ResolveSlots(const std::vector<ArenaTraceRecord>& records, size_t& slotCount) {
+    std::vector<ReplayOp> ops;
+    std::unordered_map<uint64_t, int32_t> live;
+    ops.reserve(records.size());
+    slotCount = 0;
+
+    for (const ArenaTraceRecord& record : records) {
+        ReplayOp op = { static_cast<ArenaTraceOp>(record.op), record.size, -1, -1 };
+        if (op.op == ARENA_TRACE_REALLOC || op.op == ARENA_TRACE_FREE) {
+            auto it = live.find(record.ptr);
+            if (it != live.end()) {
+                op.ptrSlot = it->second;
+                live.erase(it);
+            } else if (op.op == ARENA_TRACE_FREE) {
+                // Freeing nullptr, or a block from before the trace started
+                continue;
+            }
+        }
+        if (op.op != ARENA_TRACE_FREE && record.result != 0) {
+            op.resultSlot = static_cast<int32_t>(slotCount++);
+            live[record.result] = op.resultSlot;
+        }
+        ops.push_back(op);
+    }
+    return ops;
+}
+
+// The arena allocator, with its size class free lists
+class SizeClassArena {
+  public:
+    SizeClassArena(void* start, size_t size) {
+        __osMallocInit(&mArena, start, size);
+    }
+    ~SizeClassArena() {
+        __osMallocCleanup(&mArena);
+    }
+
+    void* Malloc(size_t size) {
+        return __osMalloc(&mArena, size);
+    }
+    void* MallocR(size_t size) {
+        return __osMallocR(&mArena, size);
+    }
+    void* Realloc(void* ptr, size_t newSize) {
+        return __osRealloc(&mArena, ptr, newSize);
+    }
+    void Free(void* ptr) {
+        __osFree(&mArena, ptr);
+    }
+    void GetSizes(u32* maxFree, u32* free, u32* allocated) {
+        ArenaImpl_GetSizes(&mArena, maxFree, free, allocated);
+    }
+
+  private:
+    Arena mArena;
+};
+
+// The arena allocator as it was before the size class free lists, a first fit walk of the block list from the head
+// (or from the tail for MallocR), with the node layout it had. Kept so a trace can be replayed against both, since
+// reusing the most recently freed block of a size class fragments the arena differently than first fit does.
+class FirstFitArena {
+  public:
+    FirstFitArena(void* start, size_t size) {
+        Node* first = reinterpret_cast<Node*>(Align16(reinterpret_cast<uintptr_t>(start)));
+        const size_t usable = (size - (reinterpret_cast<uintptr_t>(first) - reinterpret_cast<uintptr_t>(start))) & ~0xF;
+        if (usable > sizeof(Node)) {
+            first->magic = kNodeMagic;
+            first->isFree = true;
+            first->size = usable - sizeof(Node);
+            first->next = nullptr;
+            first->prev = nullptr;
+            mHead = first;
+        }
+    }
+
+    void* Malloc(size_t size) {
+        size = Align16(size);
+        const size_t blockSize = size + sizeof(Node);
+
+        for (Node* iter = mHead; iter != nullptr; iter = GetNext(iter)) {
+            if (iter->isFree && iter->size >= size) {
+                if (blockSize < iter->size) {
+                    Node* newNode = reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(iter) + blockSize);
+                    newNode->next = GetNext(iter);
+                    newNode->prev = iter;
+                    newNode->size = iter->size - blockSize;
+                    newNode->isFree = true;
+                    newNode->magic = kNodeMagic;
+
+                    iter->next = newNode;
+                    iter->size = size;
+                    if (Node* next = GetNext(newNode)) {
+                        next->prev = newNode;
+                    }
+                }
+                iter->isFree = false;
+                return GetPayload(iter);
+            }
+        }
+        return nullptr;
+    }
+
+    void* MallocR(size_t size) {
+        size = Align16(size);
+        const size_t blockSize = size + sizeof(Node);
+
+        for (Node* iter = GetLast(); iter != nullptr; iter = GetPrev(iter)) {
+            if (iter->isFree && iter->size >= size) {
+                if (blockSize < iter->size) {
+                    Node* newNode = reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(iter) + (iter->size - size));
+                    newNode->next = GetNext(iter);
+                    newNode->prev = iter;
+                    newNode->size = size;
+                    newNode->magic = kNodeMagic;
+
+                    iter->next = newNode;
+                    iter->size -= blockSize;
+                    if (Node* next = GetNext(newNode)) {
+                        next->prev = newNode;
+                    }
+                    iter = newNode;
+                }
+                iter->isFree = false;
+                return GetPayload(iter);
+            }
+        }
+        return nullptr;
+    }
+
+    void* Realloc(void* ptr, size_t newSize) {
+        newSize = Align16(newSize);
+        if (ptr == nullptr) {
+            return Malloc(newSize);
+        }
+        if (newSize == 0) {
+            Free(ptr);
+            return nullptr;
+        }
+
+        Node* node = GetNode(ptr);
+        if (node->size < newSize) {
+            Node* next = GetNext(node);
+            const size_t sizeDiff = newSize - node->size;
+            if (next != nullptr && IsAdjacent(node, next) && next->isFree && next->size >= sizeDiff) {
+                // Grow into the free block behind
+                next->size -= sizeDiff;
+                Node* newNext = reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(next) + sizeDiff);
+                if (Node* overNext = GetNext(next)) {
+                    overNext->prev = newNext;
+                }
+                node->next = newNext;
+                node->size = newSize;
+                memmove(newNext, next, sizeof(Node));
+            } else {
+                void* newAlloc = Malloc(newSize);
+                if (newAlloc != nullptr) {
+                    memcpy(newAlloc, ptr, node->size);
+                    Free(ptr);
+                }
+                ptr = newAlloc;
+            }
+        } else if (newSize < node->size) {
+            Node* next = GetNext(node);
+            Node* newNext = reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(node) + newSize + sizeof(Node));
+            if (next != nullptr && next->isFree) {
+                // Hand the freed tail to the free block behind
+                const Node copy = *next;
+                *newNext = copy;
+                newNext->size += node->size - newSize;
+            } else if (newSize + sizeof(Node) < node->size) {
+                newNext->next = next;
+                newNext->prev = node;
+                newNext->size = node->size - newSize - sizeof(Node);
+                newNext->isFree = true;
+                newNext->magic = kNodeMagic;
+            } else {
+                return nullptr;
+            }
+            node->next = newNext;
+            node->size = newSize;
+            if (Node* overNext = GetNext(newNext)) {
+                overNext->prev = newNext;
+            }
+        }
+        return ptr;
+    }
+
+    void Free(void* ptr) {
+        if (ptr == nullptr) {
+            return;
+        }
+        Node* node = GetNode(ptr);
+        if (node->magic != kNodeMagic || node->isFree) {
+            return;
+        }
+
+        Node* next = GetNext(node);
+        Node* prev = GetPrev(node);
+        node->isFree = true;
+
+        if (next != nullptr && IsAdjacent(node, next) && next->isFree) {
+            Node* newNext = GetNext(next);
+            if (newNext != nullptr) {
+                newNext->prev = node;
+            }
+            node->size += next->size + sizeof(Node);
+            node->next = newNext;
+            next = newNext;
+        }
+        if (prev != nullptr && prev->isFree && IsAdjacent(prev, node)) {
+            if (next != nullptr) {
+                next->prev = prev;
+            }
+            prev->next = next;
+            prev->size += node->size + sizeof(Node);
+        }
+    }
+
+    void GetSizes(u32* maxFree, u32* free, u32* allocated) {
+        *maxFree = 0;
+        *free = 0;
+        *allocated = 0;
+        for (Node* iter = mHead; iter != nullptr; iter = GetNext(iter)) {
+            if (iter->isFree) {
+                *free += iter->size;
+                *maxFree = std::max<u32>(*maxFree, iter->size);
+            } else {
+                *allocated += iter->size;
+            }
+        }
+    }
+
+  private:
+    struct Node {
+        s16 magic;
+        s16 isFree;
+        size_t size;
+        Node* next;
+        Node* prev;
+    };
+    static_assert(sizeof(Node) % 16 == 0, "Block payloads have to stay 16 byte aligned");
+
+    static constexpr s16 kNodeMagic = 0x7373;
+
+    static size_t Align16(size_t value) {
+        return (value + 0xF) & ~static_cast<size_t>(0xF);
+    }
+    static Node* GetNode(void* ptr) {
+        return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(ptr) - sizeof(Node));
+    }
+    static void* GetPayload(Node* node) {
+        return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(node) + sizeof(Node));
+    }
+    static Node* GetNext(Node* node) {
+        return node->next != nullptr && node->next->magic == kNodeMagic ? node->next : nullptr;
+    }
+    static Node* GetPrev(Node* node) {
+        return node->prev != nullptr && node->prev->magic == kNodeMagic ? node->prev : nullptr;
+    }
+    static bool IsAdjacent(Node* node, Node* next) {
+        return reinterpret_cast<uintptr_t>(next) == reinterpret_cast<uintptr_t>(node) + sizeof(Node) + node->size;
+    }
+    Node* GetLast() {
+        Node* last = mHead;
+        while (last != nullptr && GetNext(last) != nullptr) {
+            last = GetNext(last);
+        }
+        return last;
+    }
+
+    Node* mHead = nullptr;
+};
+
+// Runs the ops on a fresh arena. Measuring fragmentation walks every block after every op, so it is done in its own
+// run rather than the timed one.
+template <typename Allocator>
+ReplayStats RunReplay(const std::vector<ReplayOp>& ops, size_t slotCount, size_t arenaSize, bool measure) {
+    ReplayStats stats;
+    std::vector<uint8_t> memory(arenaSize);
+    std::vector<void*> slots(slotCount, nullptr);
+    Allocator arena(memory.data(), arenaSize);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const ReplayOp& op : ops) {
+        void* ptr = op.ptrSlot >= 0 ? slots[op.ptrSlot] : nullptr;
+        void* result = nullptr;
+        switch (op.op) {
+            case ARENA_TRACE_MALLOC:
+                result = arena.Malloc(op.size);
+                break;
+            case ARENA_TRACE_MALLOC_R:
+                result = arena.MallocR(op.size);
+                break;
+            case ARENA_TRACE_REALLOC:
+                result = arena.Realloc(ptr, op.size);
+                break;
+            case ARENA_TRACE_FREE:
+                arena.Free(ptr);
+                break;
+        }
+        if (op.resultSlot >= 0) {
+            slots[op.resultSlot] = result;
+            if (result == nullptr) {
+                stats.failed++;
+            }
+        }
+
+        if (measure) {
+            u32 maxFree;
+            u32 free;
+            u32 allocated;
+            arena.GetSizes(&maxFree, &free, &allocated);
+            if (free > 0) {
+                stats.peakFragmentation = std::max(stats.peakFragmentation, 1.0 - (double)maxFree / free);
+            }
+            stats.peakAllocated = std::max(stats.peakAllocated, allocated);
+        }
+    }
+    stats.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+std::string FormatStats(const char* name, const ReplayStats& timed, const ReplayStats& measured) {
+    return fmt::format("{}: {:.3f} ms, peak fragmentation {:.1f}%, peak allocated {} bytes, {} failed allocations",
+                       name, timed.ms, measured.peakFragmentation * 100.0, measured.peakAllocated, measured.failed);
+}
+
+} // namespace
+
+u8 gArenaTraceEnabled = false;
+
+extern "C" void ArenaBenchmark_Trace(ArenaTraceOp op, void* ptr, size_t size, void* result) {
+    WriteRecord(op, ptr, size, result);
+}
+
+bool ArenaBenchmark_StartTrace(const std::string& path) {
+    if (gArenaTraceEnabled || !__osMallocIsInitialized(&sZeldaArena)) {
+        return false;
+    }
+
+    sTraceFile.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!sTraceFile.is_open()) {
+        return false;
+    }
+
+    ArenaNode* last = ArenaImpl_GetLastBlock(&sZeldaArena);
+    ArenaTraceHeader header = { ARENA_TRACE_MAGIC, ARENA_TRACE_VERSION,
+                                (uintptr_t)last + sizeof(ArenaNode) + last->size - (uintptr_t)sZeldaArena.start };
+    sTraceFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    sTraceCount = 0;
+
+    // The blocks that are already live start the trace, in address order
+    for (ArenaNode* iter = sZeldaArena.head; iter != nullptr; iter = iter->next) {
+        if (!iter->isFree) {
+            WriteRecord(ARENA_TRACE_MALLOC, nullptr, iter->size, (void*)((uintptr_t)iter + sizeof(ArenaNode)));
+        }
+    }
+
+    gArenaTraceEnabled = true;
+    return true;
+}
+
+size_t ArenaBenchmark_StopTrace() {
+    gArenaTraceEnabled = false;
+    sTraceFile.close();
+    return sTraceCount;
+}
+
+bool ArenaBenchmark_IsTracing() {
+    return gArenaTraceEnabled;
+}
+
+bool ArenaBenchmark_Replay(const std::string& path, std::string& report) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        report = fmt::format("Could not open {}", path);
+        return false;
+    }
+
+    ArenaTraceHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != ARENA_TRACE_MAGIC || header.version != ARENA_TRACE_VERSION) {
+        report = fmt::format("{} is not an arena trace", path);
+        return false;
+    }
+
+    std::vector<ArenaTraceRecord> records;
+    ArenaTraceRecord record;
+    while (file.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        records.push_back(record);
+    }
+
+    size_t slotCount;
+    const std::vector<ReplayOp> ops = ResolveSlots(records, slotCount);
+    const ReplayStats timed = RunReplay<SizeClassArena>(ops, slotCount, header.arenaSize, false);
+    const ReplayStats measured = RunReplay<SizeClassArena>(ops, slotCount, header.arenaSize, true);
+    const ReplayStats firstFitTimed = RunReplay<FirstFitArena>(ops, slotCount, header.arenaSize, false);
+    const ReplayStats firstFitMeasured = RunReplay<FirstFitArena>(ops, slotCount, header.arenaSize, true);
+
+    report = fmt::format("{} ops. {}. {}.", ops.size(), FormatStats("Size classes", timed, measured),
+                         FormatStats("First fit", firstFitTimed, firstFitMeasured));
+    return true;
+}
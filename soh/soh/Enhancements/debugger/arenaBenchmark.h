@@ -0,0 +1,39 @@
+#pragma once
+
+// Allocation trace benchmark for the arena allocator. A trace records every allocation, reallocation and free of the
+// Zelda arena, starting with the blocks that are live when it starts. Replaying it runs the same operations on a
+// scratch arena of the same size and reports how long they took and the peak fragmentation, the share of free memory
+// outside of the largest free block, so allocator changes can be compared on the same recorded gameplay. Each trace is
+// replayed on both the size class allocator and the first fit allocator it replaced.
+
+#include <libultraship/libultra.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    ARENA_TRACE_MALLOC,
+    ARENA_TRACE_MALLOC_R,
+    ARENA_TRACE_REALLOC,
+    ARENA_TRACE_FREE,
+} ArenaTraceOp;
+
+extern u8 gArenaTraceEnabled;
+
+// ptr is the block passed to a realloc or free, result the block returned by a malloc or realloc
+void ArenaBenchmark_Trace(ArenaTraceOp op, void* ptr, size_t size, void* result);
+
+#ifdef __cplusplus
+}
+
+#include <string>
+
+// Needs an initialized Zelda arena
+bool ArenaBenchmark_StartTrace(const std::string& path);
+// Returns the number of recorded operations
+size_t ArenaBenchmark_StopTrace();
+bool ArenaBenchmark_IsTracing();
+// Replays a trace and writes a one line summary to report
+bool ArenaBenchmark_Replay(const std::string& path, std::string& report);
+#endif
@@ -6,6 +6,8 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include <algorithm>
+#include <unordered_map>
 #include "soh/OTRGlobals.h"
 #include "soh/Enhancements/game-interactor/GameInteractor.h"
 
@@ -369,82 +371,174 @@ void InitGfx(std::vector<Gfx>& gfx, ColRenderSetting setting) {
     gfx.push_back(gsDPSetEnvColor(0xFF, 0xFF, 0xFF, alpha));
 }
 
-// Draws a dynapoly structure (scenes or Bg Actors)
-void DrawDynapoly(std::vector<Gfx>& dl, CollisionHeader* col, int32_t bgId) {
-    Color_RGBA8 color = { 255, 255, 255, 255 };
+// Color classes a collision poly can fall into, resolved once per poly when its mesh is built
+enum ColPolyClass : uint8_t {
+    COL_POLY_HOOKSHOT,
+    COL_POLY_INTERACTABLE,
+    COL_POLY_VOID,
+    COL_POLY_ENTRANCE,
+    COL_POLY_SPECIAL_SURFACE,
+    COL_POLY_SLOPE,
+    COL_POLY_NORMAL,
+    COL_POLY_CLASS_MAX,
+};
 
-    uint32_t lastColorR = color.r;
-    uint32_t lastColorG = color.g;
-    uint32_t lastColorB = color.b;
+static const struct {
+    const char* cvar;
+    Color_RGBA8 defaultColor;
+} sPolyClassColorCVars[COL_POLY_CLASS_MAX] = {
+    { CVAR_DEVELOPER_TOOLS("ColViewer.ColorHookshot.Value"), { 128, 128, 255, 255 } },
+    { CVAR_DEVELOPER_TOOLS("ColViewer.ColorInteractable.Value"), { 192, 0, 192, 255 } },
+    { CVAR_DEVELOPER_TOOLS("ColViewer.ColorVoid.Value"), { 255, 0, 0, 255 } },
+    { CVAR_DEVELOPER_TOOLS("ColViewer.ColorEntrance.Value"), { 0, 255, 0, 255 } },
+    { CVAR_DEVELOPER_TOOLS("ColViewer.ColorSpecialSurface.Value"), { 192, 255, 192, 255 } },
+    { CVAR_DEVELOPER_TOOLS("ColViewer.ColorSlope.Value"), { 255, 255, 128, 255 } },
+    { CVAR_DEVELOPER_TOOLS("ColViewer.ColorNormal.Value"), { 255, 255, 255, 255 } },
+};
 
-    dl.push_back(gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
+static Color_RGBA8 sPolyClassColors[COL_POLY_CLASS_MAX];
+// Bumped whenever one of the poly colors changes, meshes built for an older generation get recolored
+static uint32_t sPolyColorGeneration = 1;
+
+// The collision of one CollisionHeader, built once and drawn by reference every frame. The vertices are final before
+// the display list referencing them is built, so the gsSPVertex pointers stay valid for the lifetime of the mesh.
+struct ColMesh {
+    CollisionHeader* header = nullptr;
+    std::vector<Vtx> vtx;
+    std::vector<Gfx> gfx;
+    // Display list index of each gsDPSetPrimColor and the poly class it colors
+    std::vector<std::pair<size_t, ColPolyClass>> colorCmds;
+    uint32_t colorGeneration = 0;
+    bool used = false;
+};
 
-    // This keeps track of if we have processed a poly, but not drawn it yet so we can batch them.
-    // This saves several hundred commands in larger scenes
-    bool previousPoly = false;
-
-    for (int i = 0; i < col->numPolygons; i++) {
-        CollisionPoly* poly = &col->polyList[i];
-
-        if (SurfaceType_IsHookshotSurface(&gPlayState->colCtx, poly, bgId)) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorHookshot.Value"), { 128, 128, 255, 255 });
-        } else if (func_80041D94(&gPlayState->colCtx, poly, bgId) > 0x01) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorInteractable.Value"), { 192, 0, 192, 255 });
-        } else if (func_80041E80(&gPlayState->colCtx, poly, bgId) == 0x0C) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorVoid.Value"), { 255, 0, 0, 255 });
-        } else if (SurfaceType_GetSceneExitIndex(&gPlayState->colCtx, poly, bgId) ||
-                   func_80041E80(&gPlayState->colCtx, poly, bgId) == 0x05) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorEntrance.Value"), { 0, 255, 0, 255 });
-        } else if (func_80041D4C(&gPlayState->colCtx, poly, bgId) != 0 ||
-                   SurfaceType_IsWallDamage(&gPlayState->colCtx, poly, bgId)) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorSpecialSurface.Value"), { 192, 255, 192, 255 });
-        } else if (SurfaceType_GetSlope(&gPlayState->colCtx, poly, bgId) == 0x01) {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorSlope.Value"), { 255, 255, 128, 255 });
-        } else {
-            color = CVarGetColor(CVAR_DEVELOPER_TOOLS("ColViewer.ColorNormal.Value"), { 255, 255, 255, 255 });
+static ColMesh sSceneMesh;
+// Shared by every Bg Actor using the same collision, dropped once no Bg Actor draws them anymore
+static std::unordered_map<CollisionHeader*, ColMesh> sBgActorMeshes;
+
+// Bg Actor model matrices, only recomputed when the transform DynaPoly_ExpandSRT left in curTransform changes
+static struct {
+    ScaleRotPos transform;
+    Mtx mtx;
+    bool valid;
+} sBgActorTransforms[BG_ACTOR_MAX];
+
+ColPolyClass ClassifyPoly(CollisionPoly* poly, int32_t bgId) {
+    if (SurfaceType_IsHookshotSurface(&gPlayState->colCtx, poly, bgId)) {
+        return COL_POLY_HOOKSHOT;
+    } else if (func_80041D94(&gPlayState->colCtx, poly, bgId) > 0x01) {
+        return COL_POLY_INTERACTABLE;
+    } else if (func_80041E80(&gPlayState->colCtx, poly, bgId) == 0x0C) {
+        return COL_POLY_VOID;
+    } else if (SurfaceType_GetSceneExitIndex(&gPlayState->colCtx, poly, bgId) ||
+               func_80041E80(&gPlayState->colCtx, poly, bgId) == 0x05) {
+        return COL_POLY_ENTRANCE;
+    } else if (func_80041D4C(&gPlayState->colCtx, poly, bgId) != 0 ||
+               SurfaceType_IsWallDamage(&gPlayState->colCtx, poly, bgId)) {
+        return COL_POLY_SPECIAL_SURFACE;
+    } else if (SurfaceType_GetSlope(&gPlayState->colCtx, poly, bgId) == 0x01) {
+        return COL_POLY_SLOPE;
+    }
+    return COL_POLY_NORMAL;
+}
+
+// Reads the poly colors once per frame instead of once per poly
+void UpdatePolyColors() {
+    for (int32_t i = 0; i < COL_POLY_CLASS_MAX; i++) {
+        Color_RGBA8 color = CVarGetColor(sPolyClassColorCVars[i].cvar, sPolyClassColorCVars[i].defaultColor);
+        if (color.r != sPolyClassColors[i].r || color.g != sPolyClassColors[i].g ||
+            color.b != sPolyClassColors[i].b) {
+            sPolyClassColors[i] = color;
+            sPolyColorGeneration++;
         }
+    }
+}
 
-        if (color.r != lastColorR || color.g != lastColorG || color.b != lastColorB) {
-            // Color changed, flush previous poly
-            if (previousPoly) {
-                dl.push_back(gsSPVertex((uintptr_t)&vtxDl.at(vtxDl.size() - 3), 3, 0));
-                dl.push_back(gsSP1Triangle(0, 1, 2, 0));
-                previousPoly = false;
+// Patches the prim colors of a mesh built with older colors, the geometry is left as is
+void RecolorMesh(ColMesh& mesh) {
+    if (mesh.colorGeneration == sPolyColorGeneration) {
+        return;
+    }
+
+    for (const auto& [cmd, polyClass] : mesh.colorCmds) {
+        const Color_RGBA8& color = sPolyClassColors[polyClass];
+        mesh.gfx[cmd] = gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255);
+    }
+    mesh.colorGeneration = sPolyColorGeneration;
+}
+
+// Builds the mesh of a dynapoly structure (scenes or Bg Actors). Polys are grouped by class so each color is only set
+// once, and are loaded up to ten at a time.
+void BuildColMesh(ColMesh& mesh, CollisionHeader* col, int32_t bgId) {
+    constexpr int32_t POLYS_PER_LOAD = 10;
+
+    mesh.header = col;
+    mesh.vtx.clear();
+    mesh.gfx.clear();
+    mesh.colorCmds.clear();
+    mesh.colorGeneration = 0;
+
+    std::vector<ColPolyClass> polyClasses(col->numPolygons);
+    int32_t classCounts[COL_POLY_CLASS_MAX] = {};
+    for (int32_t i = 0; i < col->numPolygons; i++) {
+        polyClasses[i] = ClassifyPoly(&col->polyList[i], bgId);
+        classCounts[polyClasses[i]]++;
+    }
+
+    mesh.vtx.reserve(col->numPolygons * 3);
+    for (int32_t polyClass = 0; polyClass < COL_POLY_CLASS_MAX; polyClass++) {
+        for (int32_t i = 0; i < col->numPolygons; i++) {
+            if (polyClasses[i] != polyClass) {
+                continue;
             }
-            dl.push_back(gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
+
+            CollisionPoly* poly = &col->polyList[i];
+            signed char nx = poly->normal.x / 0x100;
+            signed char ny = poly->normal.y / 0x100;
+            signed char nz = poly->normal.z / 0x100;
+            Vec3s* va = &col->vtxList[COLPOLY_VTX_INDEX(poly->flags_vIA)];
+            Vec3s* vb = &col->vtxList[COLPOLY_VTX_INDEX(poly->flags_vIB)];
+            Vec3s* vc = &col->vtxList[COLPOLY_VTX_INDEX(poly->vIC)];
+            mesh.vtx.push_back(gdSPDefVtxN(va->x, va->y, va->z, 0, 0, nx, ny, nz, 0xFF));
+            mesh.vtx.push_back(gdSPDefVtxN(vb->x, vb->y, vb->z, 0, 0, nx, ny, nz, 0xFF));
+            mesh.vtx.push_back(gdSPDefVtxN(vc->x, vc->y, vc->z, 0, 0, nx, ny, nz, 0xFF));
         }
-        lastColorR = color.r;
-        lastColorG = color.g;
-        lastColorB = color.b;
-
-        Vec3s* va = &col->vtxList[COLPOLY_VTX_INDEX(poly->flags_vIA)];
-        Vec3s* vb = &col->vtxList[COLPOLY_VTX_INDEX(poly->flags_vIB)];
-        Vec3s* vc = &col->vtxList[COLPOLY_VTX_INDEX(poly->vIC)];
-        vtxDl.push_back(gdSPDefVtxN(va->x, va->y, va->z, 0, 0, (signed char)(poly->normal.x / 0x100),
-                                    (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
-                                    0xFF));
-        vtxDl.push_back(gdSPDefVtxN(vb->x, vb->y, vb->z, 0, 0, (signed char)(poly->normal.x / 0x100),
-                                    (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
-                                    0xFF));
-        vtxDl.push_back(gdSPDefVtxN(vc->x, vc->y, vc->z, 0, 0, (signed char)(poly->normal.x / 0x100),
-                                    (signed char)(poly->normal.y / 0x100), (signed char)(poly->normal.z / 0x100),
-                                    0xFF));
-
-        if (previousPoly) {
-            dl.push_back(gsSPVertex((uintptr_t)&vtxDl.at(vtxDl.size() - 6), 6, 0));
-            dl.push_back(gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0));
-            previousPoly = false;
-        } else {
-            previousPoly = true;
+    }
+
+    int32_t firstPoly = 0;
+    for (int32_t polyClass = 0; polyClass < COL_POLY_CLASS_MAX; polyClass++) {
+        if (classCounts[polyClass] == 0) {
+            continue;
         }
+
+        mesh.colorCmds.emplace_back(mesh.gfx.size(), (ColPolyClass)polyClass);
+        mesh.gfx.push_back(gsDPSetPrimColor(0, 0, 255, 255, 255, 255));
+
+        for (int32_t done = 0; done < classCounts[polyClass]; done += POLYS_PER_LOAD) {
+            int32_t count = std::min(POLYS_PER_LOAD, classCounts[polyClass] - done);
+            mesh.gfx.push_back(gsSPVertex((uintptr_t)&mesh.vtx[(firstPoly + done) * 3], count * 3, 0));
+            for (int32_t tri = 0; tri + 1 < count; tri += 2) {
+                mesh.gfx.push_back(
+                    gsSP2Triangles(tri * 3, tri * 3 + 1, tri * 3 + 2, 0, tri * 3 + 3, tri * 3 + 4, tri * 3 + 5, 0));
+            }
+            if (count % 2 != 0) {
+                mesh.gfx.push_back(gsSP1Triangle(count * 3 - 3, count * 3 - 2, count * 3 - 1, 0));
+            }
+        }
+        firstPoly += classCounts[polyClass];
     }
 
-    // Flush previous poly if this is the end and there's no more coming
-    if (previousPoly) {
-        dl.push_back(gsSPVertex((uintptr_t)&vtxDl.at(vtxDl.size() - 3), 3, 0));
-        dl.push_back(gsSP1Triangle(0, 1, 2, 0));
-        previousPoly = false;
+    mesh.gfx.push_back(gsSPEndDisplayList());
+}
+
+// Returns the mesh to draw a collision header with, building it the first time the header is seen
+ColMesh& GetColMesh(ColMesh& mesh, CollisionHeader* col, int32_t bgId) {
+    if (mesh.header != col) {
+        BuildColMesh(mesh, col, bgId);
     }
+    RecolorMesh(mesh);
+    mesh.used = true;
+    return mesh;
 }
 
 // Draws the scene
@@ -460,7 +554,13 @@ void DrawSceneCollision() {
     InitGfx(dl, showSceneColSetting);
     dl.push_back(gsSPMatrix(&gMtxClear, G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH));
 
-    DrawDynapoly(dl, gPlayState->colCtx.colHeader, BGCHECK_SCENE);
+    ColMesh& mesh = GetColMesh(sSceneMesh, gPlayState->colCtx.colHeader, BGCHECK_SCENE);
+    dl.push_back(gsSPDisplayList(mesh.gfx.data()));
+}
+
+bool TransformEquals(const ScaleRotPos& a, const ScaleRotPos& b) {
+    return a.scale.x == b.scale.x && a.scale.y == b.scale.y && a.scale.z == b.scale.z && a.rot.x == b.rot.x &&
+           a.rot.y == b.rot.y && a.rot.z == b.rot.z && a.pos.x == b.pos.x && a.pos.y == b.pos.y && a.pos.z == b.pos.z;
 }
 
 // Draws all Bg Actors
@@ -478,23 +578,75 @@ void DrawBgActorCollision() {
     for (int32_t bgIndex = 0; bgIndex < BG_ACTOR_MAX; bgIndex++) {
         if (gPlayState->colCtx.dyna.bgActorFlags[bgIndex] & 1) {
             BgActor& bg = gPlayState->colCtx.dyna.bgActors[bgIndex];
-            Mtx m;
-            MtxF mf;
-            SkinMatrix_SetTranslateRotateYXZScale(&mf, bg.curTransform.scale.x, bg.curTransform.scale.y,
-                                                  bg.curTransform.scale.z, bg.curTransform.rot.x, bg.curTransform.rot.y,
-                                                  bg.curTransform.rot.z, bg.curTransform.pos.x, bg.curTransform.pos.y,
-                                                  bg.curTransform.pos.z);
-            guMtxF2L(mf.mf, &m);
-            mtxDl.push_back(m);
-            dl.push_back(gsSPMatrix(&mtxDl.back(), G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_PUSH));
-
-            DrawDynapoly(dl, bg.colHeader, bgIndex);
+            auto& transform = sBgActorTransforms[bgIndex];
+            if (!transform.valid || !TransformEquals(transform.transform, bg.curTransform)) {
+                MtxF mf;
+                SkinMatrix_SetTranslateRotateYXZScale(
+                    &mf, bg.curTransform.scale.x, bg.curTransform.scale.y, bg.curTransform.scale.z,
+                    bg.curTransform.rot.x, bg.curTransform.rot.y, bg.curTransform.rot.z, bg.curTransform.pos.x,
+                    bg.curTransform.pos.y, bg.curTransform.pos.z);
+                guMtxF2L(mf.mf, &transform.mtx);
+                transform.transform = bg.curTransform;
+                transform.valid = true;
+            }
 
+            ColMesh& mesh = GetColMesh(sBgActorMeshes[bg.colHeader], bg.colHeader, bgIndex);
+            dl.push_back(gsSPMatrix(&transform.mtx, G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_PUSH));
+            dl.push_back(gsSPDisplayList(mesh.gfx.data()));
             dl.push_back(gsSPPopMatrix(G_MTX_MODELVIEW));
         }
     }
 }
 
+// Drops the meshes of collision that wasn't drawn this frame, so freed headers are never looked at again
+void SweepColMeshes() {
+    if (!sSceneMesh.used) {
+        sSceneMesh = ColMesh();
+    }
+    sSceneMesh.used = false;
+
+    for (auto it = sBgActorMeshes.begin(); it != sBgActorMeshes.end();) {
+        if (!it->second.used) {
+            it = sBgActorMeshes.erase(it);
+        } else {
+            it->second.used = false;
+            ++it;
+        }
+    }
+}
+
+// The per-frame lists below only learn where their vertices and matrices end up once drawing is done, so commands
+// referencing them are pushed as placeholders and patched in ResolveFrameRefs
+struct FrameRef {
+    std::vector<Gfx>* dl;
+    size_t cmd;
+    size_t index;
+    uint8_t count;
+};
+
+static std::vector<FrameRef> vtxRefs;
+static std::vector<FrameRef> mtxRefs;
+
+void PushFrameVertices(std::vector<Gfx>& dl, size_t vtxIndex, uint8_t count) {
+    vtxRefs.push_back({ &dl, dl.size(), vtxIndex, count });
+    dl.push_back(gsDPNoOp());
+}
+
+void PushFrameMatrix(std::vector<Gfx>& dl, const Mtx& m) {
+    mtxRefs.push_back({ &dl, dl.size(), mtxDl.size(), 0 });
+    mtxDl.push_back(m);
+    dl.push_back(gsDPNoOp());
+}
+
+void ResolveFrameRefs() {
+    for (const FrameRef& ref : vtxRefs) {
+        (*ref.dl)[ref.cmd] = gsSPVertex((uintptr_t)&vtxDl[ref.index], ref.count, 0);
+    }
+    for (const FrameRef& ref : mtxRefs) {
+        (*ref.dl)[ref.cmd] = gsSPMatrix(&mtxDl[ref.index], G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_PUSH);
+    }
+}
+
 // Draws a quad
 void DrawQuad(std::vector<Gfx>& dl, Vec3f& v0, Vec3f& v1, Vec3f& v2, Vec3f& v3) {
     Vec3f norm;
@@ -508,7 +660,7 @@ void DrawQuad(std::vector<Gfx>& dl, Vec3f& v0, Vec3f& v1, Vec3f& v2, Vec3f& v3)
                                 (signed char)norm.z, 0xFF));
     vtxDl.push_back(gdSPDefVtxN((short)v3.x, (short)v3.y, (short)v3.z, 0, 0, (signed char)norm.x, (signed char)norm.y,
                                 (signed char)norm.z, 0xFF));
-    dl.push_back(gsSPVertex((uintptr_t)&vtxDl.at(vtxDl.size() - 4), 4, 0));
+    PushFrameVertices(dl, vtxDl.size() - 4, 4);
     dl.push_back(gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0));
 }
 
@@ -533,9 +685,8 @@ void DrawColCheckList(std::vector<Gfx>& dl, Collider** objects, int32_t count) {
                     MtxF dest;
                     SkinMatrix_MtxFMtxFMult(&mf, &ms, &dest);
                     guMtxF2L(dest.mf, &m);
-                    mtxDl.push_back(m);
 
-                    dl.push_back(gsSPMatrix(&mtxDl.back(), G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_PUSH));
+                    PushFrameMatrix(dl, m);
                     dl.push_back(gsSPDisplayList(sphereGfx.data()));
                     dl.push_back(gsSPPopMatrix(G_MTX_MODELVIEW));
                 }
@@ -552,9 +703,8 @@ void DrawColCheckList(std::vector<Gfx>& dl, Collider** objects, int32_t count) {
                 MtxF dest;
                 SkinMatrix_MtxFMtxFMult(&mt, &ms, &dest);
                 guMtxF2L(dest.mf, &m);
-                mtxDl.push_back(m);
 
-                dl.push_back(gsSPMatrix(&mtxDl.back(), G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_PUSH));
+                PushFrameMatrix(dl, m);
                 dl.push_back(gsSPDisplayList(cylinderGfx.data()));
                 dl.push_back(gsSPPopMatrix(G_MTX_MODELVIEW));
             } break;
@@ -575,7 +725,7 @@ void DrawColCheckList(std::vector<Gfx>& dl, Collider** objects, int32_t count) {
                                                 (short)tri->dim.vtx[2].z, 0, 0, (signed char)tri->dim.plane.normal.x,
                                                 (signed char)tri->dim.plane.normal.y,
                                                 (signed char)tri->dim.plane.normal.z, 0xFF));
-                    dl.push_back(gsSPVertex((uintptr_t)&vtxDl.at(vtxDl.size() - 3), 3, 0));
+                    PushFrameVertices(dl, vtxDl.size() - 3, 3);
                     dl.push_back(gsSP1Triangle(0, 1, 2, 0));
                 }
             } break;
@@ -670,13 +820,12 @@ void DrawWaterboxList() {
     }
 }
 
-// Resets a vector for the next frame and returns the capacity
-template <typename T> size_t ResetVector(T& vec) {
+// Resets a vector for the next frame
+template <typename T> void ResetVector(T& vec) {
     size_t oldSize = vec.size();
     vec.clear();
     // Reserve slightly more space than last frame to account for variance (such as different amounts of bg actors)
     vec.reserve(oldSize * 1.2);
-    return vec.capacity();
 }
 
 extern "C" void DrawColViewer() {
@@ -686,34 +835,20 @@ extern "C" void DrawColViewer() {
 
     ResetVector(opaDl);
     ResetVector(xluDl);
-    size_t vtxDlCapacity = ResetVector(vtxDl);
-    size_t mtxDlCapacity = ResetVector(mtxDl);
+    ResetVector(vtxDl);
+    ResetVector(mtxDl);
+    vtxRefs.clear();
+    mtxRefs.clear();
+
+    UpdatePolyColors();
 
     DrawSceneCollision();
     DrawBgActorCollision();
     DrawColCheckCollision();
     DrawWaterboxList();
 
-    // Check if we used up more space than we reserved. If so, redo the drawing with our new sizes.
-    // This is because we resized the vectors while drawing, invalidating pointers to them.
-    // This only matters for the Vtx and Mtx vectors.
-    if ((vtxDl.size() > vtxDlCapacity) || (mtxDl.size() > mtxDlCapacity)) {
-        ResetVector(opaDl);
-        ResetVector(xluDl);
-        vtxDlCapacity = ResetVector(vtxDl);
-        mtxDlCapacity = ResetVector(mtxDl);
-
-        DrawSceneCollision();
-        DrawBgActorCollision();
-        DrawColCheckCollision();
-        DrawWaterboxList();
-    }
-
-    if ((vtxDl.size() > vtxDlCapacity) || (mtxDl.size() > mtxDlCapacity)) {
-        // If the sizes somehow changed between the two draws, we can't continue because we may be using invalid data
-        printf("Error drawing collision, vertex/matrix sizes didn't settle.\n");
-        return;
-    }
+    SweepColMeshes();
+    ResolveFrameRefs();
 
     OPEN_DISPS(gPlayState->state.gfxCtx);
 
@@ -743,4 +878,12 @@ void ColViewerWindow::InitElement() {
     CreateSphereData();
 
     GameInteractor::Instance->RegisterGameHook<GameInteractor::OnPlayDrawEnd>(DrawColViewer);
+    // Collision headers of the previous scene may be freed or reused by the next one
+    GameInteractor::Instance->RegisterGameHook<GameInteractor::OnSceneInit>([](int16_t sceneNum) {
+        sSceneMesh = ColMesh();
+        sBgActorMeshes.clear();
+        for (auto& transform : sBgActorTransforms) {
+            transform.valid = false;
+        }
+    });
 }
@@ -0,0 +1,293 @@
+#include "frameProfiler.h"
+
+#ifdef ENABLE_FRAME_PROFILER
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <libultraship/libultraship.h>
+#include "soh/cvar_prefixes.h"
+
+#define FRAME_PROFILER_RING_SIZE 8192
+#define FRAME_PROFILER_MAX_DEPTH 64
+#define FRAME_PROFILER_HISTORY 120
+#define FRAME_PROFILER_DEFAULT_EXPORT_FRAMES 600
+
+namespace {
+
+struct ZoneRecord {
+    const char* name;
+    int64_t beginNs;
+    int64_t endNs;
+};
+
+// Single producer (the owning thread), single consumer (FrameProfiler_EndFrame on the game thread)
+struct ThreadRing {
+    std::array<ZoneRecord, FRAME_PROFILER_RING_SIZE> records;
+    std::atomic<uint32_t> head = 0;
+    std::atomic<uint32_t> tail = 0;
+    std::atomic<uint64_t> dropped = 0;
+    uint32_t threadIndex = 0;
+
+    // Open zones, only touched by the owning thread
+    std::array<const char*, FRAME_PROFILER_MAX_DEPTH> openNames;
+    std::array<int64_t, FRAME_PROFILER_MAX_DEPTH> openBeginNs;
+    uint32_t depth = 0;
+};
+
+struct ZoneHistory {
+    std::array<double, FRAME_PROFILER_HISTORY> frameMs = {};
+    std::array<uint32_t, FRAME_PROFILER_HISTORY> frameCalls = {};
+    double currentMs = 0.0;
+    uint32_t currentCalls = 0;
+};
+
+std::mutex sRingsMutex;
+std::vector<std::unique_ptr<ThreadRing>> sRings;
+
+std::unordered_map<const char*, ZoneHistory> sZoneHistory;
+uint32_t sHistoryIndex = 0;
+uint32_t sHistoryCount = 0;
+std::mutex sStatsMutex;
+
+FrameProfilerExportMode sExportMode = FRAME_PROFILER_EXPORT_NONE;
+int32_t sExportFrames = 0;
+int32_t sExportFramesRemaining = 0;
+std::vector<std::pair<uint32_t, ZoneRecord>> sExportRecords;
+
+thread_local ThreadRing* tRing = nullptr;
+
+inline int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+ThreadRing* GetThreadRing() {
+    if (tRing == nullptr) {
+        std::lock_guard<std::mutex> lock(sRingsMutex);
+        sRings.push_back(std::make_unique<ThreadRing>());
+        tRing = sRings.back().get();
+        tRing->threadIndex = static_cast<uint32_t>(sRings.size());
+    }
+    return tRing;
+}
+
+void WriteChromeTrace(const std::string& path) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        SPDLOG_ERROR("[FrameProfiler] Could not open {}", path);
+        return;
+    }
+
+    int64_t origin = sExportRecords.empty() ? 0 : sExportRecords.front().second.beginNs;
+    for (const auto& [threadIndex, record] : sExportRecords) {
+        origin = std::min(origin, record.beginNs);
+    }
+
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& [threadIndex, record] : sExportRecords) {
+        out << (first ? "\n" : ",\n");
+        out << "{\"name\":\"" << record.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadIndex
+            << ",\"ts\":" << (record.beginNs - origin) / 1000.0 << ",\"dur\":" << (record.endNs - record.beginNs) / 1000.0
+            << "}";
+        first = false;
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void WriteCsvSummary(const std::string& path, uint32_t frames) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        SPDLOG_ERROR("[FrameProfiler] Could not open {}", path);
+        return;
+    }
+
+    struct Summary {
+        uint64_t calls = 0;
+        double totalMs = 0.0;
+        double maxMs = 0.0;
+    };
+    std::unordered_map<const char*, Summary> summaries;
+    for (const auto& [threadIndex, record] : sExportRecords) {
+        Summary& summary = summaries[record.name];
+        double ms = (record.endNs - record.beginNs) / 1000000.0;
+        summary.calls++;
+        summary.totalMs += ms;
+        summary.maxMs = std::max(summary.maxMs, ms);
+    }
+
+    out << "zone,calls,total_ms,avg_ms_per_call,avg_ms_per_frame,max_ms\n";
+    for (const auto& [name, summary] : summaries) {
+        out << name << "," << summary.calls << "," << summary.totalMs << "," << summary.totalMs / summary.calls << ","
+            << summary.totalMs / std::max<uint32_t>(frames, 1) << "," << summary.maxMs << "\n";
+    }
+}
+
+void FinishExport(uint32_t frames) {
+    if (sExportMode == FRAME_PROFILER_EXPORT_CHROME_TRACE) {
+        std::string path = Ship::Context::GetPathRelativeToAppDirectory("frame_profile.json");
+        WriteChromeTrace(path);
+        SPDLOG_INFO("[FrameProfiler] Wrote {} zones over {} frames to {}", sExportRecords.size(), frames, path);
+    } else if (sExportMode == FRAME_PROFILER_EXPORT_CSV) {
+        std::string path = Ship::Context::GetPathRelativeToAppDirectory("frame_profile.csv");
+        WriteCsvSummary(path, frames);
+        SPDLOG_INFO("[FrameProfiler] Wrote summary of {} frames to {}", frames, path);
+    }
+
+    sExportRecords.clear();
+    sExportRecords.shrink_to_fit();
+    sExportMode = FRAME_PROFILER_EXPORT_NONE;
+    CVarClear(CVAR_DEVELOPER_TOOLS("FrameProfiler.Export"));
+}
+
+} // namespace
+
+extern "C" void FrameProfiler_BeginZone(const char* name) {
+    ThreadRing* ring = GetThreadRing();
+    if (ring->depth < FRAME_PROFILER_MAX_DEPTH) {
+        ring->openNames[ring->depth] = name;
+        ring->openBeginNs[ring->depth] = NowNs();
+    }
+    ring->depth++;
+}
+
+extern "C" void FrameProfiler_EndZone(void) {
+    ThreadRing* ring = tRing;
+    if (ring == nullptr || ring->depth == 0) {
+        return;
+    }
+    ring->depth--;
+    if (ring->depth >= FRAME_PROFILER_MAX_DEPTH) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    uint32_t head = ring->head.load(std::memory_order_relaxed);
+    if (head - ring->tail.load(std::memory_order_acquire) >= FRAME_PROFILER_RING_SIZE) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ZoneRecord& record = ring->records[head % FRAME_PROFILER_RING_SIZE];
+    record.name = ring->openNames[ring->depth];
+    record.beginNs = ring->openBeginNs[ring->depth];
+    record.endNs = NowNs();
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+extern "C" void FrameProfiler_EndFrame(void) {
+    int32_t exportCVar = CVarGetInteger(CVAR_DEVELOPER_TOOLS("FrameProfiler.Export"), FRAME_PROFILER_EXPORT_NONE);
+    if (sExportMode == FRAME_PROFILER_EXPORT_NONE && exportCVar != FRAME_PROFILER_EXPORT_NONE) {
+        sExportMode = static_cast<FrameProfilerExportMode>(exportCVar);
+        sExportFrames = std::max(
+            1, CVarGetInteger(CVAR_DEVELOPER_TOOLS("FrameProfiler.ExportFrames"), FRAME_PROFILER_DEFAULT_EXPORT_FRAMES));
+        sExportFramesRemaining = sExportFrames;
+    }
+
+    std::lock_guard<std::mutex> statsLock(sStatsMutex);
+    {
+        std::lock_guard<std::mutex> lock(sRingsMutex);
+        for (auto& ring : sRings) {
+            uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+            uint32_t head = ring->head.load(std::memory_order_acquire);
+            for (; tail != head; tail++) {
+                const ZoneRecord& record = ring->records[tail % FRAME_PROFILER_RING_SIZE];
+                ZoneHistory& history = sZoneHistory[record.name];
+                history.currentMs += (record.endNs - record.beginNs) / 1000000.0;
+                history.currentCalls++;
+                if (sExportMode != FRAME_PROFILER_EXPORT_NONE) {
+                    sExportRecords.emplace_back(ring->threadIndex, record);
+                }
+            }
+            ring->tail.store(tail, std::memory_order_release);
+        }
+    }
+
+    for (auto& [name, history] : sZoneHistory) {
+        history.frameMs[sHistoryIndex] = history.currentMs;
+        history.frameCalls[sHistoryIndex] = history.currentCalls;
+        history.currentMs = 0.0;
+        history.currentCalls = 0;
+    }
+    sHistoryIndex = (sHistoryIndex + 1) % FRAME_PROFILER_HISTORY;
+    sHistoryCount = std::min<uint32_t>(sHistoryCount + 1, FRAME_PROFILER_HISTORY);
+
+    if (sExportMode != FRAME_PROFILER_EXPORT_NONE && --sExportFramesRemaining <= 0) {
+        FinishExport(sExportFrames);
+    }
+}
+
+std::vector<FrameProfilerZoneStats> FrameProfiler_GetZoneStats() {
+    std::vector<FrameProfilerZoneStats> stats;
+    std::lock_guard<std::mutex> lock(sStatsMutex);
+    if (sHistoryCount == 0) {
+        return stats;
+    }
+
+    stats.reserve(sZoneHistory.size());
+    for (const auto& [name, history] : sZoneHistory) {
+        FrameProfilerZoneStats zone = { name, 0.0, 0.0, 0.0 };
+        for (uint32_t i = 0; i < sHistoryCount; i++) {
+            zone.averageMs += history.frameMs[i];
+            zone.averageCalls += history.frameCalls[i];
+            zone.maxMs = std::max(zone.maxMs, history.frameMs[i]);
+        }
+        zone.averageMs /= sHistoryCount;
+        zone.averageCalls /= sHistoryCount;
+        stats.push_back(zone);
+    }
+
+    std::sort(stats.begin(), stats.end(), [](const FrameProfilerZoneStats& a, const FrameProfilerZoneStats& b) {
+        return a.averageMs > b.averageMs;
+    });
+    return stats;
+}
+
+uint64_t FrameProfiler_GetDroppedZones() {
+    std::lock_guard<std::mutex> lock(sRingsMutex);
+    uint64_t dropped = 0;
+    for (const auto& ring : sRings) {
+        dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+bool FrameProfiler_ParseArg(const char* arg) {
+    static const struct {
+        const char* flag;
+        FrameProfilerExportMode mode;
+    } sFlags[] = {
+        { "--profile-trace", FRAME_PROFILER_EXPORT_CHROME_TRACE },
+        { "--profile-csv", FRAME_PROFILER_EXPORT_CSV },
+    };
+
+    for (const auto& entry : sFlags) {
+        size_t len = strlen(entry.flag);
+        if (strncmp(arg, entry.flag, len) != 0 || (arg[len] != '\0' && arg[len] != '=')) {
+            continue;
+        }
+
+        int32_t frames = FRAME_PROFILER_DEFAULT_EXPORT_FRAMES;
+        if (arg[len] == '=') {
+            frames = std::max(1, atoi(arg + len + 1));
+        }
+        // CVars are not loaded yet, so the request is armed directly and picked up on the first frame
+        sExportMode = entry.mode;
+        sExportFrames = frames;
+        sExportFramesRemaining = frames;
+        return true;
+    }
+    return false;
+}
+
+#endif
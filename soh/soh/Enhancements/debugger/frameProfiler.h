@@ -0,0 +1,68 @@
+#pragma once
+
+// Scoped-zone frame profiler. Zones are recorded into a per-thread ring buffer and aggregated once per frame by
+// FrameProfiler_EndFrame. Everything here compiles away unless the build defines ENABLE_FRAME_PROFILER.
+
+#ifdef ENABLE_FRAME_PROFILER
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void FrameProfiler_BeginZone(const char* name);
+void FrameProfiler_EndZone(void);
+void FrameProfiler_EndFrame(void);
+#ifdef __cplusplus
+}
+#endif
+
+#define FRAME_PROFILER_BEGIN(name) FrameProfiler_BeginZone(name)
+#define FRAME_PROFILER_END() FrameProfiler_EndZone()
+#define FRAME_PROFILER_END_FRAME() FrameProfiler_EndFrame()
+
+#ifdef __cplusplus
+#include <cstdint>
+#include <vector>
+
+struct FrameProfilerScope {
+    explicit FrameProfilerScope(const char* name) {
+        FrameProfiler_BeginZone(name);
+    }
+    ~FrameProfilerScope() {
+        FrameProfiler_EndZone();
+    }
+    FrameProfilerScope(const FrameProfilerScope&) = delete;
+    FrameProfilerScope& operator=(const FrameProfilerScope&) = delete;
+};
+
+#define FRAME_PROFILER_CONCAT_IMPL(a, b) a##b
+#define FRAME_PROFILER_CONCAT(a, b) FRAME_PROFILER_CONCAT_IMPL(a, b)
+#define FRAME_PROFILER_SCOPE(name) FrameProfilerScope FRAME_PROFILER_CONCAT(frameProfilerScope_, __LINE__)(name)
+
+typedef enum {
+    FRAME_PROFILER_EXPORT_NONE,
+    FRAME_PROFILER_EXPORT_CHROME_TRACE,
+    FRAME_PROFILER_EXPORT_CSV,
+} FrameProfilerExportMode;
+
+struct FrameProfilerZoneStats {
+    const char* name;
+    double averageMs;
+    double maxMs;
+    double averageCalls;
+};
+
+// Rolling per-zone averages over the last FRAME_PROFILER_HISTORY frames, sorted by average time
+std::vector<FrameProfilerZoneStats> FrameProfiler_GetZoneStats();
+uint64_t FrameProfiler_GetDroppedZones();
+// Consumes --profile-trace[=frames] and --profile-csv[=frames], returning true if argv[i] was a profiler flag
+bool FrameProfiler_ParseArg(const char* arg);
+#endif
+
+#else
+
+#define FRAME_PROFILER_BEGIN(name) ((void)0)
+#define FRAME_PROFILER_END() ((void)0)
+#define FRAME_PROFILER_END_FRAME() ((void)0)
+#define FRAME_PROFILER_SCOPE(name) ((void)0)
+
+#endif
@@ -10,6 +10,7 @@ typedef enum {
     PT_REGION_RESET,
     PT_SPOILER_LOG,
     PT_ENTRANCE_SHUFFLE,
+    PT_VALIDATE_WORLD,
     PT_SHOPSANITY,
     PT_OWN_DUNGEON,
     PT_LIMITED_CHECKS,
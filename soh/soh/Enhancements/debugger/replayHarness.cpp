@@ -0,0 +1,339 @@
+#include "replayHarness.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <libultraship/libultraship.h>
+#include "soh/Enhancements/game-interactor/GameInteractor.h"
+#include "soh/ShipInit.hpp"
+
+extern "C" {
+#include <z64.h>
+#include "variables.h"
+#include "functions.h"
+extern PlayState* gPlayState;
+}
+
+#define REPLAY_MAGIC 0x52484F53 // "SOHR"
+#define REPLAY_VERSION 1
+#define REPLAY_SEED 0x5EED0C47
+
+namespace {
+
+struct ReplayHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t saveContextSize;
+    uint32_t padSize;
+    uint32_t seed;
+    uint32_t frameCount;
+    uint16_t entranceIndex;
+    uint16_t unused;
+};
+
+struct ReplayFrame {
+    OSContPad pad;
+    uint64_t hash;
+};
+
+struct FrameTiming {
+    double phaseMs[REPLAY_PHASE_MAX];
+    uint64_t hash;
+};
+
+enum class ReplayMode {
+    Idle,
+    Recording,
+    Playing,
+};
+
+ReplayMode sMode = ReplayMode::Idle;
+// Set between reloading the entrance and its OnSceneInit
+bool sWaitingForScene = false;
+bool sPadApplied = false;
+std::string sPath;
+ReplayHeader sHeader;
+std::vector<uint8_t> sSaveContext;
+std::vector<ReplayFrame> sFrames;
+std::vector<FrameTiming> sTimings;
+uint32_t sFrameIndex = 0;
+std::chrono::steady_clock::time_point sPhaseStart[REPLAY_PHASE_MAX];
+double sPhaseMs[REPLAY_PHASE_MAX];
+
+std::string sPendingPlayback;
+bool sExitWhenDone = false;
+
+uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+// FNV-1a over the save context and the id, params and transform of every actor
+uint64_t HashState() {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    hash = HashBytes(hash, &gSaveContext, sizeof(gSaveContext));
+    if (gPlayState == nullptr) {
+        return hash;
+    }
+
+    hash = HashBytes(hash, &gPlayState->gameplayFrames, sizeof(gPlayState->gameplayFrames));
+    for (int32_t category = 0; category < ACTORCAT_MAX; category++) {
+        for (Actor* actor = gPlayState->actorCtx.actorLists[category].head; actor != nullptr; actor = actor->next) {
+            hash = HashBytes(hash, &actor->id, sizeof(actor->id));
+            hash = HashBytes(hash, &actor->params, sizeof(actor->params));
+            hash = HashBytes(hash, &actor->world, sizeof(actor->world));
+            hash = HashBytes(hash, &actor->shape.rot, sizeof(actor->shape.rot));
+        }
+    }
+    return hash;
+}
+
+// Restores the save context of the replay and reloads its entrance, the run starts at the following OnSceneInit
+void BeginRun() {
+    memcpy(&gSaveContext, sSaveContext.data(), sizeof(gSaveContext));
+    gPlayState->nextEntranceIndex = sHeader.entranceIndex;
+    gPlayState->transitionTrigger = TRANS_TRIGGER_START;
+    gPlayState->transitionType = TRANS_TYPE_INSTANT;
+    gSaveContext.nextTransitionType = TRANS_TYPE_INSTANT;
+
+    sWaitingForScene = true;
+    sPadApplied = false;
+    sFrameIndex = 0;
+    sTimings.clear();
+    sTimings.reserve(sHeader.frameCount);
+}
+
+bool WriteReplay() {
+    std::ofstream file(sPath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&sHeader), sizeof(sHeader));
+    file.write(reinterpret_cast<const char*>(sSaveContext.data()), sSaveContext.size());
+    file.write(reinterpret_cast<const char*>(sFrames.data()), sFrames.size() * sizeof(ReplayFrame));
+    return file.good();
+}
+
+bool ReadReplay(const std::string& path) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        SPDLOG_ERROR("[Replay] Could not open {}", path);
+        return false;
+    }
+
+    file.read(reinterpret_cast<char*>(&sHeader), sizeof(sHeader));
+    if (!file || sHeader.magic != REPLAY_MAGIC || sHeader.version != REPLAY_VERSION) {
+        SPDLOG_ERROR("[Replay] {} is not a replay file", path);
+        return false;
+    }
+    // The file stores raw structs, so it only plays back on builds with the same layout
+    if (sHeader.saveContextSize != sizeof(SaveContext) || sHeader.padSize != sizeof(OSContPad)) {
+        SPDLOG_ERROR("[Replay] {} was recorded by an incompatible build", path);
+        return false;
+    }
+
+    sSaveContext.resize(sHeader.saveContextSize);
+    sFrames.resize(sHeader.frameCount);
+    file.read(reinterpret_cast<char*>(sSaveContext.data()), sSaveContext.size());
+    file.read(reinterpret_cast<char*>(sFrames.data()), sFrames.size() * sizeof(ReplayFrame));
+    if (!file) {
+        SPDLOG_ERROR("[Replay] {} is truncated", path);
+        return false;
+    }
+    return true;
+}
+
+// Writes the per-frame report next to the replay and returns the first desynced frame, or -1
+int32_t FinishPlayback() {
+    int32_t desyncFrame = -1;
+    double totalMs[REPLAY_PHASE_MAX] = {};
+    double maxMs[REPLAY_PHASE_MAX] = {};
+
+    std::string reportPath = sPath + ".csv";
+    std::ofstream report(reportPath);
+    report << "frame,update_ms,draw_ms,hash,expected_hash\n";
+    for (size_t i = 0; i < sTimings.size(); i++) {
+        const FrameTiming& timing = sTimings[i];
+        for (int32_t phase = 0; phase < REPLAY_PHASE_MAX; phase++) {
+            totalMs[phase] += timing.phaseMs[phase];
+            maxMs[phase] = std::max(maxMs[phase], timing.phaseMs[phase]);
+        }
+        if (desyncFrame < 0 && timing.hash != sFrames[i].hash) {
+            desyncFrame = static_cast<int32_t>(i);
+        }
+        report << i << "," << timing.phaseMs[REPLAY_PHASE_UPDATE] << "," << timing.phaseMs[REPLAY_PHASE_DRAW] << ","
+               << timing.hash << "," << sFrames[i].hash << "\n";
+    }
+
+    const double frames = std::max<double>(sTimings.size(), 1);
+    SPDLOG_INFO("[Replay] {} frames, Play_Update avg {:.3f} ms max {:.3f} ms, Play_Draw avg {:.3f} ms max {:.3f} ms",
+                sTimings.size(), totalMs[REPLAY_PHASE_UPDATE] / frames, maxMs[REPLAY_PHASE_UPDATE],
+                totalMs[REPLAY_PHASE_DRAW] / frames, maxMs[REPLAY_PHASE_DRAW]);
+    if (desyncFrame >= 0) {
+        SPDLOG_ERROR("[Replay] Desync at frame {}", desyncFrame);
+    } else {
+        SPDLOG_INFO("[Replay] No desync, final state hash {:016X}", sTimings.empty() ? 0 : sTimings.back().hash);
+    }
+    SPDLOG_INFO("[Replay] Wrote per-frame report to {}", reportPath);
+    return desyncFrame;
+}
+
+void FinishRun() {
+    const ReplayMode mode = sMode;
+    sMode = ReplayMode::Idle;
+    sWaitingForScene = false;
+
+    if (mode == ReplayMode::Recording) {
+        if (WriteReplay()) {
+            SPDLOG_INFO("[Replay] Recorded {} frames to {}", sFrames.size(), sPath);
+        } else {
+            SPDLOG_ERROR("[Replay] Could not write {}", sPath);
+        }
+        return;
+    }
+
+    const int32_t desyncFrame = FinishPlayback();
+    if (sExitWhenDone) {
+        exit(desyncFrame >= 0 ? 1 : 0);
+    }
+}
+
+} // namespace
+
+bool ReplayHarness_StartRecording(const std::string& path, uint32_t frames) {
+    if (gPlayState == nullptr || sMode != ReplayMode::Idle || frames == 0) {
+        return false;
+    }
+
+    sPath = path;
+    sHeader = { REPLAY_MAGIC, REPLAY_VERSION, sizeof(SaveContext), sizeof(OSContPad), REPLAY_SEED, frames,
+                static_cast<uint16_t>(gSaveContext.entranceIndex), 0 };
+    sSaveContext.resize(sizeof(gSaveContext));
+    memcpy(sSaveContext.data(), &gSaveContext, sizeof(gSaveContext));
+    sFrames.assign(frames, ReplayFrame{});
+
+    sMode = ReplayMode::Recording;
+    BeginRun();
+    return true;
+}
+
+bool ReplayHarness_StartPlayback(const std::string& path) {
+    if (gPlayState == nullptr || sMode != ReplayMode::Idle || !ReadReplay(path)) {
+        return false;
+    }
+
+    sPath = path;
+    sMode = ReplayMode::Playing;
+    // Nothing to wait for, report right away so --replay-exit doesn't hang
+    if (sHeader.frameCount == 0) {
+        FinishRun();
+        return true;
+    }
+    BeginRun();
+    return true;
+}
+
+void ReplayHarness_Stop() {
+    if (sMode == ReplayMode::Recording) {
+        sHeader.frameCount = sFrameIndex;
+        sFrames.resize(sFrameIndex);
+        FinishRun();
+    } else if (sMode == ReplayMode::Playing) {
+        FinishRun();
+    }
+}
+
+bool ReplayHarness_IsActive() {
+    return sMode != ReplayMode::Idle;
+}
+
+bool ReplayHarness_ParseArg(const char* arg) {
+    static const char sReplayFlag[] = "--replay=";
+
+    if (strncmp(arg, sReplayFlag, sizeof(sReplayFlag) - 1) == 0) {
+        sPendingPlayback = arg + sizeof(sReplayFlag) - 1;
+        return true;
+    }
+    if (strcmp(arg, "--replay-exit") == 0) {
+        sExitWhenDone = true;
+        return true;
+    }
+    return false;
+}
+
+extern "C" void ReplayHarness_ProcessPad(OSContPad* pad) {
+    if (sMode == ReplayMode::Idle || sWaitingForScene || sFrameIndex >= sFrames.size()) {
+        return;
+    }
+
+    // Play_Init reseeds the RNG from the clock after OnSceneInit, so the replay seed is set on the first replayed frame
+    if (sFrameIndex == 0) {
+        Rand_Seed(sHeader.seed);
+    }
+
+    if (sMode == ReplayMode::Recording) {
+        sFrames[sFrameIndex].pad = *pad;
+    } else {
+        *pad = sFrames[sFrameIndex].pad;
+    }
+    sPadApplied = true;
+}
+
+extern "C" void ReplayHarness_BeginPhase(ReplayPhase phase) {
+    if (sPadApplied) {
+        sPhaseStart[phase] = std::chrono::steady_clock::now();
+    }
+}
+
+extern "C" void ReplayHarness_EndPhase(ReplayPhase phase) {
+    if (sPadApplied) {
+        sPhaseMs[phase] =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sPhaseStart[phase]).count();
+    }
+}
+
+extern "C" void ReplayHarness_EndFrame(void) {
+    if (!sPendingPlayback.empty() && gPlayState != nullptr) {
+        if (!ReplayHarness_StartPlayback(sPendingPlayback) && sExitWhenDone) {
+            exit(1);
+        }
+        sPendingPlayback.clear();
+    }
+
+    // Only frames that consumed a replay input count, which skips the frame the entrance was reloaded on
+    if (!sPadApplied) {
+        return;
+    }
+    sPadApplied = false;
+
+    FrameTiming timing;
+    memcpy(timing.phaseMs, sPhaseMs, sizeof(sPhaseMs));
+    timing.hash = HashState();
+    memset(sPhaseMs, 0, sizeof(sPhaseMs));
+
+    if (sMode == ReplayMode::Recording) {
+        sFrames[sFrameIndex].hash = timing.hash;
+    }
+    sTimings.push_back(timing);
+
+    if (++sFrameIndex >= sFrames.size()) {
+        FinishRun();
+    }
+}
+
+static void ReplayHarness_Register() {
+    COND_HOOK(OnSceneInit, true, [](int16_t sceneNum) {
+        sWaitingForScene = false;
+    });
+}
+
+static RegisterShipInitFunc initFunc(ReplayHarness_Register);
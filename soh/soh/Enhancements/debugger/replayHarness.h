@@ -0,0 +1,40 @@
+#pragma once
+
+// Deterministic input replay for performance and desync regression runs. A replay file holds the save context, entrance
+// and RNG seed a run starts from, followed by the controller input and a state hash of every frame. Recording and
+// playback both restore the save context and reload the entrance, so a playback feeds the same inputs to the same
+// state and reports per-frame Play_Update/Play_Draw times and the first frame whose state hash differs.
+
+#include <libultraship/libultra.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    REPLAY_PHASE_UPDATE,
+    REPLAY_PHASE_DRAW,
+    REPLAY_PHASE_MAX,
+} ReplayPhase;
+
+// Records or overrides the first controller, called once per frame after the controllers are read
+void ReplayHarness_ProcessPad(OSContPad* pad);
+void ReplayHarness_BeginPhase(ReplayPhase phase);
+void ReplayHarness_EndPhase(ReplayPhase phase);
+void ReplayHarness_EndFrame(void);
+
+#ifdef __cplusplus
+}
+
+#include <cstdint>
+#include <string>
+
+// Both need a running PlayState, the run starts once the current entrance has been reloaded
+bool ReplayHarness_StartRecording(const std::string& path, uint32_t frames);
+bool ReplayHarness_StartPlayback(const std::string& path);
+void ReplayHarness_Stop();
+bool ReplayHarness_IsActive();
+// Consumes --replay=<file> and --replay-exit, returning true if arg was a replay flag. The replay starts as soon as
+// gameplay is reached, and with --replay-exit the game exits with status 1 on a desync and 0 otherwise.
+bool ReplayHarness_ParseArg(const char* arg);
+#endif
@@ -9,6 +9,9 @@
 #include "soh/cvar_prefixes.h"
 #include "soh/ResourceManagerHelpers.h"
 
+#include <unordered_map>
+#include <spdlog/spdlog.h>
+
 extern "C" {
 #include <z64.h>
 #include "src/overlays/actors/ovl_En_Rr/z_en_rr.h"
@@ -25,6 +28,7 @@ typedef struct EnemyEntry {
 
 bool IsEnemyFoundToRandomize(int16_t sceneNum, int8_t roomNum, int16_t actorId, int16_t params, float posX);
 bool IsEnemyAllowedToSpawn(int16_t sceneNum, int8_t roomNum, EnemyEntry enemy);
+static bool IsEnemyAllowedToSpawn(int16_t sceneNum, int8_t roomNum, bool isMQ, EnemyEntry enemy);
 EnemyEntry GetRandomizedEnemyEntry(uint32_t seed, PlayState* play);
 
 const char* enemyCVarList[RANDOMIZED_ENEMY_SPAWN_TABLE_SIZE] = {
@@ -385,9 +389,12 @@ extern "C" uint8_t GetRandomizedEnemy(PlayState* play, int16_t* actorId, f32* po
 }
 
 static std::vector<EnemyEntry> selectedEnemyList;
+// Indices into selectedEnemyList of the enemies allowed to spawn in a room, keyed by GetEnemyPoolKey
+static std::unordered_map<uint32_t, std::vector<uint8_t>> enemyPoolCache;
 
 void GetSelectedEnemies() {
     selectedEnemyList.clear();
+    enemyPoolCache.clear();
     for (int i = 0; i < RANDOMIZED_ENEMY_SPAWN_TABLE_SIZE; i++) {
         if (CVarGetInteger(CVAR_ENHANCEMENT("RandomizedEnemyList.All"), 0)) {
             selectedEnemyList.push_back(randomizedEnemySpawnTable[i]);
@@ -400,28 +407,48 @@ void GetSelectedEnemies() {
     }
 }
 
-EnemyEntry GetRandomizedEnemyEntry(uint32_t seed, PlayState* play) {
-    std::vector<EnemyEntry> filteredEnemyList = {};
-    if (selectedEnemyList.size() == 0) {
-        GetSelectedEnemies();
+// Whether a scene is MQ can change between files, so it's part of the key
+static uint32_t GetEnemyPoolKey(int16_t sceneNum, int8_t roomNum, bool isMQ) {
+    return (isMQ << 24) | ((uint16_t)sceneNum << 8) | (uint8_t)roomNum;
+}
+
+// The selected enemies allowed to spawn in a room, in selectedEnemyList order so sampling from it picks the same
+// enemies as filtering the list on every spawn did. Falls back to every selected enemy if none are allowed.
+static const std::vector<uint8_t>& GetEnemyPool(int16_t sceneNum, int8_t roomNum, bool isMQ) {
+    auto [it, inserted] = enemyPoolCache.try_emplace(GetEnemyPoolKey(sceneNum, roomNum, isMQ));
+    std::vector<uint8_t>& pool = it->second;
+    if (!inserted) {
+        return pool;
+    }
+
+    for (size_t i = 0; i < selectedEnemyList.size(); i++) {
+        if (IsEnemyAllowedToSpawn(sceneNum, roomNum, isMQ, selectedEnemyList[i])) {
+            pool.push_back(i);
+        }
     }
-    for (EnemyEntry enemy : selectedEnemyList) {
-        if (IsEnemyAllowedToSpawn(play->sceneNum, play->roomCtx.curRoom.num, enemy)) {
-            filteredEnemyList.push_back(enemy);
+    if (pool.size() == 0) {
+        for (size_t i = 0; i < selectedEnemyList.size(); i++) {
+            pool.push_back(i);
         }
     }
-    if (filteredEnemyList.size() == 0) {
-        filteredEnemyList = selectedEnemyList;
+    return pool;
+}
+
+EnemyEntry GetRandomizedEnemyEntry(uint32_t seed, PlayState* play) {
+    if (selectedEnemyList.size() == 0) {
+        GetSelectedEnemies();
     }
+    const std::vector<uint8_t>& enemyPool =
+        GetEnemyPool(play->sceneNum, play->roomCtx.curRoom.num, ResourceMgr_IsSceneMasterQuest(play->sceneNum));
     if (CVAR_ENEMY_RANDOMIZER_VALUE == ENEMY_RANDOMIZER_RANDOM_SEEDED) {
         uint32_t finalSeed =
             seed + (IS_RANDO ? Rando::Context::GetInstance()->GetSeed() : gSaveContext.ship.stats.fileCreatedAt);
         Random_Init(finalSeed);
-        uint32_t randomNumber = Random(0, filteredEnemyList.size());
-        return filteredEnemyList[randomNumber];
+        uint32_t randomNumber = Random(0, enemyPool.size());
+        return selectedEnemyList[enemyPool[randomNumber]];
     } else {
-        uint32_t randomSelectedEnemy = Random(0, filteredEnemyList.size());
-        return filteredEnemyList[randomSelectedEnemy];
+        uint32_t randomSelectedEnemy = Random(0, enemyPool.size());
+        return selectedEnemyList[enemyPool[randomSelectedEnemy]];
     }
 }
 
@@ -496,8 +523,10 @@ bool IsEnemyFoundToRandomize(int16_t sceneNum, int8_t roomNum, int16_t actorId,
 }
 
 bool IsEnemyAllowedToSpawn(int16_t sceneNum, int8_t roomNum, EnemyEntry enemy) {
-    uint32_t isMQ = ResourceMgr_IsSceneMasterQuest(sceneNum);
+    return IsEnemyAllowedToSpawn(sceneNum, roomNum, ResourceMgr_IsSceneMasterQuest(sceneNum), enemy);
+}
 
+static bool IsEnemyAllowedToSpawn(int16_t sceneNum, int8_t roomNum, bool isMQ, EnemyEntry enemy) {
     // Freezard - Child Link can only kill this with jump slash Deku Sticks or other equipment like bombs.
     // Beamos - Needs bombs.
     // Anubis - Needs fire.
@@ -610,6 +639,52 @@ bool IsEnemyAllowedToSpawn(int16_t sceneNum, int8_t roomNum, EnemyEntry enemy) {
     }
 }
 
+bool EnemyRandomizer_CheckPools(std::string& report) {
+    // Checked against the whole spawn table rather than the current selection, so every enemy gets filtered
+    std::vector<EnemyEntry> previousSelection;
+    previousSelection.swap(selectedEnemyList);
+    selectedEnemyList.assign(randomizedEnemySpawnTable, randomizedEnemySpawnTable + RANDOMIZED_ENEMY_SPAWN_TABLE_SIZE);
+    enemyPoolCache.clear();
+
+    size_t checkedPools = 0;
+    bool passed = true;
+    std::vector<uint8_t> expected;
+    for (int16_t sceneNum = 0; sceneNum < SCENE_ID_MAX && passed; sceneNum++) {
+        for (int16_t roomNum = 0; roomNum <= INT8_MAX && passed; roomNum++) {
+            for (bool isMQ : { false, true }) {
+                expected.clear();
+                for (size_t i = 0; i < selectedEnemyList.size(); i++) {
+                    if (IsEnemyAllowedToSpawn(sceneNum, roomNum, isMQ, selectedEnemyList[i])) {
+                        expected.push_back(i);
+                    }
+                }
+                if (expected.empty()) {
+                    for (size_t i = 0; i < selectedEnemyList.size(); i++) {
+                        expected.push_back(i);
+                    }
+                }
+
+                // The second lookup is served from the cache
+                if (GetEnemyPool(sceneNum, roomNum, isMQ) != expected ||
+                    GetEnemyPool(sceneNum, roomNum, isMQ) != expected) {
+                    report = fmt::format("Enemy pool of scene {:#04x} room {}{} doesn't match the filtered list",
+                                         sceneNum, roomNum, isMQ ? " (MQ)" : "");
+                    passed = false;
+                    break;
+                }
+                checkedPools++;
+            }
+        }
+    }
+
+    selectedEnemyList.swap(previousSelection);
+    enemyPoolCache.clear();
+    if (passed) {
+        report = fmt::format("All {} enemy pools match the filtered list", checkedPools);
+    }
+    return passed;
+}
+
 void FixClubMoblinScale(void* ptr) {
     Actor* actor = (Actor*)ptr;
     if (actor->params == -1) {
@@ -9,7 +9,13 @@ extern const char* enemyCVarList[];
 extern const char* enemyNameList[];
 extern void GetSelectedEnemies();
 
-#ifndef __cplusplus
+#ifdef __cplusplus
+#include <string>
+
+// Compares the cached enemy pool of every scene, room and MQ combination against filtering the whole spawn table with
+// IsEnemyAllowedToSpawn directly. Meant for the debug console. Writes a one line result to report.
+bool EnemyRandomizer_CheckPools(std::string& report);
+#else
 struct PlayState;
 
 uint8_t GetRandomizedEnemy(struct PlayState* play, int16_t* actorId, f32* posX, f32* posY, f32* posZ, int16_t* rotX,
@@ -7,6 +7,7 @@
 #include "vanilla-behavior/GIVanillaBehavior.h"
 #include "GameInteractionEffect.h"
 #include "soh/Enhancements/item-tables/ItemTableTypes.h"
+#include "soh/Enhancements/debugger/frameProfiler.h"
 #include <z64.h>
 
 typedef enum {
@@ -275,6 +276,7 @@ class GameInteractor {
     }
 
     template <typename H, typename... Args> void ExecuteHooks(Args&&... args) {
+        FRAME_PROFILER_SCOPE(H::Name);
         // Remove pending hooks for this type
         for (auto& hookId : HooksToUnregister<H>::hooks) {
             RegisteredGameHooks<H>::functions.erase(hookId);
@@ -315,6 +317,7 @@ class GameInteractor {
     }
 
     template <typename H, typename... Args> void ExecuteHooksForID(int32_t id, Args&&... args) {
+        FRAME_PROFILER_SCOPE(H::Name);
         // Remove pending hooks for this type
         for (auto hookIdIt = HooksToUnregister<H>::hooksForID.begin();
              hookIdIt != HooksToUnregister<H>::hooksForID.end();) {
@@ -376,6 +379,7 @@ class GameInteractor {
     }
 
     template <typename H, typename... Args> void ExecuteHooksForPtr(uintptr_t ptr, Args&&... args) {
+        FRAME_PROFILER_SCOPE(H::Name);
         // Remove pending hooks for this type
         for (auto hookIdIt = HooksToUnregister<H>::hooksForPtr.begin();
              hookIdIt != HooksToUnregister<H>::hooksForPtr.end();) {
@@ -438,6 +442,7 @@ class GameInteractor {
     }
 
     template <typename H, typename... Args> void ExecuteHooksForFilter(Args&&... args) {
+        FRAME_PROFILER_SCOPE(H::Name);
         // Remove pending hooks for this type
         for (auto& hookId : HooksToUnregister<H>::hooksForFilter) {
             RegisteredGameHooks<H>::functionsForFilter.erase(hookId);
@@ -525,10 +530,11 @@ class GameInteractor {
         }
     };
 
-#define DEFINE_HOOK(name, args)                  \
-    struct name {                                \
-        typedef std::function<void args> fn;     \
-        typedef std::function<bool args> filter; \
+#define DEFINE_HOOK(name, args)                    \
+    struct name {                                  \
+        static constexpr const char* Name = #name; \
+        typedef std::function<void args> fn;       \
+        typedef std::function<bool args> filter;   \
     }
 
 #include "GameInteractor_HookTable.h"
@@ -1,5 +1,7 @@
 #include "ItemTableManager.h"
+#include <algorithm>
 #include <stdexcept>
+#include <spdlog/spdlog.h>
 
 ItemTableManager::ItemTableManager() {
 }
@@ -9,28 +11,87 @@ ItemTableManager::~ItemTableManager() {
 }
 
 bool ItemTableManager::AddItemTable(uint16_t tableID) {
+    if (frozen) {
+        SPDLOG_ERROR("Item table {} added after the item tables were frozen", tableID);
+        return false;
+    }
     ItemTable newItemTable;
     return itemTables.emplace(tableID, newItemTable).second;
 }
 
 bool ItemTableManager::AddItemEntry(uint16_t tableID, uint16_t getItemID, GetItemEntry getItemEntry) {
+    if (frozen) {
+        SPDLOG_ERROR("Item entry {} added to table {} after the item tables were frozen", getItemID, tableID);
+        return false;
+    }
     try {
         ItemTable* itemTable = RetrieveItemTable(tableID);
+        // Stored the way it is retrieved, so lookups can hand out the entry itself
+        getItemEntry.drawItemId = getItemEntry.itemId;
+        getItemEntry.drawModIndex = getItemEntry.modIndex;
         return itemTable->emplace(getItemID, getItemEntry).second;
     } catch (const std::out_of_range& oor) { return false; }
 }
 
-GetItemEntry ItemTableManager::RetrieveItemEntry(uint16_t tableID, uint16_t getItemID) {
-    try {
-        ItemTable* itemTable = RetrieveItemTable(tableID);
-        GetItemEntry getItemEntry = itemTable->at(getItemID);
-        getItemEntry.drawItemId = getItemEntry.itemId;
-        getItemEntry.drawModIndex = getItemEntry.modIndex;
-        return getItemEntry;
-    } catch (std::out_of_range& oor) { return GET_ITEM_NONE; }
+void ItemTableManager::Freeze() {
+    if (frozen) {
+        return;
+    }
+
+    for (const auto& [tableID, itemTable] : itemTables) {
+        uint32_t size = 0;
+        for (const auto& [getItemID, getItemEntry] : itemTable) {
+            size = std::max<uint32_t>(size, getItemID + 1);
+        }
+
+        if (tableID >= packedTables.size()) {
+            packedTables.resize(tableID + 1, { 0, 0 });
+        }
+        packedTables[tableID] = { static_cast<uint32_t>(packedEntries.size()), size };
+        packedEntries.resize(packedEntries.size() + size, GET_ITEM_NONE);
+        packedPresent.resize((packedEntries.size() + 63) / 64, 0);
+
+        for (const auto& [getItemID, getItemEntry] : itemTable) {
+            const uint32_t slot = packedTables[tableID].base + getItemID;
+            packedEntries[slot] = getItemEntry;
+            packedPresent[slot / 64] |= 1ull << (slot % 64);
+        }
+    }
+
+    itemTables.clear();
+    frozen = true;
+}
+
+const GetItemEntry* ItemTableManager::FindItemEntry(uint16_t tableID, uint16_t getItemID) const {
+    if (!frozen) {
+        auto foundTable = itemTables.find(tableID);
+        if (foundTable == itemTables.end()) {
+            return nullptr;
+        }
+        auto foundEntry = foundTable->second.find(getItemID);
+        return foundEntry != foundTable->second.end() ? &foundEntry->second : nullptr;
+    }
+
+    if (tableID >= packedTables.size() || getItemID >= packedTables[tableID].size) {
+        return nullptr;
+    }
+    const uint32_t slot = packedTables[tableID].base + getItemID;
+    return (packedPresent[slot / 64] >> (slot % 64)) & 1 ? &packedEntries[slot] : nullptr;
+}
+
+GetItemEntry ItemTableManager::RetrieveItemEntry(uint16_t tableID, uint16_t getItemID) const {
+    const GetItemEntry* getItemEntry = FindItemEntry(tableID, getItemID);
+    if (getItemEntry == nullptr) {
+        return GET_ITEM_NONE;
+    }
+    return *getItemEntry;
 }
 
 bool ItemTableManager::ClearItemTable(uint16_t tableID) {
+    if (frozen) {
+        SPDLOG_ERROR("Item table {} cleared after the item tables were frozen", tableID);
+        return false;
+    }
     try {
         ItemTable* itemTable = RetrieveItemTable(tableID);
         itemTable->clear();
@@ -3,6 +3,7 @@
 #include "z64item.h"
 
 #include <unordered_map>
+#include <vector>
 
 typedef std::unordered_map<uint16_t, GetItemEntry> ItemTable;
 
@@ -13,11 +14,29 @@ class ItemTableManager {
     ~ItemTableManager();
     bool AddItemTable(uint16_t tableID);
     bool AddItemEntry(uint16_t tableID, uint16_t getItemID, GetItemEntry getItemEntry);
-    GetItemEntry RetrieveItemEntry(uint16_t tableID, uint16_t getItemID);
     bool ClearItemTable(uint16_t tableID);
 
+    // Packs every registered table into one flat array. Afterwards the tables can no longer be changed, and lookups
+    // can be made from any thread without locking.
+    void Freeze();
+
+    // Returns nullptr if the table or the entry do not exist
+    const GetItemEntry* FindItemEntry(uint16_t tableID, uint16_t getItemID) const;
+    GetItemEntry RetrieveItemEntry(uint16_t tableID, uint16_t getItemID) const;
+
   private:
+    // Tables as they are registered, before Freeze
     std::unordered_map<uint16_t, ItemTable> itemTables;
 
+    // After Freeze, table tableID occupies packedEntries[base, base + size), indexed by GetItemID
+    struct PackedTable {
+        uint32_t base;
+        uint32_t size;
+    };
+    std::vector<PackedTable> packedTables; // Indexed by tableID, size 0 for tables that do not exist
+    std::vector<GetItemEntry> packedEntries;
+    std::vector<uint64_t> packedPresent; // One bit per packedEntries slot, set if an entry was registered there
+    bool frozen = false;
+
     ItemTable* RetrieveItemTable(uint16_t tableID);
 };
@@ -362,16 +362,21 @@ void Context::SetSpoilerLoaded(const bool spoilerLoaded) {
 GetItemEntry Context::GetFinalGIEntry(const RandomizerCheck rc, const bool checkObtainability,
                                       const GetItemID ogItemId) {
     const auto itemLoc = GetItemLocation(rc);
+    uint16_t vanillaItemId = GI_NONE;
     if (itemLoc->GetPlacedRandomizerGet() == RG_NONE) {
-        if (ogItemId != GI_NONE) {
-            return ItemTableManager::Instance->RetrieveItemEntry(MOD_NONE, ogItemId);
+        vanillaItemId = ogItemId != GI_NONE
+                            ? ogItemId
+                            : StaticData::RetrieveItem(StaticData::GetLocation(rc)->GetVanillaItem()).GetItemID();
+    } else if (checkObtainability && OTRGlobals::Instance->gRandomizer->GetItemObtainabilityFromRandomizerGet(
+                                         itemLoc->GetPlacedRandomizerGet()) != CAN_OBTAIN) {
+        vanillaItemId = GI_RUPEE_BLUE;
+    }
+    if (vanillaItemId != GI_NONE) {
+        const GetItemEntry* vanillaEntry = ItemTableManager::Instance->FindItemEntry(MOD_NONE, vanillaItemId);
+        if (vanillaEntry == nullptr) {
+            return GET_ITEM_NONE;
         }
-        return ItemTableManager::Instance->RetrieveItemEntry(
-            MOD_NONE, StaticData::RetrieveItem(StaticData::GetLocation(rc)->GetVanillaItem()).GetItemID());
-    }
-    if (checkObtainability && OTRGlobals::Instance->gRandomizer->GetItemObtainabilityFromRandomizerGet(
-                                  itemLoc->GetPlacedRandomizerGet()) != CAN_OBTAIN) {
-        return ItemTableManager::Instance->RetrieveItemEntry(MOD_NONE, GI_RUPEE_BLUE);
+        return *vanillaEntry;
     }
     GetItemEntry giEntry = itemLoc->GetPlacedItem().GetGIEntry_Copy();
     if (overrides.contains(rc)) {
@@ -6,6 +6,8 @@
 #include "../debugger/performanceTimer.h"
 
 #include <spdlog/spdlog.h>
+#include <array>
+#include <bitset>
 
 namespace Rando {
 EntranceLinkInfo NO_RETURN_ENTRANCE = { EntranceType::None, RR_NONE, RR_NONE, -1 };
@@ -782,6 +784,75 @@ static bool EntranceUnreachableAs(Entrance* entrance, uint8_t age, std::vector<E
     return true;
 }
 
+// Entrances that must never be reachable as the given age unless entrances are decoupled, by parent region and original
+// connected region. Those pairs are unique, so this matches comparing the entrance names.
+typedef struct {
+    RandomizerRegion parentRegion;
+    RandomizerRegion connectedRegion;
+    uint8_t age;
+} AgeForbiddenEntrance;
+
+static constexpr std::array<AgeForbiddenEntrance, 5> ageForbiddenEntrances = { {
+    { RR_OGC_GREAT_FAIRY_FOUNTAIN, RR_CASTLE_GROUNDS, RO_AGE_CHILD },
+    { RR_GV_CARPENTER_TENT, RR_GV_FORTRESS_SIDE, RO_AGE_CHILD },
+    { RR_GANONS_CASTLE_ENTRYWAY, RR_CASTLE_GROUNDS_FROM_GANONS_CASTLE, RO_AGE_CHILD },
+    { RR_HC_GREAT_FAIRY_FOUNTAIN, RR_CASTLE_GROUNDS, RO_AGE_ADULT },
+    { RR_HC_STORMS_GROTTO, RR_CASTLE_GROUNDS, RO_AGE_ADULT },
+} };
+
+// Parent regions of ageForbiddenEntrances, so most entrances are ruled out with a single bit test
+static const std::bitset<RR_MAX> ageForbiddenParents = [] {
+    std::bitset<RR_MAX> parents;
+    for (const AgeForbiddenEntrance& forbidden : ageForbiddenEntrances) {
+        parents.set(forbidden.parentRegion);
+    }
+    return parents;
+}();
+
+// Returns the age the entrance must not be reachable as, or -1 if it has no restriction
+static int8_t GetForbiddenAge(const Entrance* entrance) {
+    if (!ageForbiddenParents.test(entrance->GetParentRegionKey())) {
+        return -1;
+    }
+    for (const AgeForbiddenEntrance& forbidden : ageForbiddenEntrances) {
+        if (forbidden.parentRegion == entrance->GetParentRegionKey() &&
+            forbidden.connectedRegion == entrance->GetOriginalConnectedRegionKey()) {
+            return forbidden.age;
+        }
+    }
+    return -1;
+}
+
+// Only looks at the shape of the entrance graph, not at the logic search, so it runs before the search
+static bool ValidateAgeForbiddenEntrances() {
+    auto allShuffleableEntrances = GetShuffleableEntrances(EntranceType::All, false);
+    for (auto& entrance : allShuffleableEntrances) {
+        if (entrance->IsShuffled() && entrance->GetReplacement() == nullptr) {
+            continue;
+        }
+
+        // A shuffled entrance leads to wherever its replacement used to lead
+        Entrance* destination = entrance->IsShuffled() ? entrance->GetReplacement() : entrance;
+        const int8_t forbiddenAge = GetForbiddenAge(destination);
+        if (forbiddenAge < 0) {
+            continue;
+        }
+
+        std::vector<Entrance*> alreadyChecked = { destination->GetReverse() };
+        if (!EntranceUnreachableAs(entrance, forbiddenAge, alreadyChecked)) {
+            const char* ageName = forbiddenAge == RO_AGE_CHILD ? "child" : "adult";
+            if (entrance->IsShuffled()) {
+                SPDLOG_DEBUG("{} is replaced by an entrance with a potential {} access\n", destination->GetName(),
+                             ageName);
+            } else {
+                SPDLOG_DEBUG("{} is potentially accessible as {}\n", destination->GetName(), ageName);
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
 static bool ValidateWorld(Entrance* entrancePlaced) {
     auto ctx = Rando::Context::GetInstance();
     SPDLOG_DEBUG("Validating world\n");
@@ -801,66 +872,23 @@ static bool ValidateWorld(Entrance* entrancePlaced) {
          type == EntranceType::ThievesHideout || type == EntranceType::Spawn || type == EntranceType::WarpSong ||
          type == EntranceType::OwlDrop);
 
-    // Search the world to verify that all necessary conditions are still being held
-    // Conditions will be checked during the search and any that fail will be figured out
-    // afterwards
-    ctx->GetLogic()->Reset();
-    ValidateEntrances(checkOtherEntranceAccess);
-
     if (!ctx->GetOption(RSK_DECOUPLED_ENTRANCES)) {
         // Unless entrances are decoupled, we don't want the player to end up through certain entrances as the wrong age
         // This means we need to hard check that none of the relevant entrances are ever reachable as that age
         // This is mostly relevant when mixing entrance pools or shuffling special interiors (such as windmill or kak
         // potion shop) Warp Songs and Overworld Spawns can also end up inside certain indoors so those need to be
         // handled as well
-        std::array<std::string, 3> childForbidden = { "OGC Great Fairy Fountain -> Castle Grounds",
-                                                      "GV Carpenter Tent -> GV Fortress Side",
-                                                      "Ganon's Castle Entryway -> Castle Grounds From Ganon's Castle" };
-        std::array<std::string, 2> adultForbidden = { "HC Great Fairy Fountain -> Castle Grounds",
-                                                      "HC Storms Grotto -> Castle Grounds" };
-
-        auto allShuffleableEntrances = GetShuffleableEntrances(EntranceType::All, false);
-        for (auto& entrance : allShuffleableEntrances) {
-
-            std::vector<Entrance*> alreadyChecked = {};
-
-            if (entrance->IsShuffled()) {
-                if (entrance->GetReplacement() != nullptr) {
-
-                    auto replacementName = entrance->GetReplacement()->GetName();
-                    alreadyChecked.push_back(entrance->GetReplacement()->GetReverse());
-
-                    if (ElementInContainer(replacementName, childForbidden) &&
-                        !EntranceUnreachableAs(entrance, RO_AGE_CHILD, alreadyChecked)) {
-                        auto message = replacementName + " is replaced by an entrance with a potential child access\n";
-                        SPDLOG_DEBUG(message);
-                        return false;
-                    } else if (ElementInContainer(replacementName, adultForbidden) &&
-                               !EntranceUnreachableAs(entrance, RO_AGE_ADULT, alreadyChecked)) {
-                        auto message = replacementName + " is replaced by an entrance with a potential adult access\n";
-                        SPDLOG_DEBUG(message);
-                        return false;
-                    }
-                }
-            } else {
-                auto name = entrance->GetName();
-                alreadyChecked.push_back(entrance->GetReverse());
-
-                if (ElementInContainer(name, childForbidden) &&
-                    !EntranceUnreachableAs(entrance, RO_AGE_CHILD, alreadyChecked)) {
-                    auto message = name + " is potentially accessible as child\n";
-                    SPDLOG_DEBUG(message);
-                    return false;
-                } else if (ElementInContainer(name, adultForbidden) &&
-                           !EntranceUnreachableAs(entrance, RO_AGE_ADULT, alreadyChecked)) {
-                    auto message = name + " is potentially accessible as adult\n";
-                    SPDLOG_DEBUG(message);
-                    return false;
-                }
-            }
+        if (!ValidateAgeForbiddenEntrances()) {
+            return false;
         }
     }
 
+    // Search the world to verify that all necessary conditions are still being held
+    // Conditions will be checked during the search and any that fail will be figured out
+    // afterwards
+    ctx->GetLogic()->Reset();
+    ValidateEntrances(checkOtherEntranceAccess);
+
     // If all locations aren't reachable, that means that one of the conditions failed when searching
     if (!Rando::Context::GetInstance()->allLocationsReachable) {
         if (checkOtherEntranceAccess) {
@@ -931,7 +959,10 @@ bool EntranceShuffler::ReplaceEntrance(Entrance* entrance, Entrance* target, std
         return false;
     }
     ChangeConnections(entrance, target);
-    if (ValidateWorld(entrance)) {
+    StartPerformanceTimer(PT_VALIDATE_WORLD);
+    const bool valid = ValidateWorld(entrance);
+    StopPerformanceTimer(PT_VALIDATE_WORLD);
+    if (valid) {
 #ifdef ENABLE_DEBUG
         std::string ticks = std::to_string(svcGetSystemTick());
         auto message = "Dumping World Graph at " + ticks + "\n";
@@ -1588,7 +1619,10 @@ int EntranceShuffler::ShuffleAllEntrances() {
     }
 
     // Validate the world one last time to ensure all special conditions are still valid
-    if (!ValidateWorld(nullptr)) {
+    StartPerformanceTimer(PT_VALIDATE_WORLD);
+    const bool valid = ValidateWorld(nullptr);
+    StopPerformanceTimer(PT_VALIDATE_WORLD);
+    if (!valid) {
         return ENTRANCE_SHUFFLE_FAILURE;
     }
 
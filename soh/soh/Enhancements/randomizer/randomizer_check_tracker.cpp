@@ -14,7 +14,9 @@
 #include "location_access.h"
 #include "3drando/fill.hpp"
 #include "soh/Enhancements/debugger/performanceTimer.h"
+#include "soh/Enhancements/debugger/frameProfiler.h"
 
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -176,6 +178,11 @@ std::unordered_map<RandomizerCheck, std::string> checkNameOverrides;
 
 bool ShouldShowCheck(RandomizerCheck rc);
 bool UpdateFilters();
+void BuildSearchIndex();
+void UpdateSearchTerms();
+void UpdateAreaFilter(RandomizerCheckArea rcArea);
+void RebuildVisibleChecks(RandomizerCheckArea rcArea);
+uint32_t GetVisibleChecksSettings();
 void BeginFloatWindows(std::string UniqueName, bool& open, ImGuiWindowFlags flags = 0);
 bool CompareChecks(RandomizerCheck, RandomizerCheck);
 bool CheckByArea(RandomizerCheckArea);
@@ -271,6 +278,16 @@ static ImGuiTextFilter checkSearch;
 static bool recalculateAvailable = false;
 std::array<bool, RCAREA_INVALID> filterAreasHidden = { 0 };
 std::array<bool, RC_MAX> filterChecksHidden = { 0 };
+// Lowercase short name, name and area name of every check, built once per seed when the game loads
+std::array<std::string, RC_MAX> checkSearchNames;
+std::array<std::string, RCAREA_INVALID> areaSearchNames;
+// Lowercase terms of checkSearch in filter order, the bool marks an excluding "-" term
+std::vector<std::pair<std::string, bool>> searchTerms;
+bool searchHasIncludeTerm = false;
+// Sorted checks of each area that pass the search and the hide settings, the tracker only draws these
+std::array<std::vector<RandomizerCheck>, RCAREA_INVALID> visibleChecksByArea;
+// Hide settings visibleChecksByArea was last built with
+uint32_t visibleChecksSettings = 0;
 
 void TrySetAreas() {
     if (checksByArea.empty()) {
@@ -514,6 +531,7 @@ void SetShopSeen(uint32_t sceneNum, bool prices) {
     }
     if (statusChanged) {
         SaveManager::Instance->SaveSection(gSaveContext.fileNum, sectionId, true);
+        UpdateAreaFilter(Rando::StaticData::GetLocation(start)->GetArea());
     }
 }
 
@@ -603,6 +621,7 @@ void CheckTrackerLoadGame(int32_t fileNum) {
          (OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_MQ_DUNGEON_RANDOM) == RO_MQ_DUNGEONS_SET_NUMBER &&
           OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_MQ_DUNGEON_COUNT) < 12));
     initialized = true;
+    BuildSearchIndex();
     UpdateAllOrdering();
     UpdateInventoryChecks();
     UpdateFilters();
@@ -629,6 +648,7 @@ void CheckTrackerShopSlotChange(uint8_t cursorSlot, int16_t basePrice) {
     if (status == RCSHOW_SEEN) {
         OTRGlobals::Instance->gRandoContext->GetItemLocation(slot)->SetCheckStatus(RCSHOW_IDENTIFIED);
         SaveManager::Instance->SaveSection(gSaveContext.fileNum, sectionId, true);
+        UpdateAreaFilter(Rando::StaticData::GetLocation(static_cast<RandomizerCheck>(slot))->GetArea());
         RecalculateAvailableChecks();
     }
 }
@@ -940,6 +960,9 @@ void Teardown() {
     areasSpoiled = 0;
     filterAreasHidden = { 0 };
     filterChecksHidden = { 0 };
+    for (auto& visibleChecks : visibleChecksByArea) {
+        visibleChecks.clear();
+    }
 
     lastLocationChecked = RC_UNKNOWN_CHECK;
 }
@@ -954,6 +977,8 @@ void SetAreaSpoiled(RandomizerCheckArea rcArea) {
 }
 
 void CheckTrackerWindow::DrawElement() {
+    FRAME_PROFILER_SCOPE("CheckTracker");
+
     Color_Background = CVarGetColor(CVAR_TRACKER_CHECK("BgColor.Value"), Color_Bg_Default);
     Color_Area_Incomplete_Main = CVarGetColor(CVAR_TRACKER_CHECK("AreaIncomplete.MainColor.Value"), Color_Main_Default);
     Color_Area_Incomplete_Extra =
@@ -991,6 +1016,10 @@ void CheckTrackerWindow::DrawElement() {
 
     hideShopUnshuffledChecks = CVarGetInteger(CVAR_TRACKER_CHECK("HideUnshuffledShopChecks"), 0);
     alwaysShowGS = CVarGetInteger(CVAR_TRACKER_CHECK("AlwaysShowGSLocs"), 0);
+    if (initialized && visibleChecksSettings != GetVisibleChecksSettings()) {
+        visibleChecksSettings = GetVisibleChecksSettings();
+        UpdateFilters();
+    }
     if (CVarGetInteger(CVAR_TRACKER_CHECK("WindowType"), TRACKER_WINDOW_WINDOW) == TRACKER_WINDOW_FLOATING) {
         if (CVarGetInteger(CVAR_TRACKER_CHECK("ShowOnlyPaused"), 0) &&
             (gPlayState == nullptr || gPlayState->pauseCtx.state == 0)) {
@@ -1089,6 +1118,7 @@ void CheckTrackerWindow::DrawElement() {
     UIWidgets::PushStyleCombobox(THEME_COLOR);
     if (CVarGetInteger(CVAR_TRACKER_CHECK("SearchInputVisible"), 1)) {
         if (checkSearch.Draw("", ImGui::GetContentRegionAvail().x - 6)) {
+            UpdateSearchTerms();
             UpdateFilters();
         }
         std::string checkSearchText = "";
@@ -1129,8 +1159,6 @@ void CheckTrackerWindow::DrawElement() {
         EndFloatWindows();
         return;
     }
-    ImGui::TableNextRow();
-    ImGui::TableNextColumn();
 
     // Prep for loop
     RainbowTick();
@@ -1156,6 +1184,8 @@ void CheckTrackerWindow::DrawElement() {
         thisAreaFullyChecked = (areaChecksGotten[rcArea] == areaCheckTotals[rcArea]);
         // Last Area needs to be cleaned up
         if (lastArea != RCAREA_INVALID && doDraw) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
             UIWidgets::PaddedSeparator();
         }
         lastArea = rcArea;
@@ -1186,6 +1216,8 @@ void CheckTrackerWindow::DrawElement() {
                     collapseLogic = false;
                 }
             }
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
             stemp = RandomizerCheckObjects::GetRCAreaName(rcArea) + "##TreeNode";
             ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(mainColor.r / 255.0f, mainColor.g / 255.0f,
                                                         mainColor.b / 255.0f, mainColor.a / 255.0f));
@@ -1238,9 +1270,19 @@ void CheckTrackerWindow::DrawElement() {
                 ImGui::SetScrollHereY(0.0f);
                 doAreaScroll = false;
             }
-            for (auto rc : checks) {
-                if (doDraw && isThisAreaSpoiled && !filterChecksHidden[rc]) {
-                    DrawLocation(rc);
+            // One table row per check so the clipper only draws the rows that are scrolled into view
+            if (doDraw && isThisAreaSpoiled) {
+                const std::vector<RandomizerCheck>& visibleChecks = visibleChecksByArea[rcArea];
+                ImGuiListClipper clipper;
+                clipper.Begin(static_cast<int>(visibleChecks.size()));
+                while (clipper.Step()) {
+                    // Skipping a check rebuilds the list while it's being drawn
+                    for (int i = clipper.DisplayStart;
+                         i < clipper.DisplayEnd && i < static_cast<int>(visibleChecks.size()); i++) {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        DrawLocation(visibleChecks[i]);
+                    }
                 }
             }
         }
@@ -1256,41 +1298,151 @@ void CheckTrackerWindow::DrawElement() {
     }
 }
 
-bool UpdateFilters() {
+// ASCII only, ::tolower is undefined for the negative chars of UTF-8 bytes
+std::string ToLowerSearchString(std::string str) {
+    for (char& c : str) {
+        if (c >= 'A' && c <= 'Z') {
+            c += 'a' - 'A';
+        }
+    }
+    return str;
+}
+
+void BuildSearchIndex() {
+    for (int i = 0; i < RCAREA_INVALID; i++) {
+        areaSearchNames[i] =
+            ToLowerSearchString(RandomizerCheckObjects::GetRCAreaName(static_cast<RandomizerCheckArea>(i)));
+    }
     for (auto& [rcArea, checks] : checksByArea) {
-        filterAreasHidden[rcArea] = !checkSearch.PassFilter(RandomizerCheckObjects::GetRCAreaName(rcArea).c_str());
-        for (auto check : checks) {
-            if (ShouldShowCheck(check)) {
-                filterAreasHidden[rcArea] = false;
-                filterChecksHidden[check] = false;
-            } else {
-                filterChecksHidden[check] = true;
-            }
+        for (auto rc : checks) {
+            Rando::Location* loc = Rando::StaticData::GetLocation(rc);
+            checkSearchNames[rc] = ToLowerSearchString(loc->GetShortName() + " " + loc->GetName() + " " +
+                                                       RandomizerCheckObjects::GetRCAreaName(loc->GetArea()));
+        }
+    }
+}
+
+void UpdateSearchTerms() {
+    searchTerms.clear();
+    searchHasIncludeTerm = false;
+    for (const ImGuiTextFilter::ImGuiTextRange& filter : checkSearch.Filters) {
+        if (filter.empty()) {
+            continue;
+        }
+        bool exclude = filter.b[0] == '-';
+        std::string term = ToLowerSearchString(std::string(exclude ? filter.b + 1 : filter.b, filter.e));
+        if (term.empty()) {
+            continue;
+        }
+        searchHasIncludeTerm |= !exclude;
+        searchTerms.emplace_back(std::move(term), exclude);
+    }
+}
+
+// Same matching as ImGuiTextFilter::PassFilter, against an already lowercase string
+bool PassesSearch(const std::string& search) {
+    for (auto& [term, exclude] : searchTerms) {
+        if (search.find(term) != std::string::npos) {
+            return !exclude;
+        }
+    }
+    return !searchHasIncludeTerm;
+}
+
+// The hide settings for the status of a check, and the available checks filter
+bool IsCheckRowShown(RandomizerCheck rc) {
+    Rando::ItemLocation* itemLoc = OTRGlobals::Instance->gRandoContext->GetItemLocation(rc);
+    RandomizerCheckStatus status = itemLoc->GetCheckStatus();
+
+    if (enableAvailableChecks && onlyShowAvailable && !itemLoc->IsAvailable()) {
+        return false;
+    }
+    if (showHidden) {
+        return true;
+    }
+    if (status == RCSHOW_COLLECTED) {
+        return !hideCollected;
+    } else if (status == RCSHOW_SAVED) {
+        return !hideSaved;
+    } else if (itemLoc->GetIsSkipped()) {
+        return !hideSkipped;
+    } else if (status == RCSHOW_SEEN || status == RCSHOW_IDENTIFIED) {
+        return !hideSeen;
+    } else if (status == RCSHOW_SCUMMED) {
+        return !hideScummed;
+    } else if (status == RCSHOW_UNCHECKED) {
+        return !hideUnchecked;
+    }
+    return true;
+}
+
+uint32_t GetVisibleChecksSettings() {
+    return hideUnchecked | hideScummed << 1 | hideSeen << 2 | hideSkipped << 3 | hideSaved << 4 |
+           hideCollected << 5 | showHidden << 6 | mystery << 7 | enableAvailableChecks << 8 | onlyShowAvailable << 9 |
+           hideShopUnshuffledChecks << 10 | alwaysShowGS << 11;
+}
+
+void RebuildVisibleChecks(RandomizerCheckArea rcArea) {
+    std::vector<RandomizerCheck>& visibleChecks = visibleChecksByArea[rcArea];
+    visibleChecks.clear();
+    for (auto rc : checksByArea.at(rcArea)) {
+        if (!filterChecksHidden[rc] && IsCheckRowShown(rc)) {
+            visibleChecks.push_back(rc);
         }
     }
+}
+
+// Re-runs the search for the checks of a single area, whose item names may have been revealed, and rebuilds the
+// checks it draws
+void UpdateAreaFilter(RandomizerCheckArea rcArea) {
+    if (!checksByArea.contains(rcArea)) {
+        return;
+    }
+    filterAreasHidden[rcArea] = !PassesSearch(areaSearchNames[rcArea]);
+    for (auto check : checksByArea.at(rcArea)) {
+        filterChecksHidden[check] = !ShouldShowCheck(check);
+        if (!filterChecksHidden[check]) {
+            filterAreasHidden[rcArea] = false;
+        }
+    }
+    RebuildVisibleChecks(rcArea);
+}
+
+bool UpdateFilters() {
+    for (auto& [rcArea, checks] : checksByArea) {
+        UpdateAreaFilter(rcArea);
+    }
 
     return true;
 }
 
 bool ShouldShowCheck(RandomizerCheck check) {
+    if (!IsVisibleInCheckTracker(check)) {
+        return false;
+    }
+    if (searchTerms.empty()) {
+        return true;
+    }
+
+    // Only the item name depends on the check status, everything else comes from the search index
     auto itemLoc = Rando::Context::GetInstance()->GetItemLocation(check);
-    std::string search = (Rando::StaticData::GetLocation(check)->GetShortName() + " " +
-                          Rando::StaticData::GetLocation(check)->GetName() + " " +
-                          RandomizerCheckObjects::GetRCAreaName(Rando::StaticData::GetLocation(check)->GetArea()));
+    std::string itemName;
     if (itemLoc->HasObtained() || itemLoc->GetCheckStatus() == RCSHOW_SCUMMED ||
         (!mystery && (itemLoc->GetCheckStatus() == RCSHOW_IDENTIFIED || itemLoc->GetCheckStatus() == RCSHOW_SEEN) &&
          itemLoc->GetPlacedRandomizerGet() != RG_ICE_TRAP)) {
-        search += " " + itemLoc->GetPlacedItemName().GetForLanguage(gSaveContext.language);
+        itemName = itemLoc->GetPlacedItemName().GetForLanguage(gSaveContext.language);
     } else if (itemLoc->GetCheckStatus() == RCSHOW_IDENTIFIED && !mystery) {
-        search +=
+        itemName =
             OTRGlobals::Instance->gRandoContext->overrides[check].GetTrickName().GetForLanguage(gSaveContext.language);
     } else if (itemLoc->GetCheckStatus() == RCSHOW_SEEN && !mystery) {
-        search += Rando::StaticData::RetrieveItem(OTRGlobals::Instance->gRandoContext->overrides[check].LooksLike())
-                      .GetName()
-                      .GetForLanguage(gSaveContext.language);
+        itemName = Rando::StaticData::RetrieveItem(OTRGlobals::Instance->gRandoContext->overrides[check].LooksLike())
+                       .GetName()
+                       .GetForLanguage(gSaveContext.language);
     }
-    return (IsVisibleInCheckTracker(check) &&
-            (checkSearch.Filters.Size == 0 || checkSearch.PassFilter(search.c_str())));
+    if (itemName.empty()) {
+        return PassesSearch(checkSearchNames[check]);
+    }
+    return PassesSearch(checkSearchNames[check] + " " + ToLowerSearchString(itemName));
 }
 
 // Windowing stuff
@@ -1704,6 +1856,7 @@ void UpdateOrdering(RandomizerCheckArea rcArea) {
     // Sort a single area
     if (checksByArea.contains(rcArea)) {
         std::sort(checksByArea.find(rcArea)->second.begin(), checksByArea.find(rcArea)->second.end(), CompareChecks);
+        UpdateAreaFilter(rcArea);
     }
     RecalculateAllAreaTotals();
     CalculateTotals();
@@ -1770,59 +1923,37 @@ void DrawLocation(RandomizerCheck rc) {
     bool skipped = itemLoc->GetIsSkipped();
     bool available = itemLoc->IsAvailable();
 
-    if (enableAvailableChecks && onlyShowAvailable && !available) {
-        return;
-    }
-
     if (status == RCSHOW_COLLECTED) {
-        if (!showHidden && hideCollected) {
-            return;
-        }
         mainColor =
             !IsHeartPiece((GetItemID)Rando::StaticData::RetrieveItem(loc->GetVanillaItem()).GetItemID()) && !IS_RANDO
                 ? Color_Collected_Extra
                 : Color_Collected_Main;
         extraColor = Color_Collected_Extra;
     } else if (status == RCSHOW_SAVED) {
-        if (!showHidden && hideSaved) {
-            return;
-        }
         mainColor =
             !IsHeartPiece((GetItemID)Rando::StaticData::RetrieveItem(loc->GetVanillaItem()).GetItemID()) && !IS_RANDO
                 ? Color_Saved_Extra
                 : Color_Saved_Main;
         extraColor = Color_Saved_Extra;
     } else if (skipped) {
-        if (!showHidden && hideSkipped) {
-            return;
-        }
         mainColor =
             !IsHeartPiece((GetItemID)Rando::StaticData::RetrieveItem(loc->GetVanillaItem()).GetItemID()) && !IS_RANDO
                 ? Color_Skipped_Extra
                 : Color_Skipped_Main;
         extraColor = Color_Skipped_Extra;
     } else if (status == RCSHOW_SEEN || status == RCSHOW_IDENTIFIED) {
-        if (!showHidden && hideSeen) {
-            return;
-        }
         mainColor =
             !IsHeartPiece((GetItemID)Rando::StaticData::RetrieveItem(loc->GetVanillaItem()).GetItemID()) && !IS_RANDO
                 ? Color_Seen_Extra
                 : Color_Seen_Main;
         extraColor = Color_Seen_Extra;
     } else if (status == RCSHOW_SCUMMED) {
-        if (!showHidden && hideScummed) {
-            return;
-        }
         mainColor =
             !IsHeartPiece((GetItemID)Rando::StaticData::RetrieveItem(loc->GetVanillaItem()).GetItemID()) && !IS_RANDO
                 ? Color_Scummed_Extra
                 : Color_Scummed_Main;
         extraColor = Color_Scummed_Extra;
     } else if (status == RCSHOW_UNCHECKED) {
-        if (!showHidden && hideUnchecked) {
-            return;
-        }
         mainColor =
             !IsHeartPiece((GetItemID)Rando::StaticData::RetrieveItem(loc->GetVanillaItem()).GetItemID()) && !IS_RANDO
                 ? Color_Unchecked_Extra
@@ -2092,6 +2223,9 @@ void RecalculateAvailableChecks(RandomizerRegion startingRegion /* = RR_ROOT */)
             }
         }
         totalChecksAvailable += areaChecksAvailable[rcArea];
+        if (onlyShowAvailable) {
+            RebuildVisibleChecks(rcArea);
+        }
     }
 
     StopPerformanceTimer(PT_RECALCULATE_AVAILABLE_CHECKS);
@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <libultraship/libultraship.h>
@@ -10,6 +11,7 @@
 #include "randomizer_item_tracker.h"
 #include "randomizerTypes.h"
 #include "soh/cvar_prefixes.h"
+#include "soh/Enhancements/debugger/frameProfiler.h"
 #include "soh/Enhancements/game-interactor/GameInteractor.h"
 #include "soh/OTRGlobals.h"
 #include "soh/ResourceManagerHelpers.h"
@@ -30,12 +32,12 @@ extern PlayState* gPlayState;
 #include "textures/icon_item_24_static/icon_item_24_static.h"
 }
 
-void DrawEquip(ItemTrackerItem item);
-void DrawItem(ItemTrackerItem item);
-void DrawDungeonItem(ItemTrackerItem item);
-void DrawBottle(ItemTrackerItem item);
-void DrawQuest(ItemTrackerItem item);
-void DrawSong(ItemTrackerItem item);
+void DrawEquip(const ItemTrackerItem& item);
+void DrawItem(const ItemTrackerItem& item);
+void DrawDungeonItem(const ItemTrackerItem& item);
+void DrawBottle(const ItemTrackerItem& item);
+void DrawQuest(const ItemTrackerItem& item);
+void DrawSong(const ItemTrackerItem& item);
 
 int itemTrackerSectionId;
 
@@ -403,6 +405,62 @@ static bool presetLoaded = false;
 static std::unordered_map<std::string, ImVec2> presetPos;
 static std::unordered_map<std::string, ImVec2> presetSize;
 
+// Everything the tracker windows are drawn with, read from the cvars when shouldUpdateVectors is set
+struct ItemTrackerSettings {
+    int iconSize;
+    int iconSpacing;
+    int textSize;
+    int windowType;
+    int displayMain;
+    int comboButton1Mask;
+    int comboButton2Mask;
+    bool showOnlyPaused;
+    bool draggable;
+    ImVec4 bgColor;
+    int itemCountType;
+    int keyCounts;
+    int triforcePieceCounts;
+    bool hookshotIdentifier;
+    bool itemCountAlignLeft;
+    bool dungeonRewardsLayout;
+    bool dungeonItemsLayout;
+    bool dungeonItemsDisplayMaps;
+    int displayInventory;
+    int displayEquipment;
+    int displayMisc;
+    int displayDungeonRewards;
+    int displaySongs;
+    int displayDungeonItems;
+    int displayGreg;
+    int displayTriforcePieces;
+    int displayBossSouls;
+    int displayOcarinaButtons;
+    int displayOverworldKeys;
+    int displayFishingPole;
+    int displayNotes;
+    int displayTotalChecks;
+    bool hasMainWindow;
+};
+
+static ItemTrackerSettings trackerSettings;
+// Bumped whenever the settings are read again, cached count labels built with older settings are rebuilt
+static uint32_t settingsGeneration = 0;
+// Bumped when the textures are reloaded, item texture handles resolved before that are resolved again
+static uint32_t textureGeneration = 1;
+
+ImTextureID GetItemTexture(const ItemTrackerItem& item, bool hasItem) {
+    if (item.textureGeneration != textureGeneration) {
+        auto gui = Ship::Context::GetInstance()->GetWindow()->GetGui();
+        item.texture = gui->GetTextureByName(item.name);
+        item.textureFaded = gui->GetTextureByName(item.nameFaded);
+        // Keep trying until both textures are loaded
+        if (item.texture && item.textureFaded) {
+            item.textureGeneration = textureGeneration;
+        }
+    }
+    return hasItem ? item.texture : item.textureFaded;
+}
+
 void ItemTrackerOnFrame() {
     if (notesNeedSave && notesIdleFrames <= notesMaxIdleFrames) {
         notesIdleFrames++;
@@ -414,15 +472,15 @@ bool IsValidSaveFile() {
     return validSave;
 }
 
-bool HasSong(ItemTrackerItem item) {
+bool HasSong(const ItemTrackerItem& item) {
     return GameInteractor::IsSaveLoaded() ? ((1 << item.id) & gSaveContext.inventory.questItems) : false;
 }
 
-bool HasQuestItem(ItemTrackerItem item) {
+bool HasQuestItem(const ItemTrackerItem& item) {
     return GameInteractor::IsSaveLoaded() ? (item.data & gSaveContext.inventory.questItems) : false;
 }
 
-bool HasEquipment(ItemTrackerItem item) {
+bool HasEquipment(const ItemTrackerItem& item) {
     return GameInteractor::IsSaveLoaded() ? (item.data & gSaveContext.inventory.equipment) : false;
 }
 
@@ -436,7 +494,7 @@ void ItemTracker_LoadFromPreset(nlohmann::json trackerInfo) {
     }
 }
 
-ItemTrackerNumbers GetItemCurrentAndMax(ItemTrackerItem item) {
+ItemTrackerNumbers GetItemCurrentAndMax(const ItemTrackerItem& item) {
     ItemTrackerNumbers result;
     result.currentCapacity = 0;
     result.maxCapacity = 0;
@@ -567,77 +625,61 @@ ItemTrackerNumbers GetItemCurrentAndMax(ItemTrackerItem item) {
 #define IM_COL_PURPLE IM_COL32(180, 90, 200, 255)
 #define IM_COL_LIGHT_YELLOW IM_COL32(255, 255, 130, 255)
 
-void DrawItemCount(ItemTrackerItem item, bool hideMax) {
-    if (!GameInteractor::IsSaveLoaded()) {
-        return;
-    }
-    int iconSize = CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36);
-    int textSize = CVarGetInteger(CVAR_TRACKER_ITEM("TextSize"), 13);
-    ItemTrackerNumbers currentAndMax = GetItemCurrentAndMax(item);
-    ImVec2 p = ImGui::GetCursorScreenPos();
-    int32_t trackerNumberDisplayMode =
-        CVarGetInteger(CVAR_TRACKER_ITEM("ItemCountType"), ITEM_TRACKER_NUMBER_CURRENT_CAPACITY_ONLY);
-    int32_t trackerKeyNumberDisplayMode = CVarGetInteger(CVAR_TRACKER_ITEM("KeyCounts"), KEYS_COLLECTED_MAX);
-    float textScalingFactor = static_cast<float>(iconSize) / 36.0f;
-    uint32_t actualItemId = INV_CONTENT(item.id);
-    bool hasItem = actualItemId != ITEM_NONE;
-
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("HookshotIdentifier"), 0)) {
-        if ((actualItemId == ITEM_HOOKSHOT || actualItemId == ITEM_LONGSHOT) && hasItem) {
-
-            // Calculate the scaled position for the text
-            ImVec2 textPos =
-                ImVec2(p.x + (iconSize / 2) -
-                           (ImGui::CalcTextSize(item.id == ITEM_HOOKSHOT ? "H" : "L").x * textScalingFactor / 2) +
-                           8 * textScalingFactor,
-                       p.y - 22 * textScalingFactor);
+typedef enum {
+    ITEM_COUNT_LABEL_NONE,
+    ITEM_COUNT_LABEL_KEYS,
+    ITEM_COUNT_LABEL_AMMO_CAPACITY,
+    ITEM_COUNT_LABEL_TRIFORCE_PIECES,
+} ItemCountLabelType;
+
+// The count under an item only changes with the numbers it shows and the tracker settings, so its strings, colors
+// and position are kept per item until one of those changes instead of being rebuilt every frame
+struct ItemCountLabel {
+    ItemCountLabelType type = ITEM_COUNT_LABEL_NONE;
+    ItemTrackerNumbers numbers = {};
+    int32_t triforcePieces = 0;
+    bool hideMax = false;
+    uint32_t generation = 0;
+    std::string current;
+    std::string max;
+    ImU32 currentColor;
+    ImU32 maxColor;
+    float offset;
+};
 
-            ImGui::SetCursorScreenPos(textPos);
-            ImGui::SetWindowFontScale(textScalingFactor);
+// Keyed by item id and data
+static std::unordered_map<uint64_t, ItemCountLabel> itemCountLabels;
 
-            ImGui::Text(item.id == ITEM_HOOKSHOT ? "H" : "L");
-            ImGui::SetWindowFontScale(1.0f); // Reset font scale to the original state
-        }
-    }
+void BuildItemCountLabel(const ItemTrackerItem& item, ItemCountLabel& label) {
+    const ItemTrackerNumbers& currentAndMax = label.numbers;
+    int32_t trackerNumberDisplayMode = trackerSettings.itemCountType;
+    int32_t trackerKeyNumberDisplayMode = trackerSettings.keyCounts;
+    bool shouldAlignToLeft = false;
 
-    ImGui::SetWindowFontScale(textSize / 13.0f);
+    label.current.clear();
+    label.max.clear();
+    label.currentColor = IM_COL_WHITE;
+    label.maxColor = IM_COL_GREEN;
 
-    if (item.id == ITEM_KEY_SMALL && IsValidSaveFile()) {
-        std::string currentString = "";
-        std::string maxString = hideMax ? "???" : std::to_string(currentAndMax.maxCapacity);
-        ImU32 currentColor = IM_COL_WHITE;
-        ImU32 maxColor = IM_COL_GREEN;
+    if (label.type == ITEM_COUNT_LABEL_KEYS) {
+        label.max = label.hideMax ? "???" : std::to_string(currentAndMax.maxCapacity);
         // "Collected / Max", "Current / Collected / Max", "Current / Max"
         if (trackerKeyNumberDisplayMode == KEYS_CURRENT_COLLECTED_MAX ||
             trackerKeyNumberDisplayMode == KEYS_CURRENT_MAX) {
-            currentString += std::to_string(currentAndMax.currentAmmo);
-            currentString += "/";
+            label.current += std::to_string(currentAndMax.currentAmmo);
+            label.current += "/";
         }
         if (trackerKeyNumberDisplayMode == KEYS_COLLECTED_MAX ||
             trackerKeyNumberDisplayMode == KEYS_CURRENT_COLLECTED_MAX) {
-            currentString += std::to_string(currentAndMax.currentCapacity);
-            currentString += "/";
+            label.current += std::to_string(currentAndMax.currentCapacity);
+            label.current += "/";
         }
+    } else if (label.type == ITEM_COUNT_LABEL_AMMO_CAPACITY) {
+        label.maxColor = item.id == QUEST_SKULL_TOKEN ? IM_COL_RED : IM_COL_GREEN;
 
-        ImGui::SetCursorScreenPos(
-            ImVec2(p.x + (iconSize / 2) - (ImGui::CalcTextSize((currentString + maxString).c_str()).x / 2), p.y - 14));
-        ImGui::PushStyleColor(ImGuiCol_Text, currentColor);
-        ImGui::Text("%s", currentString.c_str());
-        ImGui::PopStyleColor();
-        ImGui::SameLine(0, 0.0f);
-        ImGui::PushStyleColor(ImGuiCol_Text, maxColor);
-        ImGui::Text("%s", maxString.c_str());
-        ImGui::PopStyleColor();
-    } else if (currentAndMax.currentCapacity > 0 && trackerNumberDisplayMode != ITEM_TRACKER_NUMBER_NONE &&
-               IsValidSaveFile()) {
-        std::string currentString = "";
-        std::string maxString = "";
-        ImU32 currentColor = IM_COL_WHITE;
-        ImU32 maxColor = item.id == QUEST_SKULL_TOKEN ? IM_COL_RED : IM_COL_GREEN;
-
-        bool shouldAlignToLeft = CVarGetInteger(CVAR_TRACKER_ITEM("ItemCountAlignLeft"), 0) &&
-                                 trackerNumberDisplayMode != ITEM_TRACKER_NUMBER_CAPACITY &&
-                                 trackerNumberDisplayMode != ITEM_TRACKER_NUMBER_AMMO;
+        shouldAlignToLeft = trackerSettings.itemCountAlignLeft &&
+                            trackerNumberDisplayMode != ITEM_TRACKER_NUMBER_CAPACITY &&
+                            trackerNumberDisplayMode != ITEM_TRACKER_NUMBER_AMMO;
 
         bool shouldDisplayAmmo = trackerNumberDisplayMode == ITEM_TRACKER_NUMBER_AMMO ||
                                  trackerNumberDisplayMode == ITEM_TRACKER_NUMBER_CURRENT_AMMO_ONLY ||
@@ -649,101 +691,142 @@ void DrawItemCount(ItemTrackerItem item, bool hideMax) {
                                   trackerNumberDisplayMode == ITEM_TRACKER_NUMBER_CURRENT_AMMO_ONLY);
 
         if (shouldDisplayAmmo) {
-            currentString = std::to_string(currentAndMax.currentAmmo);
+            label.current = std::to_string(currentAndMax.currentAmmo);
             if (currentAndMax.currentAmmo >= currentAndMax.currentCapacity) {
                 if (item.id == QUEST_SKULL_TOKEN) {
-                    currentColor = IM_COL_RED;
+                    label.currentColor = IM_COL_RED;
                 } else {
-                    currentColor = IM_COL_GREEN;
+                    label.currentColor = IM_COL_GREEN;
                 }
             }
             if (shouldDisplayMax) {
-                currentString += "/";
-                maxString = std::to_string(currentAndMax.currentCapacity);
+                label.current += "/";
+                label.max = std::to_string(currentAndMax.currentCapacity);
             }
             if (currentAndMax.currentAmmo <= 0) {
-                currentColor = IM_COL_GRAY;
+                label.currentColor = IM_COL_GRAY;
             }
         } else {
-            currentString = std::to_string(currentAndMax.currentCapacity);
+            label.current = std::to_string(currentAndMax.currentCapacity);
             if (currentAndMax.currentCapacity >= currentAndMax.maxCapacity) {
-                currentColor = IM_COL_GREEN;
+                label.currentColor = IM_COL_GREEN;
             } else if (shouldDisplayMax) {
-                currentString += "/";
-                maxString = std::to_string(currentAndMax.maxCapacity);
+                label.current += "/";
+                label.max = std::to_string(currentAndMax.maxCapacity);
             }
         }
-
-        float x = shouldAlignToLeft
-                      ? p.x
-                      : p.x + (iconSize / 2) - (ImGui::CalcTextSize((currentString + maxString).c_str()).x / 2);
-
-        ImGui::SetCursorScreenPos(ImVec2(x, p.y - 14));
-        ImGui::PushStyleColor(ImGuiCol_Text, currentColor);
-        ImGui::Text("%s", currentString.c_str());
-        ImGui::PopStyleColor();
-        ImGui::SameLine(0, 0.0f);
-        ImGui::PushStyleColor(ImGuiCol_Text, maxColor);
-        ImGui::Text("%s", maxString.c_str());
-        ImGui::PopStyleColor();
-    } else if (item.id == RG_TRIFORCE_PIECE && IS_RANDO &&
-               OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_TRIFORCE_HUNT) && IsValidSaveFile()) {
-        std::string currentString = "";
-        std::string requiredString = "";
-        std::string maxString = "";
+    } else if (label.type == ITEM_COUNT_LABEL_TRIFORCE_PIECES) {
         uint8_t piecesRequired =
             (OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_TRIFORCE_HUNT_PIECES_REQUIRED) + 1);
         uint8_t piecesTotal =
             (OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_TRIFORCE_HUNT_PIECES_TOTAL) + 1);
-        ImU32 currentColor = gSaveContext.ship.quest.data.randomizer.triforcePiecesCollected >= piecesRequired
-                                 ? IM_COL_GREEN
-                                 : IM_COL_WHITE;
-        ImU32 maxColor = IM_COL_GREEN;
-        int32_t trackerTriforcePieceNumberDisplayMode =
-            CVarGetInteger(CVAR_TRACKER_ITEM("TriforcePieceCounts"), TRIFORCE_PIECE_COLLECTED_REQUIRED_MAX);
-
-        currentString += std::to_string(gSaveContext.ship.quest.data.randomizer.triforcePiecesCollected);
-        currentString += "/";
+        label.currentColor = label.triforcePieces >= piecesRequired ? IM_COL_GREEN : IM_COL_WHITE;
+        int32_t trackerTriforcePieceNumberDisplayMode = trackerSettings.triforcePieceCounts;
+
+        label.current += std::to_string(label.triforcePieces);
+        label.current += "/";
         // gItemTrackerTriforcePieceTrack
         if (trackerTriforcePieceNumberDisplayMode == TRIFORCE_PIECE_COLLECTED_REQUIRED_MAX) {
-            currentString += std::to_string(piecesRequired);
-            currentString += "/";
-            maxString += std::to_string(piecesTotal);
+            label.current += std::to_string(piecesRequired);
+            label.current += "/";
+            label.max += std::to_string(piecesTotal);
         } else if (trackerTriforcePieceNumberDisplayMode == TRIFORCE_PIECE_COLLECTED_REQUIRED) {
-            maxString += std::to_string(piecesRequired);
+            label.max += std::to_string(piecesRequired);
         }
+    }
 
-        ImGui::SetCursorScreenPos(
-            ImVec2(p.x + (iconSize / 2) - (ImGui::CalcTextSize((currentString + maxString).c_str()).x / 2), p.y - 14));
-        ImGui::PushStyleColor(ImGuiCol_Text, currentColor);
-        ImGui::Text("%s", currentString.c_str());
-        ImGui::PopStyleColor();
-        ImGui::SameLine(0, 0.0f);
-        ImGui::PushStyleColor(ImGuiCol_Text, maxColor);
-        ImGui::Text("%s", maxString.c_str());
-        ImGui::PopStyleColor();
-    } else {
+    label.offset = shouldAlignToLeft ? 0.0f
+                                     : (trackerSettings.iconSize / 2) -
+                                           (ImGui::CalcTextSize((label.current + label.max).c_str()).x / 2);
+    label.generation = settingsGeneration;
+}
+
+void DrawItemCount(const ItemTrackerItem& item, bool hideMax) {
+    if (!GameInteractor::IsSaveLoaded()) {
+        return;
+    }
+    int iconSize = trackerSettings.iconSize;
+    ItemTrackerNumbers currentAndMax = GetItemCurrentAndMax(item);
+    ImVec2 p = ImGui::GetCursorScreenPos();
+    float textScalingFactor = static_cast<float>(iconSize) / 36.0f;
+    uint32_t actualItemId = INV_CONTENT(item.id);
+    bool hasItem = actualItemId != ITEM_NONE;
+
+    if (trackerSettings.hookshotIdentifier) {
+        if ((actualItemId == ITEM_HOOKSHOT || actualItemId == ITEM_LONGSHOT) && hasItem) {
+
+            // Calculate the scaled position for the text
+            ImVec2 textPos =
+                ImVec2(p.x + (iconSize / 2) -
+                           (ImGui::CalcTextSize(item.id == ITEM_HOOKSHOT ? "H" : "L").x * textScalingFactor / 2) +
+                           8 * textScalingFactor,
+                       p.y - 22 * textScalingFactor);
+
+            ImGui::SetCursorScreenPos(textPos);
+            ImGui::SetWindowFontScale(textScalingFactor);
+
+            ImGui::Text(item.id == ITEM_HOOKSHOT ? "H" : "L");
+            ImGui::SetWindowFontScale(1.0f); // Reset font scale to the original state
+        }
+    }
+
+    ImGui::SetWindowFontScale(trackerSettings.textSize / 13.0f);
+
+    ItemCountLabelType type = ITEM_COUNT_LABEL_NONE;
+    int32_t triforcePieces = 0;
+    if (item.id == ITEM_KEY_SMALL && IsValidSaveFile()) {
+        type = ITEM_COUNT_LABEL_KEYS;
+    } else if (currentAndMax.currentCapacity > 0 && trackerSettings.itemCountType != ITEM_TRACKER_NUMBER_NONE &&
+               IsValidSaveFile()) {
+        type = ITEM_COUNT_LABEL_AMMO_CAPACITY;
+    } else if (item.id == RG_TRIFORCE_PIECE && IS_RANDO &&
+               OTRGlobals::Instance->gRandomizer->GetRandoSettingValue(RSK_TRIFORCE_HUNT) && IsValidSaveFile()) {
+        type = ITEM_COUNT_LABEL_TRIFORCE_PIECES;
+        triforcePieces = gSaveContext.ship.quest.data.randomizer.triforcePiecesCollected;
+    }
+
+    if (type == ITEM_COUNT_LABEL_NONE) {
         ImGui::SetCursorScreenPos(ImVec2(p.x, p.y - 14));
         ImGui::Text("");
+        return;
     }
+
+    ItemCountLabel& label = itemCountLabels[(static_cast<uint64_t>(item.id) << 32) | item.data];
+    if (label.generation != settingsGeneration || label.type != type || label.hideMax != hideMax ||
+        label.triforcePieces != triforcePieces || label.numbers.currentAmmo != currentAndMax.currentAmmo ||
+        label.numbers.currentCapacity != currentAndMax.currentCapacity ||
+        label.numbers.maxCapacity != currentAndMax.maxCapacity) {
+        label.type = type;
+        label.numbers = currentAndMax;
+        label.triforcePieces = triforcePieces;
+        label.hideMax = hideMax;
+        BuildItemCountLabel(item, label);
+    }
+
+    ImGui::SetCursorScreenPos(ImVec2(p.x + label.offset, p.y - 14));
+    ImGui::PushStyleColor(ImGuiCol_Text, label.currentColor);
+    ImGui::Text("%s", label.current.c_str());
+    ImGui::PopStyleColor();
+    ImGui::SameLine(0, 0.0f);
+    ImGui::PushStyleColor(ImGuiCol_Text, label.maxColor);
+    ImGui::Text("%s", label.max.c_str());
+    ImGui::PopStyleColor();
 }
 
-void DrawEquip(ItemTrackerItem item) {
+void DrawEquip(const ItemTrackerItem& item) {
     bool hasEquip = HasEquipment(item);
-    float iconSize = static_cast<float>(CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36));
-    ImGui::Image(Ship::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(
-                     hasEquip && IsValidSaveFile() ? item.name : item.nameFaded),
+    float iconSize = static_cast<float>(trackerSettings.iconSize);
+    ImGui::Image(GetItemTexture(item, hasEquip && IsValidSaveFile()),
                  ImVec2(iconSize, iconSize), ImVec2(0.0f, 0.0f), ImVec2(1, 1));
 
     Tooltip(SohUtils::GetItemName(item.id).c_str());
 }
 
-void DrawQuest(ItemTrackerItem item) {
+void DrawQuest(const ItemTrackerItem& item) {
     bool hasQuestItem = HasQuestItem(item);
-    float iconSize = static_cast<float>(CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36));
+    float iconSize = static_cast<float>(trackerSettings.iconSize);
     ImGui::BeginGroup();
-    ImGui::ImageWithBg(Ship::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(
-                           hasQuestItem && IsValidSaveFile() ? item.name : item.nameFaded),
+    ImGui::ImageWithBg(GetItemTexture(item, hasQuestItem && IsValidSaveFile()),
                        ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
 
     if (item.id == QUEST_SKULL_TOKEN) {
@@ -755,10 +838,10 @@ void DrawQuest(ItemTrackerItem item) {
     Tooltip(SohUtils::GetQuestItemName(item.id).c_str());
 };
 
-void DrawItem(ItemTrackerItem item) {
+void DrawItem(const ItemTrackerItem& item) {
 
     uint32_t actualItemId = GameInteractor::IsSaveLoaded() ? INV_CONTENT(item.id) : ITEM_NONE;
-    float iconSize = static_cast<float>(CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36));
+    float iconSize = static_cast<float>(trackerSettings.iconSize);
     bool hasItem = actualItemId != ITEM_NONE;
     std::string itemName = "";
 
@@ -1011,23 +1094,23 @@ void DrawItem(ItemTrackerItem item) {
             break;
     }
 
+    const ItemTrackerItem* shownItem = &item;
     if (GameInteractor::IsSaveLoaded() &&
         (hasItem && item.id != actualItemId &&
          actualItemTrackerItemMap.find(actualItemId) != actualItemTrackerItemMap.end())) {
-        item = actualItemTrackerItemMap[actualItemId];
+        shownItem = &actualItemTrackerItemMap[actualItemId];
     }
 
     ImGui::BeginGroup();
 
-    ImGui::Image(Ship::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(
-                     hasItem && IsValidSaveFile() ? item.name : item.nameFaded),
+    ImGui::Image(GetItemTexture(*shownItem, hasItem && IsValidSaveFile()),
                  ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
 
-    DrawItemCount(item, false);
+    DrawItemCount(*shownItem, false);
 
-    if (item.id >= RG_GOHMA_SOUL && item.id <= RG_GANON_SOUL) {
+    if (shownItem->id >= RG_GOHMA_SOUL && shownItem->id <= RG_GANON_SOUL) {
         ImVec2 p = ImGui::GetCursorScreenPos();
-        std::string bossName = itemTrackerBossShortNames[item.id];
+        std::string bossName = itemTrackerBossShortNames[shownItem->id];
         ImGui::SetCursorScreenPos(
             ImVec2(p.x + (iconSize / 2) - (ImGui::CalcTextSize(bossName.c_str()).x / 2), p.y - (iconSize + 13)));
         ImGui::PushStyleColor(ImGuiCol_Text, IM_COL_WHITE);
@@ -1035,9 +1118,9 @@ void DrawItem(ItemTrackerItem item) {
         ImGui::PopStyleColor();
     }
 
-    if (item.id >= RG_OCARINA_A_BUTTON && item.id <= RG_OCARINA_C_RIGHT_BUTTON) {
+    if (shownItem->id >= RG_OCARINA_A_BUTTON && shownItem->id <= RG_OCARINA_C_RIGHT_BUTTON) {
         ImVec2 p = ImGui::GetCursorScreenPos();
-        std::string ocarinaButtonName = itemTrackerOcarinaButtonShortNames[item.id];
+        std::string ocarinaButtonName = itemTrackerOcarinaButtonShortNames[shownItem->id];
         ImGui::SetCursorScreenPos(ImVec2(p.x + (iconSize / 2) - (ImGui::CalcTextSize(ocarinaButtonName.c_str()).x / 2),
                                          p.y - (iconSize + 13)));
         ImGui::PushStyleColor(ImGuiCol_Text, IM_COL_WHITE);
@@ -1045,9 +1128,9 @@ void DrawItem(ItemTrackerItem item) {
         ImGui::PopStyleColor();
     }
 
-    if (item.id >= RG_GUARD_HOUSE_KEY && item.id <= RG_FISHING_HOLE_KEY) {
+    if (shownItem->id >= RG_GUARD_HOUSE_KEY && shownItem->id <= RG_FISHING_HOLE_KEY) {
         ImVec2 p = ImGui::GetCursorScreenPos();
-        std::string overworldKeyName = itemTrackerOverworldKeyShortNames[item.id];
+        std::string overworldKeyName = itemTrackerOverworldKeyShortNames[shownItem->id];
         ImGui::SetCursorScreenPos(ImVec2(p.x + (iconSize / 2) - (ImGui::CalcTextSize(overworldKeyName.c_str()).x / 2),
                                          p.y - (iconSize + 13)));
         ImGui::PushStyleColor(ImGuiCol_Text, IM_COL_WHITE);
@@ -1058,46 +1141,44 @@ void DrawItem(ItemTrackerItem item) {
     ImGui::EndGroup();
 
     if (itemName == "") {
-        itemName = SohUtils::GetItemName(item.id);
+        itemName = SohUtils::GetItemName(shownItem->id);
     }
 
     Tooltip(itemName.c_str());
 }
 
-void DrawBottle(ItemTrackerItem item) {
+void DrawBottle(const ItemTrackerItem& item) {
     uint32_t actualItemId =
         GameInteractor::IsSaveLoaded() ? (gSaveContext.inventory.items[SLOT(item.id) + item.data]) : false;
     bool hasItem = actualItemId != ITEM_NONE;
 
+    const ItemTrackerItem* shownItem = &item;
     if (GameInteractor::IsSaveLoaded() &&
         (hasItem && item.id != actualItemId &&
          actualItemTrackerItemMap.find(actualItemId) != actualItemTrackerItemMap.end())) {
-        item = actualItemTrackerItemMap[actualItemId];
+        shownItem = &actualItemTrackerItemMap[actualItemId];
     }
 
-    float iconSize = static_cast<float>(CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36));
-    ImGui::Image(Ship::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(
-                     hasItem && IsValidSaveFile() ? item.name : item.nameFaded),
+    float iconSize = static_cast<float>(trackerSettings.iconSize);
+    ImGui::Image(GetItemTexture(*shownItem, hasItem && IsValidSaveFile()),
                  ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
 
-    Tooltip(SohUtils::GetItemName(item.id).c_str());
+    Tooltip(SohUtils::GetItemName(shownItem->id).c_str());
 };
 
-void DrawDungeonItem(ItemTrackerItem item) {
+void DrawDungeonItem(const ItemTrackerItem& item) {
     uint32_t itemId = item.id;
     ImU32 dungeonColor = IM_COL_WHITE;
     uint32_t bitMask = 1 << (item.id - ITEM_KEY_BOSS); // Bitset starts at ITEM_KEY_BOSS == 0. the rest are sequential
-    float iconSize = static_cast<float>(CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36));
+    float iconSize = static_cast<float>(trackerSettings.iconSize);
     bool hasItem = GameInteractor::IsSaveLoaded() ? (bitMask & gSaveContext.inventory.dungeonItems[item.data]) : false;
     bool hasSmallKey = GameInteractor::IsSaveLoaded() ? ((gSaveContext.inventory.dungeonKeys[item.data]) >= 0) : false;
     ImGui::BeginGroup();
     if (itemId == ITEM_KEY_SMALL) {
-        ImGui::Image(Ship::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(
-                         hasSmallKey && IsValidSaveFile() ? item.name : item.nameFaded),
+        ImGui::Image(GetItemTexture(item, hasSmallKey && IsValidSaveFile()),
                      ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
     } else {
-        ImGui::Image(Ship::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(
-                         hasItem && IsValidSaveFile() ? item.name : item.nameFaded),
+        ImGui::Image(GetItemTexture(item, hasItem && IsValidSaveFile()),
                      ImVec2(iconSize, iconSize), ImVec2(0, 0), ImVec2(1, 1));
     }
 
@@ -1137,21 +1218,20 @@ void DrawDungeonItem(ItemTrackerItem item) {
     Tooltip(SohUtils::GetItemName(item.id).c_str());
 }
 
-void DrawSong(ItemTrackerItem item) {
-    float iconSize = static_cast<float>(CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36));
+void DrawSong(const ItemTrackerItem& item) {
+    float iconSize = static_cast<float>(trackerSettings.iconSize);
     ImVec2 p = ImGui::GetCursorScreenPos();
     bool hasSong = HasSong(item);
     ImGui::SetCursorScreenPos(ImVec2(p.x + 6, p.y));
-    ImGui::Image(Ship::Context::GetInstance()->GetWindow()->GetGui()->GetTextureByName(
-                     hasSong && IsValidSaveFile() ? item.name : item.nameFaded),
+    ImGui::Image(GetItemTexture(item, hasSong && IsValidSaveFile()),
                  ImVec2(iconSize / 1.5f, iconSize), ImVec2(0, 0), ImVec2(1, 1));
     Tooltip(SohUtils::GetQuestItemName(item.id).c_str());
 }
 
 void DrawNotes(bool resizeable = false) {
     ImGui::BeginGroup();
-    float iconSize = static_cast<float>(CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36));
-    int iconSpacing = CVarGetInteger(CVAR_TRACKER_ITEM("IconSpacing"), 12);
+    float iconSize = static_cast<float>(trackerSettings.iconSize);
+    int iconSpacing = trackerSettings.iconSpacing;
 
     struct ItemTrackerNotes {
         static int TrackerNotesResizeCallback(ImGuiInputTextCallbackData* data) {
@@ -1194,7 +1274,7 @@ void DrawTotalChecks() {
     uint16_t totalChecksGotten = CheckTracker::GetTotalChecksGotten();
 
     ImGui::BeginGroup();
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("WindowType"), TRACKER_WINDOW_FLOATING) == TRACKER_WINDOW_FLOATING) {
+    if (trackerSettings.windowType == TRACKER_WINDOW_FLOATING) {
         ImGui::SetWindowFontScale(2.5);
     } else {
         ImGui::SetWindowFontScale(1);
@@ -1212,16 +1292,16 @@ void BeginFloatingWindows(std::string UniqueName, ImGuiWindowFlags flags = 0) {
             ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoResize;
     }
 
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("WindowType"), TRACKER_WINDOW_FLOATING) == TRACKER_WINDOW_FLOATING) {
+    if (trackerSettings.windowType == TRACKER_WINDOW_FLOATING) {
         ImGui::SetNextWindowViewport(ImGui::GetMainViewport()->ID);
         windowFlags |= ImGuiWindowFlags_NoDocking | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoTitleBar |
                        ImGuiWindowFlags_NoScrollWithMouse | ImGuiWindowFlags_NoScrollbar;
 
-        if (!CVarGetInteger(CVAR_TRACKER_ITEM("Draggable"), 0)) {
+        if (!trackerSettings.draggable) {
             windowFlags |= ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoMove;
         }
     }
-    auto color = VecFromRGBA8(CVarGetColor(CVAR_TRACKER_ITEM("BgColor.Value"), { 0, 0, 0, 0 }));
+    auto color = trackerSettings.bgColor;
     auto maybeParent = ImGui::GetCurrentWindow();
     ImGuiWindow* window = ImGui::FindWindowByName(UniqueName.c_str());
     if (window != NULL && window->DockTabIsVisible && window->ParentWindow != NULL &&
@@ -1250,11 +1330,10 @@ void EndFloatingWindows() {
  * DrawItemsInRows
  * Takes in a vector of ItemTrackerItem and draws them in rows of N items
  */
-void DrawItemsInRows(std::vector<ItemTrackerItem> items, int columns = 6) {
-    float iconSize = static_cast<float>(CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36));
-    int iconSpacing = CVarGetInteger(CVAR_TRACKER_ITEM("IconSpacing"), 12);
-    int topPadding =
-        (CVarGetInteger(CVAR_TRACKER_ITEM("WindowType"), TRACKER_WINDOW_FLOATING) == TRACKER_WINDOW_WINDOW) ? 20 : 0;
+void DrawItemsInRows(const std::vector<ItemTrackerItem>& items, int columns = 6) {
+    float iconSize = static_cast<float>(trackerSettings.iconSize);
+    int iconSpacing = trackerSettings.iconSpacing;
+    int topPadding = (trackerSettings.windowType == TRACKER_WINDOW_WINDOW) ? 20 : 0;
 
     for (int i = 0; i < items.size(); i++) {
         int row = i / columns;
@@ -1269,9 +1348,9 @@ void DrawItemsInRows(std::vector<ItemTrackerItem> items, int columns = 6) {
  * DrawItemsInACircle
  * Takes in a vector of ItemTrackerItem and draws them evenly spread across a circle
  */
-void DrawItemsInACircle(std::vector<ItemTrackerItem> items) {
-    int iconSize = CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36);
-    int iconSpacing = CVarGetInteger(CVAR_TRACKER_ITEM("IconSpacing"), 12);
+void DrawItemsInACircle(const std::vector<ItemTrackerItem>& items) {
+    int iconSize = trackerSettings.iconSize;
+    int iconSpacing = trackerSettings.iconSpacing;
 
     ImVec2 max = ImGui::GetWindowContentRegionMax();
     float radius = (iconSize + iconSpacing) * 2.0f;
@@ -1280,7 +1359,7 @@ void DrawItemsInACircle(std::vector<ItemTrackerItem> items) {
         float angle = static_cast<float>(i) / items.size() * 2.0f * M_PIf;
         float x = (radius / 2.0f) * cos(angle) + max.x / 2.0f;
         float y = (radius / 2.0f) * sin(angle) + max.y / 2.0f;
-        ImGui::SetCursorPos(ImVec2(x - (CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36) - 8) / 2.0f, y + 4));
+        ImGui::SetCursorPos(ImVec2(x - (trackerSettings.iconSize - 8) / 2.0f, y + 4));
         items[i].drawFunc(items[i]);
     }
 }
@@ -1290,7 +1369,8 @@ void DrawItemsInACircle(std::vector<ItemTrackerItem> items) {
  * Loops over dungeons and creates vectors of items in the correct order
  * to then call DrawItemsInRows
  */
-std::vector<ItemTrackerItem> GetDungeonItemsVector(std::vector<ItemTrackerDungeon> dungeons, int columns = 6) {
+std::vector<ItemTrackerItem> GetDungeonItemsVector(const std::vector<ItemTrackerDungeon>& dungeons,
+                                                   int columns = 6) {
     std::vector<ItemTrackerItem> dungeonItems = {};
 
     int rowCount = 0;
@@ -1338,20 +1418,84 @@ std::vector<ItemTrackerItem> GetDungeonItemsVector(std::vector<ItemTrackerDungeo
 }
 /* ****************************************************** */
 
+void UpdateTrackerSettings() {
+    trackerSettings.iconSize = CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36);
+    trackerSettings.iconSpacing = CVarGetInteger(CVAR_TRACKER_ITEM("IconSpacing"), 12);
+    trackerSettings.textSize = CVarGetInteger(CVAR_TRACKER_ITEM("TextSize"), 13);
+    trackerSettings.windowType = CVarGetInteger(CVAR_TRACKER_ITEM("WindowType"), TRACKER_WINDOW_FLOATING);
+    trackerSettings.displayMain = CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Main"), TRACKER_DISPLAY_ALWAYS);
+    trackerSettings.comboButton1Mask =
+        buttonMap[CVarGetInteger(CVAR_TRACKER_ITEM("ComboButton1"), TRACKER_COMBO_BUTTON_L)];
+    trackerSettings.comboButton2Mask =
+        buttonMap[CVarGetInteger(CVAR_TRACKER_ITEM("ComboButton2"), TRACKER_COMBO_BUTTON_R)];
+    trackerSettings.showOnlyPaused = CVarGetInteger(CVAR_TRACKER_ITEM("ShowOnlyPaused"), 0);
+    trackerSettings.draggable = CVarGetInteger(CVAR_TRACKER_ITEM("Draggable"), 0);
+    trackerSettings.bgColor = VecFromRGBA8(CVarGetColor(CVAR_TRACKER_ITEM("BgColor.Value"), { 0, 0, 0, 0 }));
+    trackerSettings.itemCountType =
+        CVarGetInteger(CVAR_TRACKER_ITEM("ItemCountType"), ITEM_TRACKER_NUMBER_CURRENT_CAPACITY_ONLY);
+    trackerSettings.keyCounts = CVarGetInteger(CVAR_TRACKER_ITEM("KeyCounts"), KEYS_COLLECTED_MAX);
+    trackerSettings.triforcePieceCounts =
+        CVarGetInteger(CVAR_TRACKER_ITEM("TriforcePieceCounts"), TRIFORCE_PIECE_COLLECTED_REQUIRED_MAX);
+    trackerSettings.hookshotIdentifier = CVarGetInteger(CVAR_TRACKER_ITEM("HookshotIdentifier"), 0);
+    trackerSettings.itemCountAlignLeft = CVarGetInteger(CVAR_TRACKER_ITEM("ItemCountAlignLeft"), 0);
+    trackerSettings.dungeonRewardsLayout = CVarGetInteger(CVAR_TRACKER_ITEM("DungeonRewardsLayout"), 0);
+    trackerSettings.dungeonItemsLayout = CVarGetInteger(CVAR_TRACKER_ITEM("DungeonItems.Layout"), 1);
+    trackerSettings.dungeonItemsDisplayMaps = CVarGetInteger(CVAR_TRACKER_ITEM("DungeonItems.DisplayMaps"), 1);
+
+    trackerSettings.displayInventory =
+        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Inventory"), SECTION_DISPLAY_MAIN_WINDOW);
+    trackerSettings.displayEquipment =
+        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Equipment"), SECTION_DISPLAY_MAIN_WINDOW);
+    trackerSettings.displayMisc = CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Misc"), SECTION_DISPLAY_MAIN_WINDOW);
+    trackerSettings.displayDungeonRewards =
+        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.DungeonRewards"), SECTION_DISPLAY_MAIN_WINDOW);
+    trackerSettings.displaySongs = CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Songs"), SECTION_DISPLAY_MAIN_WINDOW);
+    trackerSettings.displayDungeonItems =
+        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.DungeonItems"), SECTION_DISPLAY_HIDDEN);
+    trackerSettings.displayGreg =
+        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Greg"), SECTION_DISPLAY_EXTENDED_HIDDEN);
+    trackerSettings.displayTriforcePieces =
+        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.TriforcePieces"), SECTION_DISPLAY_HIDDEN);
+    trackerSettings.displayBossSouls =
+        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.BossSouls"), SECTION_DISPLAY_HIDDEN);
+    trackerSettings.displayOcarinaButtons =
+        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.OcarinaButtons"), SECTION_DISPLAY_HIDDEN);
+    trackerSettings.displayOverworldKeys =
+        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.OverworldKeys"), SECTION_DISPLAY_HIDDEN);
+    trackerSettings.displayFishingPole =
+        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.FishingPole"), SECTION_DISPLAY_EXTENDED_HIDDEN);
+    trackerSettings.displayNotes = CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Notes"), SECTION_DISPLAY_HIDDEN);
+    trackerSettings.displayTotalChecks =
+        CVarGetInteger(CVAR_TRACKER_ITEM("TotalChecks.DisplayType"), SECTION_DISPLAY_MINIMAL_HIDDEN);
+
+    trackerSettings.hasMainWindow = trackerSettings.displayInventory == SECTION_DISPLAY_MAIN_WINDOW ||
+                                    trackerSettings.displayEquipment == SECTION_DISPLAY_MAIN_WINDOW ||
+                                    trackerSettings.displayMisc == SECTION_DISPLAY_MAIN_WINDOW ||
+                                    trackerSettings.displayDungeonRewards == SECTION_DISPLAY_MAIN_WINDOW ||
+                                    trackerSettings.displaySongs == SECTION_DISPLAY_MAIN_WINDOW ||
+                                    trackerSettings.displayDungeonItems == SECTION_DISPLAY_MAIN_WINDOW ||
+                                    trackerSettings.displayGreg == SECTION_DISPLAY_EXTENDED_MAIN_WINDOW ||
+                                    trackerSettings.displayTriforcePieces == SECTION_DISPLAY_MAIN_WINDOW ||
+                                    trackerSettings.displayFishingPole == SECTION_DISPLAY_EXTENDED_MAIN_WINDOW ||
+                                    trackerSettings.displayNotes == SECTION_DISPLAY_MAIN_WINDOW;
+
+    settingsGeneration++;
+}
+
 void UpdateVectors() {
     if (!shouldUpdateVectors) {
         return;
     }
 
+    UpdateTrackerSettings();
+
     dungeonRewards.clear();
     dungeonRewards.insert(dungeonRewards.end(), dungeonRewardStones.begin(), dungeonRewardStones.end());
     dungeonRewards.insert(dungeonRewards.end(), dungeonRewardMedallions.begin(), dungeonRewardMedallions.end());
 
     dungeonItems.clear();
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DungeonItems.Layout"), 1) &&
-        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.DungeonItems"), SECTION_DISPLAY_HIDDEN) ==
-            SECTION_DISPLAY_SEPARATE) {
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DungeonItems.DisplayMaps"), 1)) {
+    if (trackerSettings.dungeonItemsLayout && trackerSettings.displayDungeonItems == SECTION_DISPLAY_SEPARATE) {
+        if (trackerSettings.dungeonItemsDisplayMaps) {
             dungeonItems = GetDungeonItemsVector(itemTrackerDungeonsWithMapsHorizontal, 12);
             // Manually adding Thieves Hideout to an open spot so we don't get an additional row for one item
             dungeonItems[23] = ITEM_TRACKER_ITEM(ITEM_KEY_SMALL, SCENE_THIEVES_HIDEOUT, DrawDungeonItem);
@@ -1361,7 +1505,7 @@ void UpdateVectors() {
             dungeonItems[15] = ITEM_TRACKER_ITEM(ITEM_KEY_SMALL, SCENE_THIEVES_HIDEOUT, DrawDungeonItem);
         }
     } else {
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DungeonItems.DisplayMaps"), 1)) {
+        if (trackerSettings.dungeonItemsDisplayMaps) {
             dungeonItems = GetDungeonItemsVector(itemTrackerDungeonsWithMapsCompact);
             // Manually adding Thieves Hideout to an open spot so we don't get an additional row for one item
             dungeonItems[35] = ITEM_TRACKER_ITEM(ITEM_KEY_SMALL, SCENE_THIEVES_HIDEOUT, DrawDungeonItem);
@@ -1371,60 +1515,49 @@ void UpdateVectors() {
     }
 
     mainWindowItems.clear();
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Inventory"), SECTION_DISPLAY_MAIN_WINDOW) ==
-        SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displayInventory == SECTION_DISPLAY_MAIN_WINDOW) {
         mainWindowItems.insert(mainWindowItems.end(), inventoryItems.begin(), inventoryItems.end());
     }
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Equipment"), SECTION_DISPLAY_MAIN_WINDOW) ==
-        SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displayEquipment == SECTION_DISPLAY_MAIN_WINDOW) {
         mainWindowItems.insert(mainWindowItems.end(), equipmentItems.begin(), equipmentItems.end());
     }
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Misc"), SECTION_DISPLAY_MAIN_WINDOW) ==
-        SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displayMisc == SECTION_DISPLAY_MAIN_WINDOW) {
         mainWindowItems.insert(mainWindowItems.end(), miscItems.begin(), miscItems.end());
     }
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.DungeonRewards"), SECTION_DISPLAY_MAIN_WINDOW) ==
-        SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displayDungeonRewards == SECTION_DISPLAY_MAIN_WINDOW) {
         mainWindowItems.insert(mainWindowItems.end(), dungeonRewardStones.begin(), dungeonRewardStones.end());
         mainWindowItems.insert(mainWindowItems.end(), dungeonRewardMedallions.begin(), dungeonRewardMedallions.end());
     }
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Songs"), SECTION_DISPLAY_MAIN_WINDOW) ==
-        SECTION_DISPLAY_MAIN_WINDOW) {
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Misc"), SECTION_DISPLAY_MAIN_WINDOW) ==
-                SECTION_DISPLAY_MAIN_WINDOW &&
-            CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.DungeonRewards"), SECTION_DISPLAY_MAIN_WINDOW) !=
-                SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displaySongs == SECTION_DISPLAY_MAIN_WINDOW) {
+        if (trackerSettings.displayMisc == SECTION_DISPLAY_MAIN_WINDOW &&
+            trackerSettings.displayDungeonRewards != SECTION_DISPLAY_MAIN_WINDOW) {
             mainWindowItems.push_back(ITEM_TRACKER_ITEM(ITEM_NONE, 0, DrawItem));
             mainWindowItems.push_back(ITEM_TRACKER_ITEM(ITEM_NONE, 0, DrawItem));
             mainWindowItems.push_back(ITEM_TRACKER_ITEM(ITEM_NONE, 0, DrawItem));
         }
         mainWindowItems.insert(mainWindowItems.end(), songItems.begin(), songItems.end());
     }
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.DungeonItems"), SECTION_DISPLAY_HIDDEN) ==
-        SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displayDungeonItems == SECTION_DISPLAY_MAIN_WINDOW) {
         mainWindowItems.insert(mainWindowItems.end(), dungeonItems.begin(), dungeonItems.end());
     }
 
     // if we're adding greg to the misc window,
     // and misc isn't on the main window,
     // and it doesn't already have greg, add him
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Greg"), SECTION_DISPLAY_EXTENDED_HIDDEN) ==
-            SECTION_DISPLAY_EXTENDED_MISC_WINDOW &&
-        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Misc"), SECTION_DISPLAY_MAIN_WINDOW) !=
-            SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displayGreg == SECTION_DISPLAY_EXTENDED_MISC_WINDOW &&
+        trackerSettings.displayMisc != SECTION_DISPLAY_MAIN_WINDOW) {
         if (std::none_of(miscItems.begin(), miscItems.end(),
-                         [](ItemTrackerItem item) { return item.id == ITEM_RUPEE_GREEN; }))
+                         [](const ItemTrackerItem& item) { return item.id == ITEM_RUPEE_GREEN; }))
             miscItems.insert(miscItems.end(), gregItems.begin(), gregItems.end());
     } else {
         miscItems.erase(std::remove_if(miscItems.begin(), miscItems.end(),
-                                       [](ItemTrackerItem i) { return i.id == ITEM_RUPEE_GREEN; }),
+                                       [](const ItemTrackerItem& i) { return i.id == ITEM_RUPEE_GREEN; }),
                         miscItems.end());
     }
 
     bool newRowAdded = false;
     // if we're adding greg to the main window
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Greg"), SECTION_DISPLAY_EXTENDED_HIDDEN) ==
-        SECTION_DISPLAY_EXTENDED_MAIN_WINDOW) {
+    if (trackerSettings.displayGreg == SECTION_DISPLAY_EXTENDED_MAIN_WINDOW) {
         if (!newRowAdded) {
             // insert empty items until we're on a new row for greg
             while (mainWindowItems.size() % 6) {
@@ -1438,8 +1571,7 @@ void UpdateVectors() {
     }
 
     // If we're adding triforce pieces to the main window
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.TriforcePieces"), SECTION_DISPLAY_HIDDEN) ==
-        SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displayTriforcePieces == SECTION_DISPLAY_MAIN_WINDOW) {
         // If Greg isn't on the main window, add empty items to place the triforce pieces on a new row.
         if (!newRowAdded) {
             while (mainWindowItems.size() % 6) {
@@ -1453,21 +1585,18 @@ void UpdateVectors() {
     }
 
     // if misc is separate and fishing pole isn't added, add fishing pole to misc
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.FishingPole"), SECTION_DISPLAY_EXTENDED_HIDDEN) ==
-            SECTION_DISPLAY_EXTENDED_MISC_WINDOW &&
-        CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Misc"), SECTION_DISPLAY_MAIN_WINDOW) !=
-            SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displayFishingPole == SECTION_DISPLAY_EXTENDED_MISC_WINDOW &&
+        trackerSettings.displayMisc != SECTION_DISPLAY_MAIN_WINDOW) {
         if (std::none_of(miscItems.begin(), miscItems.end(),
-                         [](ItemTrackerItem item) { return item.id == ITEM_FISHING_POLE; }))
+                         [](const ItemTrackerItem& item) { return item.id == ITEM_FISHING_POLE; }))
             miscItems.insert(miscItems.end(), fishingPoleItems.begin(), fishingPoleItems.end());
     } else {
         miscItems.erase(std::remove_if(miscItems.begin(), miscItems.end(),
-                                       [](ItemTrackerItem i) { return i.id == ITEM_FISHING_POLE; }),
+                                       [](const ItemTrackerItem& i) { return i.id == ITEM_FISHING_POLE; }),
                         miscItems.end());
     }
     // add fishing pole to main window
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.FishingPole"), SECTION_DISPLAY_EXTENDED_HIDDEN) ==
-        SECTION_DISPLAY_EXTENDED_MAIN_WINDOW) {
+    if (trackerSettings.displayFishingPole == SECTION_DISPLAY_EXTENDED_MAIN_WINDOW) {
         if (!newRowAdded) {
             while (mainWindowItems.size() % 6) {
                 mainWindowItems.push_back(ITEM_TRACKER_ITEM(ITEM_NONE, 0, DrawItem));
@@ -1479,8 +1608,7 @@ void UpdateVectors() {
     }
 
     // If we're adding boss souls to the main window...
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.BossSouls"), SECTION_DISPLAY_HIDDEN) ==
-        SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displayBossSouls == SECTION_DISPLAY_MAIN_WINDOW) {
         //...add empty items on the main window to get the souls on their own row. (Too many to sit with Greg/Triforce
         // pieces)
         while (mainWindowItems.size() % 6) {
@@ -1492,8 +1620,7 @@ void UpdateVectors() {
     }
 
     // If we're adding ocarina buttons to the main window...
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.OcarinaButtons"), SECTION_DISPLAY_HIDDEN) ==
-        SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displayOcarinaButtons == SECTION_DISPLAY_MAIN_WINDOW) {
         //...add empty items on the main window to get the buttons on their own row. (Too many to sit with Greg/Triforce
         // pieces/boss souls)
         while (mainWindowItems.size() % 6) {
@@ -1505,8 +1632,7 @@ void UpdateVectors() {
     }
 
     // If we're adding overworld keys to the main window...
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.OverworldKeys"), SECTION_DISPLAY_HIDDEN) ==
-        SECTION_DISPLAY_MAIN_WINDOW) {
+    if (trackerSettings.displayOverworldKeys == SECTION_DISPLAY_MAIN_WINDOW) {
         //...add empty items on the main window to get the keys on their own row. (Too many to sit with Greg/Triforce
         // pieces/boss souls/ocarina buttons)
         while (mainWindowItems.size() % 6) {
@@ -1555,77 +1681,49 @@ void ItemTrackerWindow::Draw() {
 void ItemTrackerWindow::DrawElement() {
     UpdateVectors();
 
-    int iconSize = CVarGetInteger(CVAR_TRACKER_ITEM("IconSize"), 36);
-    int iconSpacing = CVarGetInteger(CVAR_TRACKER_ITEM("IconSpacing"), 12);
-    int comboButton1Mask = buttonMap[CVarGetInteger(CVAR_TRACKER_ITEM("ComboButton1"), TRACKER_COMBO_BUTTON_L)];
-    int comboButton2Mask = buttonMap[CVarGetInteger(CVAR_TRACKER_ITEM("ComboButton2"), TRACKER_COMBO_BUTTON_R)];
+    FRAME_PROFILER_SCOPE("ItemTracker");
+
     OSContPad* buttonsPressed =
         std::dynamic_pointer_cast<LUS::ControlDeck>(Ship::Context::GetInstance()->GetControlDeck())->GetPads();
-    bool comboButtonsHeld = buttonsPressed != nullptr && buttonsPressed[0].button & comboButton1Mask &&
-                            buttonsPressed[0].button & comboButton2Mask;
-    bool isPaused = CVarGetInteger(CVAR_TRACKER_ITEM("ShowOnlyPaused"), 0) == 0 ||
-                    gPlayState != nullptr && gPlayState->pauseCtx.state > 0;
-
-    if (CVarGetInteger(CVAR_TRACKER_ITEM("WindowType"), TRACKER_WINDOW_FLOATING) == TRACKER_WINDOW_WINDOW ||
-        isPaused &&
-            (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Main"), TRACKER_DISPLAY_ALWAYS) == TRACKER_DISPLAY_ALWAYS
-                 ? CVarGetInteger(CVAR_WINDOW("ItemTracker"), 0)
-                 : comboButtonsHeld)) {
-        if ((CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Inventory"), SECTION_DISPLAY_MAIN_WINDOW) ==
-             SECTION_DISPLAY_MAIN_WINDOW) ||
-            (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Equipment"), SECTION_DISPLAY_MAIN_WINDOW) ==
-             SECTION_DISPLAY_MAIN_WINDOW) ||
-            (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Misc"), SECTION_DISPLAY_MAIN_WINDOW) ==
-             SECTION_DISPLAY_MAIN_WINDOW) ||
-            (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.DungeonRewards"), SECTION_DISPLAY_MAIN_WINDOW) ==
-             SECTION_DISPLAY_MAIN_WINDOW) ||
-            (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Songs"), SECTION_DISPLAY_MAIN_WINDOW) ==
-             SECTION_DISPLAY_MAIN_WINDOW) ||
-            (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.DungeonItems"), SECTION_DISPLAY_HIDDEN) ==
-             SECTION_DISPLAY_MAIN_WINDOW) ||
-            (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Greg"), SECTION_DISPLAY_EXTENDED_HIDDEN) ==
-             SECTION_DISPLAY_EXTENDED_MAIN_WINDOW) ||
-            (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.TriforcePieces"), SECTION_DISPLAY_HIDDEN) ==
-             SECTION_DISPLAY_MAIN_WINDOW) ||
-            (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.FishingPole"), SECTION_DISPLAY_EXTENDED_HIDDEN) ==
-             SECTION_DISPLAY_EXTENDED_MAIN_WINDOW) ||
-            (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Notes"), SECTION_DISPLAY_HIDDEN) ==
-             SECTION_DISPLAY_MAIN_WINDOW)) {
+    bool comboButtonsHeld = buttonsPressed != nullptr && buttonsPressed[0].button & trackerSettings.comboButton1Mask &&
+                            buttonsPressed[0].button & trackerSettings.comboButton2Mask;
+    bool isPaused = !trackerSettings.showOnlyPaused || gPlayState != nullptr && gPlayState->pauseCtx.state > 0;
+
+    if (trackerSettings.windowType == TRACKER_WINDOW_WINDOW ||
+        isPaused && (trackerSettings.displayMain == TRACKER_DISPLAY_ALWAYS
+                         ? CVarGetInteger(CVAR_WINDOW("ItemTracker"), 0)
+                         : comboButtonsHeld)) {
+        if (trackerSettings.hasMainWindow) {
             BeginFloatingWindows("Item Tracker");
             DrawItemsInRows(mainWindowItems, 6);
 
-            if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Notes"), SECTION_DISPLAY_HIDDEN) ==
-                SECTION_DISPLAY_MAIN_WINDOW) {
+            if (trackerSettings.displayNotes == SECTION_DISPLAY_MAIN_WINDOW) {
                 DrawNotes();
             }
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Inventory"), SECTION_DISPLAY_MAIN_WINDOW) ==
-            SECTION_DISPLAY_SEPARATE) {
+        if (trackerSettings.displayInventory == SECTION_DISPLAY_SEPARATE) {
             BeginFloatingWindows("Inventory Items Tracker");
             DrawItemsInRows(inventoryItems);
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Equipment"), SECTION_DISPLAY_MAIN_WINDOW) ==
-            SECTION_DISPLAY_SEPARATE) {
+        if (trackerSettings.displayEquipment == SECTION_DISPLAY_SEPARATE) {
             BeginFloatingWindows("Equipment Items Tracker");
             DrawItemsInRows(equipmentItems, 3);
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Misc"), SECTION_DISPLAY_MAIN_WINDOW) ==
-            SECTION_DISPLAY_SEPARATE) {
+        if (trackerSettings.displayMisc == SECTION_DISPLAY_SEPARATE) {
             BeginFloatingWindows("Misc Items Tracker");
             DrawItemsInRows(miscItems, 4);
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.DungeonRewards"), SECTION_DISPLAY_MAIN_WINDOW) ==
-            SECTION_DISPLAY_SEPARATE) {
+        if (trackerSettings.displayDungeonRewards == SECTION_DISPLAY_SEPARATE) {
             BeginFloatingWindows("Dungeon Rewards Tracker");
-            if (CVarGetInteger(CVAR_TRACKER_ITEM("DungeonRewardsLayout"), 0)) {
+            if (trackerSettings.dungeonRewardsLayout) {
                 ImGui::BeginGroup();
                 DrawItemsInACircle(dungeonRewardMedallions);
                 ImGui::EndGroup();
@@ -1638,18 +1736,16 @@ void ItemTrackerWindow::DrawElement() {
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Songs"), SECTION_DISPLAY_MAIN_WINDOW) ==
-            SECTION_DISPLAY_SEPARATE) {
+        if (trackerSettings.displaySongs == SECTION_DISPLAY_SEPARATE) {
             BeginFloatingWindows("Songs Tracker");
             DrawItemsInRows(songItems);
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.DungeonItems"), SECTION_DISPLAY_HIDDEN) ==
-            SECTION_DISPLAY_SEPARATE) {
+        if (trackerSettings.displayDungeonItems == SECTION_DISPLAY_SEPARATE) {
             BeginFloatingWindows("Dungeon Items Tracker");
-            if (CVarGetInteger(CVAR_TRACKER_ITEM("DungeonItems.Layout"), 1)) {
-                if (CVarGetInteger(CVAR_TRACKER_ITEM("DungeonItems.DisplayMaps"), 1)) {
+            if (trackerSettings.dungeonItemsLayout) {
+                if (trackerSettings.dungeonItemsDisplayMaps) {
                     DrawItemsInRows(dungeonItems, 12);
                 } else {
                     DrawItemsInRows(dungeonItems, 8);
@@ -1660,62 +1756,53 @@ void ItemTrackerWindow::DrawElement() {
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Greg"), SECTION_DISPLAY_EXTENDED_HIDDEN) ==
-            SECTION_DISPLAY_EXTENDED_SEPARATE) {
+        if (trackerSettings.displayGreg == SECTION_DISPLAY_EXTENDED_SEPARATE) {
             BeginFloatingWindows("Greg Tracker");
             DrawItemsInRows(gregItems);
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.TriforcePieces"), SECTION_DISPLAY_HIDDEN) ==
-            SECTION_DISPLAY_SEPARATE) {
+        if (trackerSettings.displayTriforcePieces == SECTION_DISPLAY_SEPARATE) {
             BeginFloatingWindows("Triforce Piece Tracker");
             DrawItemsInRows(triforcePieces);
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.BossSouls"), SECTION_DISPLAY_HIDDEN) ==
-            SECTION_DISPLAY_SEPARATE) {
+        if (trackerSettings.displayBossSouls == SECTION_DISPLAY_SEPARATE) {
             BeginFloatingWindows("Boss Soul Tracker");
             DrawItemsInRows(bossSoulItems);
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.OcarinaButtons"), SECTION_DISPLAY_HIDDEN) ==
-            SECTION_DISPLAY_SEPARATE) {
+        if (trackerSettings.displayOcarinaButtons == SECTION_DISPLAY_SEPARATE) {
             BeginFloatingWindows("Ocarina Button Tracker");
             DrawItemsInRows(ocarinaButtonItems);
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.OverworldKeys"), SECTION_DISPLAY_HIDDEN) ==
-            SECTION_DISPLAY_SEPARATE) {
+        if (trackerSettings.displayOverworldKeys == SECTION_DISPLAY_SEPARATE) {
             BeginFloatingWindows("Overworld Key Tracker");
             DrawItemsInRows(overworldKeyItems);
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.FishingPole"), SECTION_DISPLAY_EXTENDED_HIDDEN) ==
-            SECTION_DISPLAY_EXTENDED_SEPARATE) {
+        if (trackerSettings.displayFishingPole == SECTION_DISPLAY_EXTENDED_SEPARATE) {
             BeginFloatingWindows("Fishing Pole Tracker");
             DrawItemsInRows(fishingPoleItems);
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Notes"), SECTION_DISPLAY_HIDDEN) ==
-                SECTION_DISPLAY_SEPARATE &&
-            (CVarGetInteger(CVAR_TRACKER_ITEM("WindowType"), TRACKER_WINDOW_FLOATING) == TRACKER_WINDOW_WINDOW ||
-             (CVarGetInteger(CVAR_TRACKER_ITEM("WindowType"), TRACKER_WINDOW_FLOATING) == TRACKER_WINDOW_FLOATING &&
-              CVarGetInteger(CVAR_TRACKER_ITEM("DisplayType.Main"), TRACKER_DISPLAY_ALWAYS) !=
-                  TRACKER_DISPLAY_COMBO_BUTTON))) {
+        if (trackerSettings.displayNotes == SECTION_DISPLAY_SEPARATE &&
+            (trackerSettings.windowType == TRACKER_WINDOW_WINDOW ||
+             (trackerSettings.windowType == TRACKER_WINDOW_FLOATING &&
+              trackerSettings.displayMain != TRACKER_DISPLAY_COMBO_BUTTON))) {
             ImGui::SetNextWindowSize(ImVec2(400, 300), ImGuiCond_FirstUseEver);
             BeginFloatingWindows("Personal Notes", ImGuiWindowFlags_NoFocusOnAppearing);
             DrawNotes(true);
             EndFloatingWindows();
         }
 
-        if (CVarGetInteger("gTrackers.ItemTracker.TotalChecks.DisplayType", SECTION_DISPLAY_MINIMAL_HIDDEN) ==
-            SECTION_DISPLAY_MINIMAL_SEPARATE) {
+        if (trackerSettings.displayTotalChecks == SECTION_DISPLAY_MINIMAL_SEPARATE) {
             ImGui::SetNextWindowSize(ImVec2(450, 300), ImGuiCond_FirstUseEver);
             BeginFloatingWindows("Total Checks");
             DrawTotalChecks();
@@ -1826,12 +1913,18 @@ void ItemTrackerSettingsWindow::DrawElement() {
             }
         }
         ImGui::Separator();
-        CVarSliderInt("Icon size : %dpx", CVAR_TRACKER_ITEM("IconSize"),
-                      IntSliderOptions().Min(25).Max(128).DefaultValue(36).Color(THEME_COLOR));
-        CVarSliderInt("Icon margins : %dpx", CVAR_TRACKER_ITEM("IconSpacing"),
-                      IntSliderOptions().Min(-5).Max(50).DefaultValue(12).Color(THEME_COLOR));
-        CVarSliderInt("Text size : %dpx", CVAR_TRACKER_ITEM("TextSize"),
-                      IntSliderOptions().Min(1).Max(30).DefaultValue(13).Color(THEME_COLOR));
+        if (CVarSliderInt("Icon size : %dpx", CVAR_TRACKER_ITEM("IconSize"),
+                          IntSliderOptions().Min(25).Max(128).DefaultValue(36).Color(THEME_COLOR))) {
+            shouldUpdateVectors = true;
+        }
+        if (CVarSliderInt("Icon margins : %dpx", CVAR_TRACKER_ITEM("IconSpacing"),
+                          IntSliderOptions().Min(-5).Max(50).DefaultValue(12).Color(THEME_COLOR))) {
+            shouldUpdateVectors = true;
+        }
+        if (CVarSliderInt("Text size : %dpx", CVAR_TRACKER_ITEM("TextSize"),
+                          IntSliderOptions().Min(1).Max(30).DefaultValue(13).Color(THEME_COLOR))) {
+            shouldUpdateVectors = true;
+        }
 
         ImGui::NewLine();
         SohGui::mSohMenu->MenuDrawItem(ammoTracking, 250, THEME_COLOR);
@@ -1947,13 +2040,18 @@ void ItemTrackerWindow::InitElement() {
     SaveManager::Instance->AddLoadFunction("itemTrackerData", 1, ItemTrackerLoadFile);
 
     GameInteractor::Instance->RegisterGameHook<GameInteractor::OnGameFrameUpdate>(ItemTrackerOnFrame);
+    // Count labels depend on the seed's settings, and textures are reloaded when switching asset sets
+    GameInteractor::Instance->RegisterGameHook<GameInteractor::OnLoadGame>(
+        [](int32_t fileNum) { shouldUpdateVectors = true; });
+    GameInteractor::Instance->RegisterGameHook<GameInteractor::OnAssetAltChange>([]() { textureGeneration++; });
 }
 
 void RegisterItemTrackerWidgets() {
     backgroundColor = { .name = "Background Color##gItemTrackerBgColor", .type = WidgetType::WIDGET_CVAR_COLOR_PICKER };
     backgroundColor.CVar(CVAR_TRACKER_ITEM("BgColor"))
         .Options(
-            ColorPickerOptions().Color(THEME_COLOR).DefaultValue({ 0, 0, 0, 0 }).UseAlpha().ShowReset().ShowRandom());
+            ColorPickerOptions().Color(THEME_COLOR).DefaultValue({ 0, 0, 0, 0 }).UseAlpha().ShowReset().ShowRandom())
+        .Callback([](WidgetInfo& info) { shouldUpdateVectors = true; });
     SohGui::mSohMenu->AddSearchWidget({ backgroundColor, "Randomizer", "Item Tracker", "General Settings" });
 
     windowTypeWidget = { .name = "Window Type", .type = WidgetType::WIDGET_CVAR_COMBOBOX };
@@ -1978,7 +2076,8 @@ void RegisterItemTrackerWidgets() {
                      .Color(THEME_COLOR)
                      .ComboMap(itemTrackerCapacityTrackOptions)
                      .Tooltip("Customize what the numbers under each item are tracking."
-                              "\n\nNote: items without capacity upgrades will track ammo even in capacity mode"));
+                              "\n\nNote: items without capacity upgrades will track ammo even in capacity mode"))
+        .Callback([](WidgetInfo& info) { shouldUpdateVectors = true; });
     SohGui::mSohMenu->AddSearchWidget({ ammoTracking, "Randomizer", "Item Tracker", "General Settings" });
 
     keyTracking = { .name = "Key Count Tracking", .type = WidgetType::WIDGET_CVAR_COMBOBOX };
@@ -1989,7 +2088,8 @@ void RegisterItemTrackerWidgets() {
                      .LabelPosition(LabelPositions::Far)
                      .Color(THEME_COLOR)
                      .ComboMap(itemTrackerKeyTrackOptions)
-                     .Tooltip("Customize what numbers are shown for key tracking."));
+                     .Tooltip("Customize what numbers are shown for key tracking."))
+        .Callback([](WidgetInfo& info) { shouldUpdateVectors = true; });
     SohGui::mSohMenu->AddSearchWidget({ keyTracking, "Randomizer", "Item Tracker", "General Settings" });
 
     triforcePieceTracking = { .name = "Triforce Pieces", .type = WidgetType::WIDGET_CVAR_COMBOBOX };
@@ -2048,7 +2148,8 @@ void RegisterItemTrackerWidgets() {
                      .LabelPosition(LabelPositions::Far)
                      .Color(THEME_COLOR)
                      .ComboMap(itemTrackerTriforcePieceTrackOptions)
-                     .Tooltip("Customize what numbers are shown for triforce piece tracking."));
+                     .Tooltip("Customize what numbers are shown for triforce piece tracking."))
+        .Callback([](WidgetInfo& info) { shouldUpdateVectors = true; });
     SohGui::mSohMenu->AddSearchWidget({ triforcePieceCount, "Randomizer", "Item Tracker", "General Settings" });
 
     ocarinaButtonTracking = { .name = "Ocarina Buttons", .type = WidgetType::WIDGET_CVAR_COMBOBOX };
@@ -2116,7 +2217,8 @@ void RegisterItemTrackerWidgets() {
     hookshotIdentWidget.CVar(CVAR_TRACKER_ITEM("HookshotIdentifier"))
         .Options(CheckboxOptions()
                      .Color(THEME_COLOR)
-                     .Tooltip("Shows an 'H' or an 'L' to more easily distinguish between Hookshot and Longshot."));
+                     .Tooltip("Shows an 'H' or an 'L' to more easily distinguish between Hookshot and Longshot."))
+        .Callback([](WidgetInfo& info) { shouldUpdateVectors = true; });
     SohGui::mSohMenu->AddSearchWidget({ hookshotIdentWidget, "Randomizer", "Item Tracker", "General Settings" });
 }
 
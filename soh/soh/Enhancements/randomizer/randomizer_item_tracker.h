@@ -12,12 +12,16 @@ typedef struct ItemTrackerItem {
     std::string name;
     std::string nameFaded;
     uint32_t data;
-    void (*drawFunc)(ItemTrackerItem);
+    void (*drawFunc)(const ItemTrackerItem&);
+    // Texture handles of name and nameFaded, resolved on first draw and dropped when the textures are reloaded
+    mutable ImTextureID texture = 0;
+    mutable ImTextureID textureFaded = 0;
+    mutable uint32_t textureGeneration = 0;
 } ItemTrackerItem;
 
-bool HasSong(ItemTrackerItem);
-bool HasQuestItem(ItemTrackerItem);
-bool HasEquipment(ItemTrackerItem);
+bool HasSong(const ItemTrackerItem&);
+bool HasQuestItem(const ItemTrackerItem&);
+bool HasEquipment(const ItemTrackerItem&);
 
 #define ITEM_TRACKER_ITEM(id, data, drawFunc) \
     { id, #id, #id "_Faded", data, drawFunc }
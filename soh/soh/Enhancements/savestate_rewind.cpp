@@ -0,0 +1,342 @@
+#include "savestate_rewind.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <random>
+#include <spdlog/spdlog.h>
+
+namespace {
+
+constexpr size_t kPageSize = 4096;
+constexpr uint32_t kEndOfRegion = 0xFFFFFFFF;
+// Zero runs shorter than this stay inside a literal, a token costs 4 bytes
+constexpr size_t kMinZeroRun = 4;
+
+template <typename T> void Write(std::vector<uint8_t>& out, T value) {
+    const size_t pos = out.size();
+    out.resize(pos + sizeof(T));
+    memcpy(&out[pos], &value, sizeof(T));
+}
+
+template <typename T> T Read(const uint8_t*& in) {
+    T value;
+    memcpy(&value, in, sizeof(T));
+    in += sizeof(T);
+    return value;
+}
+
+// XOR of live against ref (or live itself when ref is null) as (zero run, literal length, literal bytes) tokens
+void EncodePage(const uint8_t* live, const uint8_t* ref, size_t len, std::vector<uint8_t>& out) {
+    auto x = [&](size_t i) -> uint8_t { return ref != nullptr ? live[i] ^ ref[i] : live[i]; };
+
+    size_t i = 0;
+    while (i < len) {
+        const size_t zeroStart = i;
+        while (i + 8 <= len) {
+            uint64_t a;
+            memcpy(&a, &live[i], sizeof(a));
+            if (ref != nullptr) {
+                uint64_t b;
+                memcpy(&b, &ref[i], sizeof(b));
+                a ^= b;
+            }
+            if (a != 0) {
+                break;
+            }
+            i += 8;
+        }
+        while (i < len && x(i) == 0) {
+            i++;
+        }
+        const size_t zeroRun = i - zeroStart;
+
+        const size_t literalStart = i;
+        size_t literalEnd = i;
+        while (i < len) {
+            if (x(i) != 0) {
+                literalEnd = ++i;
+                continue;
+            }
+            size_t run = 0;
+            while (i + run < len && run < kMinZeroRun && x(i + run) == 0) {
+                run++;
+            }
+            if (run >= kMinZeroRun || i + run == len) {
+                break;
+            }
+            i += run;
+        }
+        i = literalEnd;
+
+        Write<uint16_t>(out, static_cast<uint16_t>(zeroRun));
+        Write<uint16_t>(out, static_cast<uint16_t>(literalEnd - literalStart));
+        for (size_t j = literalStart; j < literalEnd; j++) {
+            out.push_back(x(j));
+        }
+    }
+}
+
+} // namespace
+
+RewindRing::RewindRing(std::vector<size_t> regionSizes, size_t capacity, size_t keyframeInterval)
+    : mRegionSizes(std::move(regionSizes)), mCapacity(std::max<size_t>(capacity, 1)),
+      mKeyframeInterval(std::clamp<size_t>(keyframeInterval, 1, mCapacity)) {
+    for (size_t size : mRegionSizes) {
+        mReference.emplace_back(size);
+    }
+}
+
+void RewindRing::Encode(const std::vector<RewindRegion>& live, bool keyframe, std::vector<uint8_t>& out) {
+    for (size_t r = 0; r < live.size(); r++) {
+        uint8_t* ref = mReference[r].data();
+
+        for (size_t offset = 0; offset < live[r].size; offset += kPageSize) {
+            const size_t len = std::min(kPageSize, live[r].size - offset);
+            const uint8_t* page = &live[r].data[offset];
+
+            if (keyframe) {
+                // Keyframes hold every page in order, so no page index is written
+                EncodePage(page, nullptr, len, out);
+            } else if (memcmp(page, &ref[offset], len) != 0) {
+                Write<uint32_t>(out, static_cast<uint32_t>(offset / kPageSize));
+                EncodePage(page, &ref[offset], len, out);
+                memcpy(&ref[offset], page, len);
+            }
+        }
+        if (keyframe) {
+            memcpy(ref, live[r].data, live[r].size);
+        }
+        Write<uint32_t>(out, kEndOfRegion);
+    }
+}
+
+void RewindRing::Capture(const std::vector<RewindRegion>& live) {
+    assert(live.size() == mRegionSizes.size());
+
+    const bool keyframe = mSnapshots.empty() || mSinceKeyframe + 1 >= mKeyframeInterval;
+    mSinceKeyframe = keyframe ? 0 : mSinceKeyframe + 1;
+
+    Snapshot snapshot = { keyframe, {} };
+    Encode(live, keyframe, snapshot.data);
+    snapshot.data.shrink_to_fit();
+
+    mMemoryUsage += snapshot.data.size();
+    mSnapshots.push_back(std::move(snapshot));
+
+    // Drop the oldest keyframe together with the deltas that depend on it
+    while (mSnapshots.size() > mCapacity) {
+        do {
+            mMemoryUsage -= mSnapshots.front().data.size();
+            mSnapshots.pop_front();
+        } while (!mSnapshots.empty() && !mSnapshots.front().keyframe);
+    }
+}
+
+void RewindRing::Apply(const Snapshot& snapshot, const std::vector<RewindRegion>& live) const {
+    const uint8_t* in = snapshot.data.data();
+
+    for (size_t r = 0; r < live.size(); r++) {
+        if (snapshot.keyframe) {
+            memset(live[r].data, 0, live[r].size);
+        }
+
+        size_t pageIndex = 0;
+        while (true) {
+            size_t offset;
+            if (snapshot.keyframe) {
+                offset = pageIndex++ * kPageSize;
+                if (offset >= live[r].size) {
+                    in += sizeof(uint32_t);
+                    break;
+                }
+            } else {
+                const uint32_t index = Read<uint32_t>(in);
+                if (index == kEndOfRegion) {
+                    break;
+                }
+                offset = index * kPageSize;
+            }
+
+            const size_t len = std::min(kPageSize, live[r].size - offset);
+            uint8_t* page = &live[r].data[offset];
+            for (size_t pos = 0; pos < len;) {
+                pos += Read<uint16_t>(in);
+                const uint16_t literal = Read<uint16_t>(in);
+                for (uint16_t i = 0; i < literal; i++) {
+                    page[pos++] ^= *in++;
+                }
+            }
+        }
+    }
+}
+
+bool RewindRing::Restore(size_t stepsBack, const std::vector<RewindRegion>& live) {
+    assert(live.size() == mRegionSizes.size());
+    if (mSnapshots.empty()) {
+        return false;
+    }
+
+    const size_t target = mSnapshots.size() - 1 - std::min(stepsBack, mSnapshots.size() - 1);
+    size_t keyframe = target;
+    while (!mSnapshots[keyframe].keyframe) {
+        keyframe--;
+    }
+    for (size_t i = keyframe; i <= target; i++) {
+        Apply(mSnapshots[i], live);
+    }
+
+    while (mSnapshots.size() > target + 1) {
+        mMemoryUsage -= mSnapshots.back().data.size();
+        mSnapshots.pop_back();
+    }
+    mSinceKeyframe = target - keyframe;
+    for (size_t r = 0; r < live.size(); r++) {
+        memcpy(mReference[r].data(), live[r].data, live[r].size);
+    }
+    return true;
+}
+
+void RewindRing::Clear() {
+    mSnapshots.clear();
+    mMemoryUsage = 0;
+    mSinceKeyframe = 0;
+}
+
+size_t RewindRing::GetCount() const {
+    return mSnapshots.size();
+}
+
+size_t RewindRing::GetMemoryUsage() const {
+    size_t usage = mMemoryUsage;
+    for (const auto& reference : mReference) {
+        usage += reference.size();
+    }
+    return usage;
+}
+
+namespace {
+
+// Frames that change a few bytes, a few pages, nothing at all, or everything, so deltas, zero runs, literals and
+// unchanged pages are all encoded
+std::vector<std::vector<std::vector<uint8_t>>> MakeCheckFrames(const std::vector<size_t>& sizes, size_t count) {
+    std::mt19937 rng(0x5EED);
+    std::vector<std::vector<std::vector<uint8_t>>> frames;
+    std::vector<std::vector<uint8_t>> current;
+    for (size_t size : sizes) {
+        current.emplace_back(size);
+    }
+
+    for (size_t f = 0; f < count; f++) {
+        for (auto& region : current) {
+            if (region.empty()) {
+                continue;
+            }
+            switch (f % 4) {
+                case 0:
+                    for (int i = 0; i < 16; i++) {
+                        region[rng() % region.size()] = static_cast<uint8_t>(rng());
+                    }
+                    break;
+                case 1: {
+                    const size_t start = rng() % region.size();
+                    const size_t end = std::min(region.size(), start + kPageSize + rng() % kPageSize);
+                    std::fill(region.begin() + start, region.begin() + end, static_cast<uint8_t>(rng()));
+                    break;
+                }
+                case 2:
+                    break;
+                default:
+                    for (uint8_t& byte : region) {
+                        byte = static_cast<uint8_t>(rng());
+                    }
+                    break;
+            }
+        }
+        frames.push_back(current);
+    }
+    return frames;
+}
+
+} // namespace
+
+bool RewindRing_Check(std::string& report) {
+    // Two pages and a bit, to cover a partial last page, and one region smaller than a page
+    const std::vector<size_t> sizes = { 2 * kPageSize + 123, 100 };
+    const auto frames = MakeCheckFrames(sizes, 25);
+
+    std::vector<std::vector<uint8_t>> liveData;
+    std::vector<RewindRegion> live;
+    for (size_t size : sizes) {
+        liveData.emplace_back(size);
+    }
+    for (auto& region : liveData) {
+        live.push_back({ region.data(), region.size() });
+    }
+
+    auto captureUpTo = [&](RewindRing& ring, size_t end) {
+        for (size_t f = 0; f < end; f++) {
+            for (size_t r = 0; r < sizes.size(); r++) {
+                memcpy(live[r].data, frames[f][r].data(), sizes[r]);
+            }
+            ring.Capture(live);
+        }
+    };
+    auto matches = [&](size_t frame) {
+        for (size_t r = 0; r < sizes.size(); r++) {
+            if (memcmp(live[r].data, frames[frame][r].data(), sizes[r]) != 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    RewindRing empty(sizes, 4, 2);
+    if (empty.Restore(0, live)) {
+        report = "Restoring an empty rewind ring succeeded";
+        return false;
+    }
+
+    // Every capture a keyframe, a keyframe interval that doesn't divide the capacity, and one equal to it
+    const std::pair<size_t, size_t> configs[] = { { 8, 1 }, { 10, 4 }, { 6, 6 } };
+    size_t restores = 0;
+    for (const auto& [capacity, interval] : configs) {
+        RewindRing full(sizes, capacity, interval);
+        captureUpTo(full, frames.size());
+        const size_t count = full.GetCount();
+        if (count > capacity || count + interval <= capacity) {
+            report = fmt::format("Ring of {} with keyframes every {} kept {} captures after wrapping", capacity,
+                                 interval, count);
+            return false;
+        }
+
+        // Restore truncates the ring, so every step gets a freshly filled one
+        for (size_t steps = 0; steps <= count; steps++) {
+            RewindRing ring(sizes, capacity, interval);
+            captureUpTo(ring, frames.size());
+            const size_t expected = frames.size() - 1 - std::min(steps, count - 1);
+            if (!ring.Restore(steps, live) || !matches(expected)) {
+                report = fmt::format("Ring of {} with keyframes every {}: restoring {} steps back doesn't give "
+                                     "frame {}",
+                                     capacity, interval, steps, expected);
+                return false;
+            }
+
+            // Capturing after a restore has to continue from the restored state
+            for (size_t r = 0; r < sizes.size(); r++) {
+                memcpy(live[r].data, frames.back()[r].data(), sizes[r]);
+            }
+            ring.Capture(live);
+            if (!ring.Restore(1, live) || !matches(expected)) {
+                report = fmt::format("Ring of {} with keyframes every {}: capture after restoring {} steps back broke "
+                                     "frame {}",
+                                     capacity, interval, steps, expected);
+                return false;
+            }
+            restores++;
+        }
+    }
+
+    report = fmt::format("All {} rewind ring restores match their captures", restores);
+    return true;
+}
@@ -0,0 +1,62 @@
+#ifndef SAVESTATE_REWIND_H
+#define SAVESTATE_REWIND_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+typedef struct RewindRegion {
+    uint8_t* data;
+    size_t size;
+} RewindRegion;
+
+/*
+ * A ring of snapshots of a fixed set of memory regions. Every snapshot is stored as the page-wise XOR of the
+ * regions against the previous snapshot, run-length encoded so unchanged bytes cost nothing. Every keyframeInterval
+ * snapshots a keyframe (XOR against zero) is stored instead, so restoring a snapshot only replays the deltas since its
+ * keyframe, and the oldest keyframe together with its deltas can be dropped once the ring is full.
+ */
+class RewindRing {
+  public:
+    RewindRing(std::vector<size_t> regionSizes, size_t capacity, size_t keyframeInterval);
+
+    // Appends a snapshot of live, which must match the region sizes given at construction
+    void Capture(const std::vector<RewindRegion>& live);
+
+    // Writes the snapshot taken stepsBack captures before the newest one into live and forgets every newer snapshot,
+    // so the next capture continues from the restored state. Returns false if the ring is empty.
+    bool Restore(size_t stepsBack, const std::vector<RewindRegion>& live);
+
+    void Clear();
+
+    size_t GetCount() const;
+    size_t GetMemoryUsage() const;
+
+  private:
+    struct Snapshot {
+        bool keyframe;
+        std::vector<uint8_t> data;
+    };
+
+    void Encode(const std::vector<RewindRegion>& live, bool keyframe, std::vector<uint8_t>& out);
+    void Apply(const Snapshot& snapshot, const std::vector<RewindRegion>& live) const;
+
+    std::vector<size_t> mRegionSizes;
+    size_t mCapacity;
+    size_t mKeyframeInterval;
+    size_t mSinceKeyframe = 0;
+
+    // The newest snapshot in full, what the next delta is taken against
+    std::vector<std::vector<uint8_t>> mReference;
+    std::deque<Snapshot> mSnapshots;
+    size_t mMemoryUsage = 0;
+};
+
+// Captures synthetic frames into rings of several capacities and keyframe intervals, past the point where they wrap,
+// and checks that restoring every step gives back the captured bytes. Meant for the debug console. Writes a one line
+// result to report.
+bool RewindRing_Check(std::string& report);
+
+#endif
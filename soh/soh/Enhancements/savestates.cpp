@@ -2,12 +2,16 @@
 
 #include <soh/GameVersions.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdio> // std::sprintf
 
 #include <spdlog/spdlog.h>
 
 #include <soh/OTRGlobals.h>
 #include <soh/OTRAudio.h>
+#include <soh/cvar_prefixes.h>
+#include <soh/ObjectExtension/ActorListIndex.h>
 
 #include "z64.h"
 #include "z64save.h"
@@ -36,10 +40,12 @@ typedef struct {
 
 #include "savestates_extern.inc"
 
-typedef struct SaveStateInfo {
+typedef struct SaveStateHeaps {
     unsigned char sysHeapCopy[SYSTEM_HEAP_SIZE];
     unsigned char audioHeapCopy[AUDIO_HEAP_SIZE];
+} SaveStateHeaps;
 
+typedef struct SaveStateInfo {
     SaveContext saveContextCopy;
     GameInfo gameInfoCopy;
     LightsBuffer lightBufferCopy;
@@ -337,10 +343,18 @@ class SaveState {
   private:
     unsigned int slot;
     std::shared_ptr<SaveStateMgr> saveStateMgr;
+    // Allocated by the first SaveHeaps, the rewind scratch state never has any
+    std::shared_ptr<SaveStateHeaps> heaps;
     std::shared_ptr<SaveStateInfo> info;
+    // Sized once for every registered extension, see SaveStateMgr::GetExtensionArenaSize
+    std::vector<uint8_t> extensionArena;
 
     void Save(void);
     void Load(void);
+    void SaveHeaps(void);
+    void LoadHeaps(void);
+    void SaveStatics(void);
+    void LoadStatics(void);
     void BackupSeqScriptState(void);
     void LoadSeqScriptState(void);
     void BackupCameraData(void);
@@ -353,10 +367,19 @@ class SaveState {
     void SaveMiscCodeData(void);
     void LoadMiscCodeData(void);
 
+    void SaveExtensions(void);
+    void LoadExtensions(void);
+
     SaveStateInfo* GetSaveStateInfo(void);
 };
 
-SaveStateMgr::SaveStateMgr() {
+// Rewind keeps about 10 seconds of captures at a stride of 1, with a keyframe every 2 seconds
+#define REWIND_CAPACITY 600
+#define REWIND_KEYFRAME_INTERVAL 120
+#define REWIND_FRAME_BUDGET std::chrono::microseconds(1000)
+#define REWIND_MAX_STRIDE 8
+
+SaveStateMgr::SaveStateMgr() : rewindStride(1), rewindFramesUntilCapture(0) {
     this->SetCurrentSlot(0);
 }
 SaveStateMgr::~SaveStateMgr() {
@@ -366,8 +389,196 @@ SaveStateMgr::~SaveStateMgr() {
 SaveState::SaveState(std::shared_ptr<SaveStateMgr> mgr, unsigned int slot)
     : saveStateMgr(mgr), slot(slot), info(nullptr) {
     this->info = std::make_shared<SaveStateInfo>();
+    this->extensionArena.resize(SaveStateMgr::GetExtensionArenaSize());
+}
+
+// Written in place of an extension's size when its save overflowed its capacity
+#define EXTENSION_OVERFLOWED UINT32_MAX
+
+// The actor lists in order, and sorted by actor for slot lookups. Rebuilt before extensions are saved or loaded.
+static std::vector<Actor*> sSlotActors;
+static std::vector<std::pair<const Actor*, int16_t>> sActorSlots;
+
+static void BuildActorSlots(void) {
+    sSlotActors.clear();
+    sActorSlots.clear();
+    if (gPlayState == nullptr) {
+        return;
+    }
+
+    for (int32_t category = 0; category < ACTORCAT_MAX; category++) {
+        for (Actor* actor = gPlayState->actorCtx.actorLists[category].head; actor != nullptr; actor = actor->next) {
+            sActorSlots.emplace_back(actor, static_cast<int16_t>(sSlotActors.size()));
+            sSlotActors.push_back(actor);
+        }
+    }
+    std::sort(sActorSlots.begin(), sActorSlots.end());
 }
 
+int16_t SaveState_GetActorSlot(const Actor* actor) {
+    auto it = std::lower_bound(sActorSlots.begin(), sActorSlots.end(), std::make_pair(actor, int16_t(-1)));
+    if (actor == nullptr || it == sActorSlots.end() || it->first != actor) {
+        return -1;
+    }
+    return it->second;
+}
+
+Actor* SaveState_GetSlotActor(int16_t slot) {
+    if (slot < 0 || static_cast<size_t>(slot) >= sSlotActors.size()) {
+        return nullptr;
+    }
+    return sSlotActors[slot];
+}
+
+bool SaveState_CheckRoundTrip(const std::string& name, std::string& report) {
+    const auto& extensions = SaveStateMgr::GetExtensions();
+    const auto extension = std::find_if(extensions.begin(), extensions.end(),
+                                        [&](const SaveStateExtension& candidate) { return name == candidate.name; });
+    if (extension == extensions.end()) {
+        report = fmt::format("No save state extension named {}", name);
+        return false;
+    }
+
+    if (extension->clear == nullptr) {
+        report = fmt::format("{} state can't be cleared, so a load can't be checked", name);
+        return false;
+    }
+
+    BuildActorSlots();
+    std::vector<uint8_t> saved(extension->capacity);
+    SaveStateArena saveArena(saved.data(), saved.size());
+    extension->save(saveArena);
+    if (saveArena.Overflowed()) {
+        report = fmt::format("{} state is larger than its {} bytes", name, extension->capacity);
+        return false;
+    }
+    const size_t size = saveArena.GetSize();
+
+    // Cleared first, so a load that doesn't restore anything can't pass by leaving the saved state in place
+    extension->clear();
+    std::vector<uint8_t> resaved(extension->capacity);
+    SaveStateArena clearedArena(resaved.data(), resaved.size());
+    extension->save(clearedArena);
+    const bool clearChangedState =
+        clearedArena.GetSize() != size || !std::equal(saved.begin(), saved.begin() + size, resaved.begin());
+
+    SaveStateArena loadArena(saved.data(), size);
+    extension->load(loadArena);
+
+    SaveStateArena resaveArena(resaved.data(), resaved.size());
+    extension->save(resaveArena);
+
+    if (resaveArena.GetSize() != size) {
+        report = fmt::format("{} state was {} bytes, {} after a load", name, size, resaveArena.GetSize());
+        return false;
+    }
+    const auto mismatch = std::mismatch(saved.begin(), saved.begin() + size, resaved.begin());
+    if (mismatch.first != saved.begin() + size) {
+        report = fmt::format("{} state differs after a load, first at byte {} of {}", name,
+                             mismatch.first - saved.begin(), size);
+        return false;
+    }
+    if (!clearChangedState) {
+        report = fmt::format("{} state is already empty, a load can't be told apart from no load ({} bytes)", name,
+                             size);
+        return true;
+    }
+    report = fmt::format("{} state is restored by a load ({} bytes)", name, size);
+    return true;
+}
+
+std::vector<SaveStateExtension>& SaveStateMgr::GetExtensions(void) {
+    static std::vector<SaveStateExtension> extensions;
+    return extensions;
+}
+
+size_t SaveStateMgr::GetExtensionArenaSize(void) {
+    size_t size = 0;
+    for (const auto& extension : GetExtensions()) {
+        size += sizeof(uint32_t) + extension.capacity;
+    }
+    return size;
+}
+
+// Every extension gets a size header followed by its capacity in the arena, in registration order
+void SaveState::SaveExtensions(void) {
+    BuildActorSlots();
+
+    uint8_t* data = this->extensionArena.data();
+    for (const auto& extension : SaveStateMgr::GetExtensions()) {
+        SaveStateArena arena(data + sizeof(uint32_t), extension.capacity);
+        extension.save(arena);
+
+        uint32_t size = static_cast<uint32_t>(arena.GetSize());
+        if (arena.Overflowed()) {
+            SPDLOG_ERROR("[SaveState] {} state is larger than its {} bytes", extension.name, extension.capacity);
+            size = EXTENSION_OVERFLOWED;
+        }
+        memcpy(data, &size, sizeof(size));
+        data += sizeof(uint32_t) + extension.capacity;
+    }
+}
+
+void SaveState::LoadExtensions(void) {
+    BuildActorSlots();
+
+    uint8_t* data = this->extensionArena.data();
+    for (const auto& extension : SaveStateMgr::GetExtensions()) {
+        uint32_t size;
+        memcpy(&size, data, sizeof(size));
+        if (size != EXTENSION_OVERFLOWED) {
+            SaveStateArena arena(data + sizeof(uint32_t), size);
+            extension.load(arena);
+        }
+        data += sizeof(uint32_t) + extension.capacity;
+    }
+}
+
+// The actor list index is attached outside of the heap, so actors restored by a load would otherwise lose it
+static void ActorListIndex_SaveState(SaveStateArena& arena) {
+    for (int16_t slot = 0; static_cast<size_t>(slot) < sSlotActors.size(); slot++) {
+        int16_t index = GetActorListIndex(sSlotActors[slot]);
+        if (index != -1) {
+            arena.Write(slot);
+            arena.Write(index);
+        }
+    }
+    arena.Write<int16_t>(-1);
+}
+
+static void ActorListIndex_LoadState(SaveStateArena& arena) {
+    for (Actor* actor : sSlotActors) {
+        SetActorListIndex(actor, -1);
+    }
+
+    int16_t slot;
+    int16_t index;
+    while (arena.Read(slot) && slot != -1 && arena.Read(index)) {
+        SetActorListIndex(SaveState_GetSlotActor(slot), index);
+    }
+}
+
+// Only setup actors have an index. A room has at most 255 of them, and two rooms are loaded during a room transition.
+static RegisterSaveStateExtension actorListIndexExtension({ "ActorListIndex", (2 * 255 * 2 + 1) * sizeof(int16_t),
+                                                            ActorListIndex_SaveState, ActorListIndex_LoadState,
+                                                            nullptr });
+
+// The free list heads live in the arena structs outside of the system heap, but the blocks they link are restored with
+// it, so the heads have to be restored along with them. The Zelda arena is allocated from the system heap.
+static void ArenaFreeLists_SaveState(SaveStateArena& arena) {
+    arena.Write(gSystemArena.freeLists);
+    arena.Write(sZeldaArena.freeLists);
+}
+
+static void ArenaFreeLists_LoadState(SaveStateArena& arena) {
+    arena.Read(gSystemArena.freeLists);
+    arena.Read(sZeldaArena.freeLists);
+}
+
+static RegisterSaveStateExtension arenaFreeListsExtension({ "ArenaFreeLists", 2 * sizeof(Arena::freeLists),
+                                                            ArenaFreeLists_SaveState, ArenaFreeLists_LoadState,
+                                                            nullptr });
+
 void SaveState::BackupSeqScriptState(void) {
     for (unsigned int i = 0; i < 4; i++) {
         info->seqScriptStateCopy[i].value = gAudioContext.seqPlayers[i].scriptState.value;
@@ -829,6 +1040,63 @@ unsigned int SaveStateMgr::GetCurrentSlot(void) {
     return this->currentSlot;
 }
 
+std::vector<RewindRegion> SaveStateMgr::GetRewindRegions(uint8_t* audioHeap) {
+    // The system heap is tracked in place, everything else goes through the statics and extensions of the scratch state
+    return {
+        { gSystemHeap, SYSTEM_HEAP_SIZE },
+        { audioHeap, AUDIO_HEAP_SIZE },
+        { reinterpret_cast<uint8_t*>(this->rewindScratch->info.get()), sizeof(SaveStateInfo) },
+        { this->rewindScratch->extensionArena.data(), this->rewindScratch->extensionArena.size() },
+    };
+}
+
+void SaveStateMgr::CaptureRewindFrame(void) {
+    if (this->rewindRing == nullptr) {
+        // The scratch state only ever holds statics, SaveHeaps is never called on it
+        this->rewindScratch = std::make_shared<SaveState>(OTRGlobals::Instance->gSaveStateMgr, 0);
+        this->rewindAudioHeap.resize(AUDIO_HEAP_SIZE);
+        std::vector<size_t> sizes;
+        for (const auto& region : GetRewindRegions(this->rewindAudioHeap.data())) {
+            sizes.push_back(region.size);
+        }
+        this->rewindRing = std::make_unique<RewindRing>(sizes, REWIND_CAPACITY, REWIND_KEYFRAME_INTERVAL);
+    }
+
+    if (this->rewindFramesUntilCapture > 0) {
+        this->rewindFramesUntilCapture--;
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+        // Only copy what the audio thread touches under its lock, encoding the capture can take much longer
+        std::unique_lock<std::mutex> Lock(audio.mutex);
+        this->rewindScratch->SaveStatics();
+        memcpy(this->rewindAudioHeap.data(), gAudioHeap, AUDIO_HEAP_SIZE);
+    }
+    // Extensions only hold game thread state
+    this->rewindScratch->SaveExtensions();
+    this->rewindRing->Capture(GetRewindRegions(this->rewindAudioHeap.data()));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // Spread captures out while they overrun the budget, and tighten back up once they are well under it
+    if (elapsed > REWIND_FRAME_BUDGET && this->rewindStride < REWIND_MAX_STRIDE) {
+        this->rewindStride *= 2;
+    } else if (elapsed < REWIND_FRAME_BUDGET / 2 && this->rewindStride > 1) {
+        this->rewindStride--;
+    }
+    this->rewindFramesUntilCapture = this->rewindStride - 1;
+}
+
+void SaveStateMgr::ResetRewind(void) {
+    this->rewindRing.reset();
+    this->rewindScratch.reset();
+    this->rewindAudioHeap.clear();
+    this->rewindAudioHeap.shrink_to_fit();
+    this->rewindStride = 1;
+    this->rewindFramesUntilCapture = 0;
+}
+
 void SaveStateMgr::ProcessSaveStateRequests(void) {
     while (!this->requests.empty()) {
         const auto& request = this->requests.front();
@@ -852,12 +1120,36 @@ void SaveStateMgr::ProcessSaveStateRequests(void) {
                     SPDLOG_ERROR("Invalid SaveState slot: {}", request.slot);
                 }
                 break;
+            case RequestType::REWIND:
+                if (this->rewindRing != nullptr && this->rewindRing->GetCount() > 0) {
+                    // Restore stops at the oldest capture, the newest one is the current state
+                    const size_t steps = std::min<size_t>(request.slot, this->rewindRing->GetCount() - 1);
+                    std::unique_lock<std::mutex> Lock(audio.mutex);
+                    this->rewindRing->Restore(steps, GetRewindRegions(gAudioHeap));
+                    this->rewindScratch->LoadStatics();
+                    Lock.unlock();
+                    this->rewindScratch->LoadExtensions();
+                    // The restored state is already the newest capture, don't take it again this frame
+                    this->rewindFramesUntilCapture = this->rewindStride;
+                    Ship::Context::GetInstance()->GetWindow()->GetGui()->GetGameOverlay()->TextDrawNotification(
+                        1.0f, true, "rewound %zu steps", steps);
+                } else {
+                    SPDLOG_ERROR("Nothing to rewind");
+                }
+                break;
                 [[unlikely]] default
                     : SPDLOG_ERROR("Invalid SaveState request type: Unknown ({})", static_cast<int>(request.type));
                 break;
         }
         this->requests.pop();
     }
+
+    if (gPlayState != nullptr && CVarGetInteger(CVAR_CHEAT("SaveStatesEnabled"), 0) &&
+        CVarGetInteger(CVAR_CHEAT("RewindEnabled"), 0)) {
+        CaptureRewindFrame();
+    } else if (this->rewindRing != nullptr) {
+        ResetRewind();
+    }
 }
 
 SaveStateReturn SaveStateMgr::AddRequest(const SaveStateRequest request) {
@@ -882,6 +1174,16 @@ SaveStateReturn SaveStateMgr::AddRequest(const SaveStateRequest request) {
                     1.0f, true, "state slot %u empty", request.slot);
                 return SaveStateReturn::FAIL_INVALID_SLOT;
             }
+        case RequestType::REWIND:
+            if (rewindRing != nullptr && rewindRing->GetCount() > 0) {
+                requests.push(request);
+                return SaveStateReturn::SUCCESS;
+            } else {
+                SPDLOG_ERROR("No rewind history");
+                Ship::Context::GetInstance()->GetWindow()->GetGui()->GetGameOverlay()->TextDrawNotification(
+                    1.0f, true, "no rewind history");
+                return SaveStateReturn::FAIL_STATE_EMPTY;
+            }
             [[unlikely]] default
                 : SPDLOG_ERROR("Invalid SaveState request type: Unknown ({})", static_cast<int>(request.type));
             return SaveStateReturn::FAIL_BAD_REQUEST;
@@ -890,9 +1192,35 @@ SaveStateReturn SaveStateMgr::AddRequest(const SaveStateRequest request) {
 
 void SaveState::Save(void) {
     std::unique_lock<std::mutex> Lock(audio.mutex);
-    memcpy(&info->sysHeapCopy, gSystemHeap, SYSTEM_HEAP_SIZE /* sizeof(gSystemHeap) */);
-    memcpy(&info->audioHeapCopy, gAudioHeap, AUDIO_HEAP_SIZE /* sizeof(gAudioContext) */);
+    SaveHeaps();
+    SaveStatics();
+    Lock.unlock();
+    SaveExtensions();
+}
 
+void SaveState::Load(void) {
+    std::unique_lock<std::mutex> Lock(audio.mutex);
+    LoadHeaps();
+    LoadStatics();
+    Lock.unlock();
+    LoadExtensions();
+}
+
+void SaveState::SaveHeaps(void) {
+    if (heaps == nullptr) {
+        heaps = std::make_shared<SaveStateHeaps>();
+    }
+    memcpy(&heaps->sysHeapCopy, gSystemHeap, SYSTEM_HEAP_SIZE /* sizeof(gSystemHeap) */);
+    memcpy(&heaps->audioHeapCopy, gAudioHeap, AUDIO_HEAP_SIZE /* sizeof(gAudioContext) */);
+}
+
+void SaveState::LoadHeaps(void) {
+    memcpy(gSystemHeap, &heaps->sysHeapCopy, SYSTEM_HEAP_SIZE);
+    memcpy(gAudioHeap, &heaps->audioHeapCopy, AUDIO_HEAP_SIZE);
+}
+
+// Everything in SaveStateInfo. Extensions are saved separately, outside of the audio lock.
+void SaveState::SaveStatics(void) {
     memcpy(&info->audioContextCopy, &gAudioContext, sizeof(AudioContext));
     memcpy(&info->gActiveSeqsCopy, gActiveSeqs, sizeof(info->gActiveSeqsCopy));
     BackupSeqScriptState();
@@ -923,11 +1251,7 @@ void SaveState::Save(void) {
     SaveMiscCodeData();
 }
 
-void SaveState::Load(void) {
-    std::unique_lock<std::mutex> Lock(audio.mutex);
-    memcpy(gSystemHeap, &info->sysHeapCopy, SYSTEM_HEAP_SIZE);
-    memcpy(gAudioHeap, &info->audioHeapCopy, AUDIO_HEAP_SIZE);
-
+void SaveState::LoadStatics(void) {
     memcpy(&gAudioContext, &info->audioContextCopy, sizeof(AudioContext));
     memcpy(gActiveSeqs, &info->gActiveSeqsCopy, sizeof(info->gActiveSeqsCopy));
     LoadSeqScriptState();
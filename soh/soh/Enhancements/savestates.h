@@ -2,11 +2,17 @@
 #define SAVE_STATES_H
 
 #include <cstdint>
+#include <cstring>
 #include <queue>
+#include <string>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 #include <memory>
 #include <mutex>
 
+#include "savestate_rewind.h"
+
 enum class SaveStateReturn {
     SUCCESS,
     FAIL_INVALID_SLOT,
@@ -25,13 +31,87 @@ typedef struct SaveStateHeader {
 enum class RequestType {
     SAVE,
     LOAD,
+    REWIND,
 };
 
 typedef struct SaveStateRequest {
+    // For REWIND, the number of captures to step back
     unsigned int slot;
     RequestType type;
 } SaveStateRequest;
 
+struct Actor;
+
+/*
+ * The part of a state's extension arena that belongs to one extension. Saving writes trivially copyable values into
+ * it and loading reads them back in the same order. Writes past the capacity of the extension fail and mark the
+ * arena as overflowed, the extension is then left untouched when the state is loaded.
+ */
+class SaveStateArena {
+  public:
+    SaveStateArena(uint8_t* data, size_t capacity) : mData(data), mCapacity(capacity) {
+    }
+
+    template <typename T> bool Write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Save state extensions can only store POD values");
+        if (mOverflowed || mOffset + sizeof(T) > mCapacity) {
+            mOverflowed = true;
+            return false;
+        }
+        memcpy(mData + mOffset, &value, sizeof(T));
+        mOffset += sizeof(T);
+        return true;
+    }
+
+    template <typename T> bool Read(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Save state extensions can only store POD values");
+        if (mOffset + sizeof(T) > mCapacity) {
+            return false;
+        }
+        memcpy(&value, mData + mOffset, sizeof(T));
+        mOffset += sizeof(T);
+        return true;
+    }
+
+    // Bytes written so far, or read so far when loading
+    size_t GetSize() const {
+        return mOffset;
+    }
+
+    bool Overflowed() const {
+        return mOverflowed;
+    }
+
+  private:
+    uint8_t* mData;
+    size_t mCapacity;
+    size_t mOffset = 0;
+    bool mOverflowed = false;
+};
+
+// State a system keeps outside of the heaps and statics a save state copies. Every state reserves capacity bytes for
+// the extension up front, so saving never allocates. load runs after the heaps and statics have been restored.
+// clear is optional and empties everything load restores, so SaveState_CheckRoundTrip can tell a load that restores
+// the state from one that leaves it as it was.
+typedef struct SaveStateExtension {
+    const char* name;
+    size_t capacity;
+    void (*save)(SaveStateArena& arena);
+    void (*load)(SaveStateArena& arena);
+    void (*clear)(void);
+} SaveStateExtension;
+
+// Actors can't be stored by pointer in an extension since the actor at an address changes as actors are spawned and
+// killed. They are stored as their slot instead, their position in the actor lists, which names the same actor again
+// once a load has restored the heap. Only valid while extensions are being saved or loaded.
+// Returns -1 for nullptr or an actor that isn't in the actor lists.
+int16_t SaveState_GetActorSlot(const Actor* actor);
+// Returns nullptr for -1 or a slot past the end of the actor lists
+Actor* SaveState_GetSlotActor(int16_t slot);
+// Saves the named extension, clears it, loads the saved state back and saves it again, which must give the same bytes.
+// Meant for the debug console: a faulty load is applied to the live state. Writes a one line result to report.
+bool SaveState_CheckRoundTrip(const std::string& name, std::string& report);
+
 class SaveState;
 
 class SaveStateMgr {
@@ -43,6 +123,18 @@ class SaveStateMgr {
     std::queue<SaveStateRequest> requests;
     std::mutex mutex;
 
+    // Rewind captures run every rewindStride frames, the stride grows whenever a capture overruns its frame budget
+    std::unique_ptr<RewindRing> rewindRing;
+    std::shared_ptr<SaveState> rewindScratch;
+    // The audio heap as of the last capture, copied under the audio lock so the capture can be encoded outside of it
+    std::vector<uint8_t> rewindAudioHeap;
+    unsigned int rewindStride;
+    unsigned int rewindFramesUntilCapture;
+
+    std::vector<RewindRegion> GetRewindRegions(uint8_t* audioHeap);
+    void CaptureRewindFrame(void);
+    void ResetRewind(void);
+
   public:
     SaveStateReturn AddRequest(const SaveStateRequest request);
     SaveStateMgr();
@@ -55,6 +147,23 @@ class SaveStateMgr {
     SaveStateMgr(const SaveStateMgr& rhs) = delete;
 
     void ProcessSaveStateRequests(void);
+
+    static std::vector<SaveStateExtension>& GetExtensions(void);
+    // Arena size of a state, every extension's capacity and a size header for each
+    static size_t GetExtensionArenaSize(void);
+};
+
+/*
+ * Registers a save state extension, to be used at static init before any state is created
+ *
+ * ```cpp
+ * static RegisterSaveStateExtension fooExtension({ "Foo", sizeof(FooState), Foo_SaveState, Foo_LoadState });
+ * ```
+ */
+struct RegisterSaveStateExtension {
+    RegisterSaveStateExtension(const SaveStateExtension& extension) {
+        SaveStateMgr::GetExtensions().push_back(extension);
+    }
 };
 extern std::shared_ptr<SaveStateMgr> gSaveStateMgr;
 
@@ -5,6 +5,7 @@
 #pragma comment(lib, "Shlwapi.lib")
 #endif
 #include "Extract.h"
+#include "ExtractManifest.h"
 #include "portable-file-dialogs.h"
 #include <ship/utils/binarytools/BitConverter.h>
 #include "variables.h"
@@ -48,6 +49,7 @@
 #include <unordered_map>
 #include <random>
 #include <string>
+#include <spdlog/spdlog.h>
 
 extern "C" uint32_t CRC32C(unsigned char* data, size_t dataSize);
 
@@ -337,13 +339,40 @@ size_t Extractor::GetCurRomSize() const {
     return std::filesystem::file_size(mCurrentRomPath);
 }
 
+// The manifests of previous extractions remember the CRC of the rom they were extracted from
+bool Extractor::GetCachedRomCrc(uint32_t& crc) const {
+    if (mSearchPath.empty()) {
+        return false;
+    }
+
+    const std::string romPath = std::filesystem::absolute(mCurrentRomPath).string();
+    uint64_t romSize;
+    int64_t romWriteTime;
+    if (!ExtractManifest_Stat(romPath, romSize, romWriteTime)) {
+        return false;
+    }
+
+    for (const char* otrFile : { "oot.o2r", "oot-mq.o2r" }) {
+        auto manifest = ExtractManifest::Load(ExtractManifest::GetPath(mSearchPath + "/" + otrFile));
+        if (manifest.has_value() && manifest->MatchesRom(romPath, romSize, romWriteTime)) {
+            crc = manifest->romCrc;
+            return true;
+        }
+    }
+    return false;
+}
+
 bool Extractor::ValidateAndFixRom() {
     // The MQ debug rom sometimes has the header patched to look like a US rom. Change it back
     if (GetRomVerCrc() == OOT_PAL_GC_MQ_DBG) {
         mRomData[0x3E] = 'P';
     }
 
-    const uint32_t actualCrc = CRC32C(mRomData.get(), mCurRomSize);
+    uint32_t actualCrc;
+    if (!GetCachedRomCrc(actualCrc)) {
+        actualCrc = CRC32C(mRomData.get(), mCurRomSize);
+    }
+    mRomCrc = actualCrc;
 
     for (const uint32_t crc : goodCrcs) {
         if (actualCrc == crc) {
@@ -637,7 +666,7 @@ std::string Extractor::Mkdtemp() {
 extern "C" int zapd_main(int argc, char** argv);
 static void MessageboxWorker();
 
-bool Extractor::CallZapd(std::string installPath, std::string exportdir) {
+bool Extractor::CallZapd(std::string installPath, std::string exportdir, bool force) {
     constexpr int argc = 22;
     char xmlPath[1024];
     char confPath[1024];
@@ -649,6 +678,44 @@ bool Extractor::CallZapd(std::string installPath, std::string exportdir) {
     std::string romPath = std::filesystem::absolute(mCurrentRomPath).string();
     installPath = std::filesystem::absolute(installPath).string();
     exportdir = std::filesystem::absolute(exportdir).string();
+    snprintf(portVersion, 18, "%d.%d.%d", gBuildVersionMajor, gBuildVersionMinor, gBuildVersionPatch);
+
+    // Unless forced, skip extracting entirely when the archive was built from the same rom and extraction files by this
+    // port version
+    const std::string archivePath = exportdir + "/" + otrFile;
+    const std::string manifestPath = ExtractManifest::GetPath(archivePath);
+    ExtractManifest manifest;
+    manifest.romPath = romPath;
+    ExtractManifest_Stat(romPath, manifest.romSize, manifest.romWriteTime);
+    manifest.romCrc = mRomCrc;
+    manifest.portVersion = portVersion;
+    ExtractManifest_HashAssets(installPath + "/assets", version, manifest);
+
+    std::optional<ExtractManifest> previous = ExtractManifest::Load(manifestPath);
+    if (!force && previous.has_value()) {
+        const ExtractManifestDiff diff = ExtractManifest_Diff(*previous, manifest);
+        if (diff.IsEmpty() && previous->MatchesArchive(archivePath)) {
+            SPDLOG_INFO("{} is up to date, skipping extraction", otrFile);
+            // The rom may have been moved, keep its cached CRC reachable
+            manifest.archiveSize = previous->archiveSize;
+            manifest.archiveWriteTime = previous->archiveWriteTime;
+            manifest.Save(manifestPath);
+            return false;
+        }
+
+        SPDLOG_INFO("Re-extracting {}: rom changed: {}, port version changed: {}, config changed: {}", otrFile,
+                    diff.romChanged, diff.portVersionChanged, diff.configChanged);
+        for (const std::string& asset : diff.addedAssets) {
+            SPDLOG_INFO("Added {}", asset);
+        }
+        for (const std::string& asset : diff.changedAssets) {
+            SPDLOG_INFO("Changed {}", asset);
+        }
+        for (const std::string& asset : diff.removedAssets) {
+            SPDLOG_INFO("Removed {}", asset);
+        }
+    }
+
     // Work this out in the temporary folder
     std::string tempdir = Mkdtemp();
     std::string curdir = std::filesystem::current_path().string();
@@ -663,7 +730,6 @@ bool Extractor::CallZapd(std::string installPath, std::string exportdir) {
 
     snprintf(xmlPath, 1024, "assets/xml/%s", version);
     snprintf(confPath, 1024, "assets/Config_%s.xml", version);
-    snprintf(portVersion, 18, "%d.%d.%d", gBuildVersionMajor, gBuildVersionMinor, gBuildVersionPatch);
 
     argv[0] = "ZAPD";
     argv[1] = "ed";
@@ -709,7 +775,12 @@ bool Extractor::CallZapd(std::string installPath, std::string exportdir) {
     ShowWindow(cmdWindow, SW_HIDE);
 #endif
 
-    std::filesystem::copy(otrFile, exportdir + "/" + otrFile, std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::copy(otrFile, archivePath, std::filesystem::copy_options::overwrite_existing);
+
+    if (!ExtractManifest_Stat(archivePath, manifest.archiveSize, manifest.archiveWriteTime) ||
+        !manifest.Save(manifestPath)) {
+        SPDLOG_ERROR("Failed to write extraction manifest {}", manifestPath);
+    }
 
     // Go back to where this game was executed from
     std::filesystem::current_path(curdir);
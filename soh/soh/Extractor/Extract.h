@@ -30,11 +30,13 @@ class Extractor {
     std::string mCurrentRomPath;
     std::string mSearchPath;
     size_t mCurRomSize = 0;
+    uint32_t mRomCrc = 0;
 
     bool GetRomPathFromBox();
 
     uint32_t GetRomVerCrc() const;
     size_t GetCurRomSize() const;
+    bool GetCachedRomCrc(uint32_t& crc) const;
     bool ValidateAndFixRom();
     bool ValidateRomSize() const;
 
@@ -61,7 +63,8 @@ class Extractor {
 
     bool RunFileStandalone(std::string file);
     bool Run(std::string searchPath, RomSearchMode searchMode = RomSearchMode::Both);
-    bool CallZapd(std::string installPath, std::string exportdir);
+    // Skips extracting when the archive is up to date with the rom and extraction files, unless forced
+    bool CallZapd(std::string installPath, std::string exportdir, bool force = false);
     const char* GetZapdStr();
     std::string Mkdtemp();
 };
@@ -0,0 +1,209 @@
+#include "ExtractManifest.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
+
+namespace fs = std::filesystem;
+
+static constexpr uint64_t FNV_OFFSET = 0xCBF29CE484222325ull;
+static constexpr uint64_t FNV_PRIME = 0x100000001B3ull;
+static constexpr int MANIFEST_VERSION = 1;
+
+static uint64_t HashBytes(uint64_t hash, const char* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (uint8_t)data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint64_t HashFileInto(uint64_t hash, const fs::path& path) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        return 0;
+    }
+
+    char buffer[64 * 1024];
+    while (file) {
+        file.read(buffer, sizeof(buffer));
+        hash = HashBytes(hash, buffer, file.gcount());
+    }
+    return hash;
+}
+
+// Regular files below dir, sorted so the hash doesn't depend on directory iteration order
+static std::vector<fs::path> ListFiles(const fs::path& dir) {
+    std::vector<fs::path> files;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->is_regular_file()) {
+            files.push_back(it->path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+uint64_t ExtractManifest_HashFile(const std::string& path) {
+    return HashFileInto(FNV_OFFSET, path);
+}
+
+bool ExtractManifest_Stat(const std::string& path, uint64_t& size, int64_t& writeTime) {
+    std::error_code ec;
+    size = fs::file_size(path, ec);
+    if (ec) {
+        return false;
+    }
+    writeTime = fs::last_write_time(path, ec).time_since_epoch().count();
+    return !ec;
+}
+
+void ExtractManifest_HashAssets(const std::string& assetsPath, const std::string& version, ExtractManifest& manifest) {
+    const fs::path assets = assetsPath;
+
+    uint64_t configHash = HashFileInto(FNV_OFFSET, assets / ("Config_" + version + ".xml"));
+    for (const fs::path& file : ListFiles(assets / "filelists")) {
+        const std::string name = fs::relative(file, assets).generic_string();
+        configHash = HashBytes(configHash, name.c_str(), name.size() + 1);
+        configHash = HashFileInto(configHash, file);
+    }
+    manifest.configHash = configHash;
+
+    manifest.assetHashes.clear();
+    for (const fs::path& file : ListFiles(assets / "xml" / version)) {
+        manifest.assetHashes[fs::relative(file, assets).generic_string()] = HashFileInto(FNV_OFFSET, file);
+    }
+}
+
+std::string ExtractManifest::GetPath(const std::string& archivePath) {
+    return archivePath + ".manifest.json";
+}
+
+std::optional<ExtractManifest> ExtractManifest::Load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+
+    nlohmann::json json = nlohmann::json::parse(file, nullptr, false);
+    if (json.is_discarded() || json.value("version", 0) != MANIFEST_VERSION) {
+        return std::nullopt;
+    }
+
+    try {
+        ExtractManifest manifest;
+        manifest.romPath = json.at("romPath").get<std::string>();
+        manifest.romSize = json.at("romSize").get<uint64_t>();
+        manifest.romWriteTime = json.at("romWriteTime").get<int64_t>();
+        manifest.romCrc = json.at("romCrc").get<uint32_t>();
+        manifest.portVersion = json.at("portVersion").get<std::string>();
+        manifest.configHash = json.at("configHash").get<uint64_t>();
+        manifest.assetHashes = json.at("assets").get<std::map<std::string, uint64_t>>();
+        manifest.archiveSize = json.at("archiveSize").get<uint64_t>();
+        manifest.archiveWriteTime = json.at("archiveWriteTime").get<int64_t>();
+        return manifest;
+    } catch (const nlohmann::json::exception&) {
+        return std::nullopt;
+    }
+}
+
+bool ExtractManifest::Save(const std::string& path) const {
+    nlohmann::json json;
+    json["version"] = MANIFEST_VERSION;
+    json["romPath"] = romPath;
+    json["romSize"] = romSize;
+    json["romWriteTime"] = romWriteTime;
+    json["romCrc"] = romCrc;
+    json["portVersion"] = portVersion;
+    json["configHash"] = configHash;
+    json["assets"] = assetHashes;
+    json["archiveSize"] = archiveSize;
+    json["archiveWriteTime"] = archiveWriteTime;
+
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << json.dump(4);
+    return file.good();
+}
+
+bool ExtractManifest::MatchesRom(const std::string& path, uint64_t size, int64_t writeTime) const {
+    return romPath == path && romSize == size && romWriteTime == writeTime;
+}
+
+bool ExtractManifest::MatchesArchive(const std::string& archivePath) const {
+    uint64_t size;
+    int64_t writeTime;
+    return ExtractManifest_Stat(archivePath, size, writeTime) && size == archiveSize && writeTime == archiveWriteTime;
+}
+
+bool ExtractManifestDiff::IsEmpty() const {
+    return !romChanged && !portVersionChanged && !configChanged && addedAssets.empty() && changedAssets.empty() &&
+           removedAssets.empty();
+}
+
+ExtractManifestDiff ExtractManifest_Diff(const ExtractManifest& previous, const ExtractManifest& current) {
+    ExtractManifestDiff diff;
+    diff.romChanged = previous.romCrc != current.romCrc;
+    diff.portVersionChanged = previous.portVersion != current.portVersion;
+    diff.configChanged = previous.configHash != current.configHash;
+
+    for (const auto& [name, hash] : current.assetHashes) {
+        auto it = previous.assetHashes.find(name);
+        if (it == previous.assetHashes.end()) {
+            diff.addedAssets.push_back(name);
+        } else if (it->second != hash) {
+            diff.changedAssets.push_back(name);
+        }
+    }
+    for (const auto& [name, hash] : previous.assetHashes) {
+        if (!current.assetHashes.contains(name)) {
+            diff.removedAssets.push_back(name);
+        }
+    }
+    return diff;
+}
+
+bool ExtractManifest_Check(std::string& report) {
+    ExtractManifest previous;
+    previous.romCrc = 0x12345678;
+    previous.portVersion = "1.0.0";
+    previous.configHash = 1;
+    previous.assetHashes = { { "xml/a.xml", 1 }, { "xml/b.xml", 2 }, { "xml/c.xml", 3 } };
+
+    if (!ExtractManifest_Diff(previous, previous).IsEmpty()) {
+        report = "Identical manifests produced a diff";
+        return false;
+    }
+
+    ExtractManifest current = previous;
+    current.assetHashes.erase("xml/a.xml");
+    current.assetHashes["xml/b.xml"] = 20;
+    current.assetHashes["xml/d.xml"] = 4;
+
+    ExtractManifestDiff diff = ExtractManifest_Diff(previous, current);
+    if (diff.IsEmpty() || diff.romChanged || diff.portVersionChanged || diff.configChanged ||
+        diff.addedAssets != std::vector<std::string>{ "xml/d.xml" } ||
+        diff.changedAssets != std::vector<std::string>{ "xml/b.xml" } ||
+        diff.removedAssets != std::vector<std::string>{ "xml/a.xml" }) {
+        report = "Added, changed and removed assets were not reported as such";
+        return false;
+    }
+
+    current = previous;
+    current.romCrc++;
+    current.portVersion = "1.0.1";
+    current.configHash++;
+    diff = ExtractManifest_Diff(previous, current);
+    if (!diff.romChanged || !diff.portVersionChanged || !diff.configChanged || !diff.addedAssets.empty() ||
+        !diff.changedAssets.empty() || !diff.removedAssets.empty()) {
+        report = "Changed rom, port version and config were not reported as such";
+        return false;
+    }
+
+    report = "Manifest diffs are correct";
+    return true;
+}
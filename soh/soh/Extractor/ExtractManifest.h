@@ -0,0 +1,64 @@
+#ifndef EXTRACT_MANIFEST_H
+#define EXTRACT_MANIFEST_H
+
+#include <stdint.h>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+/*
+ * Written next to an extracted archive, records everything the archive was built from: the rom, the port version
+ * and a hash of every extraction xml. When none of it changed since the last extraction the archive can be kept as is.
+ */
+struct ExtractManifest {
+    // The rom CRC is cached against the rom's path, size and modification time so it doesn't have to be recomputed
+    std::string romPath;
+    uint64_t romSize = 0;
+    int64_t romWriteTime = 0;
+    uint32_t romCrc = 0;
+
+    std::string portVersion;
+    // Config xml and filelists
+    uint64_t configHash = 0;
+    // Extraction xml path relative to the assets folder -> content hash
+    std::map<std::string, uint64_t> assetHashes;
+
+    uint64_t archiveSize = 0;
+    int64_t archiveWriteTime = 0;
+
+    static std::string GetPath(const std::string& archivePath);
+    static std::optional<ExtractManifest> Load(const std::string& path);
+    bool Save(const std::string& path) const;
+
+    bool MatchesRom(const std::string& path, uint64_t size, int64_t writeTime) const;
+    // False if the archive is missing or was modified after the manifest was written
+    bool MatchesArchive(const std::string& archivePath) const;
+};
+
+struct ExtractManifestDiff {
+    bool romChanged = false;
+    bool portVersionChanged = false;
+    bool configChanged = false;
+    std::vector<std::string> addedAssets;
+    std::vector<std::string> changedAssets;
+    std::vector<std::string> removedAssets;
+
+    bool IsEmpty() const;
+};
+
+ExtractManifestDiff ExtractManifest_Diff(const ExtractManifest& previous, const ExtractManifest& current);
+
+// Checks that ExtractManifest_Diff reports the added, removed and changed assets and the changed inputs of fixed
+// manifests. On failure report describes the first wrong diff.
+bool ExtractManifest_Check(std::string& report);
+
+// Fills configHash and assetHashes from the extraction files for the given rom version in assetsPath
+void ExtractManifest_HashAssets(const std::string& assetsPath, const std::string& version, ExtractManifest& manifest);
+
+// FNV-1a over the file contents, 0 if the file can't be read
+uint64_t ExtractManifest_HashFile(const std::string& path);
+// Size and modification time of a file, false if it doesn't exist
+bool ExtractManifest_Stat(const std::string& path, uint64_t& size, int64_t& writeTime);
+
+#endif
@@ -54,29 +54,34 @@ void Anchor::HandlePacket_GiveItem(nlohmann::json payload) {
     u16 modId = payload["modId"].get<u16>();
     u16 getItemId = payload["getItemId"].get<u16>();
 
-    GetItemEntry getItemEntry;
+    const GetItemEntry* getItemEntry;
+    std::shared_ptr<GetItemEntry> randoEntry;
     if (modId == MOD_NONE) {
-        getItemEntry = ItemTableManager::Instance->RetrieveItemEntry(MOD_NONE, getItemId);
+        getItemEntry = ItemTableManager::Instance->FindItemEntry(MOD_NONE, getItemId);
     } else {
-        getItemEntry = Rando::StaticData::RetrieveItem(static_cast<RandomizerGet>(getItemId)).GetGIEntry_Copy();
+        randoEntry = Rando::StaticData::RetrieveItem(static_cast<RandomizerGet>(getItemId)).GetGIEntry();
+        getItemEntry = randoEntry.get();
+    }
+    if (getItemEntry == nullptr) {
+        return;
     }
 
-    if (getItemEntry.modIndex == MOD_NONE) {
-        if (getItemEntry.getItemId == GI_SWORD_BGS) {
+    if (getItemEntry->modIndex == MOD_NONE) {
+        if (getItemEntry->getItemId == GI_SWORD_BGS) {
             gSaveContext.bgsFlag = true;
         }
-        Item_Give(gPlayState, getItemEntry.itemId);
-    } else if (getItemEntry.modIndex == MOD_RANDOMIZER) {
-        if (getItemEntry.getItemId == RG_ICE_TRAP) {
+        Item_Give(gPlayState, getItemEntry->itemId);
+    } else if (getItemEntry->modIndex == MOD_RANDOMIZER) {
+        if (getItemEntry->getItemId == RG_ICE_TRAP) {
             gSaveContext.ship.pendingIceTrapCount++;
             incomingIceTrapsFromAnchor++;
         } else {
-            Randomizer_Item_Give(gPlayState, getItemEntry);
+            Randomizer_Item_Give(gPlayState, *getItemEntry);
         }
     }
 
     // Full heal if getting a heart container or piece
-    if (getItemEntry.gid == GID_HEART_CONTAINER || getItemEntry.gid == GID_HEART_PIECE) {
+    if (getItemEntry->gid == GID_HEART_CONTAINER || getItemEntry->gid == GID_HEART_PIECE) {
         gSaveContext.healthAccumulator = 0x140;
     }
 
@@ -89,19 +94,19 @@ void Anchor::HandlePacket_GiveItem(nlohmann::json payload) {
         gSaveContext.health += 0x10 * (heartPieces / 4);
     }
 
-    if (getItemEntry.getItemCategory != ITEM_CATEGORY_JUNK) {
-        if (getItemEntry.modIndex == MOD_NONE) {
+    if (getItemEntry->getItemCategory != ITEM_CATEGORY_JUNK) {
+        if (getItemEntry->modIndex == MOD_NONE) {
             Notification::Emit({
-                .itemIcon = GetTextureForItemId(getItemEntry.itemId),
+                .itemIcon = GetTextureForItemId(getItemEntry->itemId),
                 .prefix = client.name,
                 .message = "found",
-                .suffix = SohUtils::GetItemName(getItemEntry.itemId),
+                .suffix = SohUtils::GetItemName(getItemEntry->itemId),
             });
-        } else if (getItemEntry.modIndex == MOD_RANDOMIZER) {
+        } else if (getItemEntry->modIndex == MOD_RANDOMIZER) {
             Notification::Emit({
                 .prefix = client.name,
                 .message = "found",
-                .suffix = Rando::StaticData::RetrieveItem((RandomizerGet)getItemEntry.getItemId).GetName().english,
+                .suffix = Rando::StaticData::RetrieveItem((RandomizerGet)getItemEntry->getItemId).GetName().english,
             });
         }
     }
@@ -37,6 +37,9 @@
 #include "Enhancements/randomizer/static_data.h"
 #include "Enhancements/randomizer/dungeon.h"
 #include "Enhancements/gameplaystats.h"
+#include "Enhancements/debugger/frameProfiler.h"
+#include "Enhancements/debugger/replayHarness.h"
+#include "Enhancements/Fuse/FuseLog.h"
 #include "frame_interpolation.h"
 #include "variables.h"
 #include "z64.h"
@@ -595,6 +598,7 @@ void OTRAudio_Thread() {
         // 3 is the maximum authentic frame divisor.
         s16 audio_buffer[SAMPLES_HIGH * NUM_AUDIO_CHANNELS * 3];
         for (int i = 0; i < AUDIO_FRAMES_PER_UPDATE; i++) {
+            FRAME_PROFILER_SCOPE("AudioMgr_CreateNextAudioBuffer");
             AudioMgr_CreateNextAudioBuffer(audio_buffer + i * (num_audio_samples * NUM_AUDIO_CHANNELS),
                                            num_audio_samples);
         }
@@ -789,6 +793,7 @@ extern "C" void VanillaItemTable_Init() {
         // the GetItemID values and removing the need for the `- 1`
         ItemTableManager::Instance->AddItemEntry(MOD_NONE, i + 1, getItemTable[i]);
     }
+    ItemTableManager::Instance->Freeze();
 }
 
 std::unordered_map<ItemID, GetItemID> ItemIDtoGetItemIDMap{
@@ -1144,7 +1149,17 @@ void CheckAndCreateModFolder() {
 extern "C" void InitOTR(int argc, char* argv[]) {
 #if !defined(__SWITCH__) && !defined(__WIIU__)
     if (argc > 1) {
+        bool processedFile = false;
         for (int i = 1; i < argc; i++) {
+#ifdef ENABLE_FRAME_PROFILER
+            if (FrameProfiler_ParseArg(argv[i])) {
+                continue;
+            }
+#endif
+            if (ReplayHarness_ParseArg(argv[i])) {
+                continue;
+            }
+            processedFile = true;
             std::string installPath = Ship::Context::GetAppBundlePath();
             Extractor extract;
             if (extract.RunFileStandalone(argv[i])) {
@@ -1155,14 +1170,16 @@ extern "C" void InitOTR(int argc, char* argv[]) {
                     doExtract = extract.ShowYesNoBox("Confirm Re-extract", msg.c_str()) == IDYES;
                 }
                 if (doExtract) {
-                    extract.CallZapd(installPath, Ship::Context::GetAppDirectoryPath(appShortName));
+                    // The user asked to extract again, so don't skip an up to date archive
+                    extract.CallZapd(installPath, Ship::Context::GetAppDirectoryPath(appShortName), true);
                 }
             } else {
                 std::string msg = "File " + std::string(argv[i]) + " is not a ROM or does not match supported ROMs.";
                 extract.ShowErrorBox("Incompatible File", msg.c_str());
             }
         }
-        if (Extractor::ShowYesNoBox("Run Ship of Harkinian", "All files have been processed. Run SoH?") != IDYES) {
+        if (processedFile &&
+            Extractor::ShowYesNoBox("Run Ship of Harkinian", "All files have been processed. Run SoH?") != IDYES) {
             exit(0);
         }
     }
@@ -1373,6 +1390,9 @@ extern "C" void DeinitOTR() {
     // these shared ptrs.
     SohGui::Destroy();
 
+    // Write out what Fuse logged during shutdown while stdout and the debugger output are still around
+    Fuse::FlushLog();
+
     OTRGlobals::Instance->context = nullptr;
 }
 
@@ -1565,6 +1585,7 @@ extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
     while (time + original_fps <= next_original_frame) {
         time += original_fps;
         if (time != next_original_frame) {
+            FRAME_PROFILER_SCOPE("FrameInterpolation_Interpolate");
             mtx_replacements.push_back(FrameInterpolation_Interpolate((float)time / next_original_frame));
         } else {
             mtx_replacements.emplace_back();
@@ -1595,6 +1616,9 @@ extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
         }
     }
 
+    FRAME_PROFILER_END_FRAME();
+    ReplayHarness_EndFrame();
+
     bool curAltAssets = CVarGetInteger(CVAR_SETTING("AltAssets"), 1);
     if (prevAltAssets != curAltAssets) {
         prevAltAssets = curAltAssets;
@@ -2198,8 +2222,11 @@ extern "C" FishIdentity Randomizer_IdentifyFish(s32 sceneNum, s32 actorParams) {
 }
 
 extern "C" GetItemEntry ItemTable_Retrieve(int16_t getItemID) {
-    GetItemEntry giEntry = ItemTableManager::Instance->RetrieveItemEntry(MOD_NONE, getItemID);
-    return giEntry;
+    const GetItemEntry* giEntry = ItemTableManager::Instance->FindItemEntry(MOD_NONE, getItemID);
+    if (giEntry == nullptr) {
+        return GET_ITEM_NONE;
+    }
+    return *giEntry;
 }
 
 extern "C" GetItemEntry ItemTable_RetrieveEntry(s16 tableID, s16 getItemID) {
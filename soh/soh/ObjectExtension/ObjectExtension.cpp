@@ -5,8 +5,9 @@ ObjectExtension& ObjectExtension::GetInstance() {
     return instance;
 }
 
-ObjectExtension::Id ObjectExtension::RegisterId() {
-    return NextId++;
+ObjectExtension::Id ObjectExtension::RegisterStorage(std::unique_ptr<StorageBase> storage) {
+    Storages.push_back(std::move(storage));
+    return static_cast<Id>(Storages.size() - 1);
 }
 
 void ObjectExtension::Free(const void* object) {
@@ -14,10 +15,90 @@ void ObjectExtension::Free(const void* object) {
         return;
     }
 
-    std::erase_if(Data, [&object](const auto& iter) {
-        auto const& [key, value] = iter;
-        return key.first == object;
-    });
+    for (auto& storage : Storages) {
+        storage->Erase(object);
+    }
+}
+
+size_t ObjectExtension::ObjectIndex::Home(const void* object) const {
+    // Fibonacci hashing, folded so the low bits used for the index depend on every bit of the pointer
+    const uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(object)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash ^ (hash >> 32)) & (Entries.size() - 1);
+}
+
+uint32_t ObjectExtension::ObjectIndex::Find(const void* object) const {
+    if (Entries.empty()) {
+        return NoSlot;
+    }
+
+    const size_t mask = Entries.size() - 1;
+    for (size_t i = Home(object);; i = (i + 1) & mask) {
+        if (Entries[i].object == object) {
+            return Entries[i].slot;
+        }
+        if (Entries[i].object == nullptr) {
+            return NoSlot;
+        }
+    }
+}
+
+void ObjectExtension::ObjectIndex::Insert(const void* object, uint32_t slot) {
+    // Keep the load factor below 3/4 so probe sequences stay short
+    if ((Count + 1) * 4 > Entries.size() * 3) {
+        Grow();
+    }
+
+    const size_t mask = Entries.size() - 1;
+    size_t i = Home(object);
+    while (Entries[i].object != nullptr && Entries[i].object != object) {
+        i = (i + 1) & mask;
+    }
+    if (Entries[i].object == nullptr) {
+        Count++;
+    }
+    Entries[i] = { object, slot };
+}
+
+uint32_t ObjectExtension::ObjectIndex::Erase(const void* object) {
+    if (Entries.empty()) {
+        return NoSlot;
+    }
+
+    const size_t mask = Entries.size() - 1;
+    size_t i = Home(object);
+    while (Entries[i].object != object) {
+        if (Entries[i].object == nullptr) {
+            return NoSlot;
+        }
+        i = (i + 1) & mask;
+    }
+    const uint32_t slot = Entries[i].slot;
+
+    // Shift back the following entries of the probe sequence instead of leaving a tombstone
+    for (size_t j = (i + 1) & mask; Entries[j].object != nullptr; j = (j + 1) & mask) {
+        const size_t home = Home(Entries[j].object);
+        const bool between = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+        if (!between) {
+            Entries[i] = Entries[j];
+            i = j;
+        }
+    }
+    Entries[i] = {};
+    Count--;
+
+    return slot;
+}
+
+void ObjectExtension::ObjectIndex::Grow() {
+    std::vector<Entry> old = std::move(Entries);
+    Entries.assign(old.empty() ? 16 : old.size() * 2, Entry{});
+    Count = 0;
+
+    for (const Entry& entry : old) {
+        if (entry.object != nullptr) {
+            Insert(entry.object, entry.slot);
+        }
+    }
 }
 
 extern "C" void ObjectExtension_Free(const void* object) {
@@ -4,10 +4,11 @@
 
 #include <libultraship/libultraship.h>
 
-#include <any>
+#include <deque>
 #include <limits>
+#include <memory>
+#include <optional>
 #include <stdint.h>
-#include <unordered_map>
 #include <vector>
 
 /*
@@ -36,7 +37,7 @@ class ObjectExtension {
     template <typename T> class Register {
       public:
         Register() {
-            Id = ObjectExtension::GetInstance().RegisterId();
+            Id = ObjectExtension::GetInstance().RegisterStorage(std::make_unique<Storage<T>>());
         }
 
         static ObjectExtension::Id Id;
@@ -52,19 +53,14 @@ class ObjectExtension {
             return nullptr;
         }
 
-        auto it = Data.find(std::make_pair(object, ObjectExtension::Register<T>::Id));
-        if (it == Data.end()) {
-            return nullptr;
-        }
-
-        return std::any_cast<T>(&(it->second));
+        return GetStorage<T>().Find(object);
     }
 
     // Sets the data of type T for an object. Data will be copied.
     template <typename T> void Set(const void* object, const T&& data) {
         assert(ObjectExtension::Register<T>::Id != InvalidId);
         if (object != nullptr) {
-            Data[std::make_pair(object, ObjectExtension::Register<T>::Id)] = data;
+            GetStorage<T>().Assign(object, data);
         }
     }
 
@@ -75,14 +71,14 @@ class ObjectExtension {
             return false;
         }
 
-        return Data.contains(std::make_pair(object, ObjectExtension::Register<T>::Id));
+        return GetStorage<T>().Find(object) != nullptr;
     }
 
     // Removes data of type T from an object
     template <typename T> void Remove(const void* object) {
         assert(ObjectExtension::Register<T>::Id != InvalidId);
 
-        Data.erase(std::make_pair(object, ObjectExtension::Register<T>::Id));
+        GetStorage<T>().Erase(object);
     }
 
     // Removes all data from an object
@@ -91,19 +87,85 @@ class ObjectExtension {
   private:
     ObjectExtension() = default;
 
-    // Returns the next free object extension Id
-    Id RegisterId();
+    // Maps objects to slots in the storage of one type. Open addressing with linear probing.
+    class ObjectIndex {
+      public:
+        static constexpr uint32_t NoSlot = std::numeric_limits<uint32_t>::max();
+
+        uint32_t Find(const void* object) const;
+        void Insert(const void* object, uint32_t slot);
+        // Returns the slot the object was mapped to, or NoSlot
+        uint32_t Erase(const void* object);
+
+      private:
+        struct Entry {
+            const void* object = nullptr;
+            uint32_t slot = NoSlot;
+        };
+
+        size_t Home(const void* object) const;
+        void Grow();
+
+        std::vector<Entry> Entries;
+        size_t Count = 0;
+    };
+
+    class StorageBase {
+      public:
+        virtual ~StorageBase() = default;
+        virtual void Erase(const void* object) = 0;
+    };
+
+    // All data of type T. Slots of removed data are reused, and a deque keeps the pointers returned by Get valid while
+    // data is attached to other objects.
+    template <typename T> class Storage final : public StorageBase {
+      public:
+        T* Find(const void* object) {
+            const uint32_t slot = Index.Find(object);
+            return slot != ObjectIndex::NoSlot ? &*Values[slot] : nullptr;
+        }
 
-    ObjectExtension::Id NextId = 0;
+        void Assign(const void* object, const T& data) {
+            uint32_t slot = Index.Find(object);
+            if (slot != ObjectIndex::NoSlot) {
+                Values[slot].emplace(data);
+                return;
+            }
+
+            if (FreeSlots.empty()) {
+                slot = static_cast<uint32_t>(Values.size());
+                Values.emplace_back();
+            } else {
+                slot = FreeSlots.back();
+                FreeSlots.pop_back();
+            }
+            Values[slot].emplace(data);
+            Index.Insert(object, slot);
+        }
 
-    struct KeyHash {
-        std::size_t operator()(const std::pair<const void*, ObjectExtension::Id>& key) const {
-            return std::hash<const void*>{}(key.first) ^ (std::hash<ObjectExtension::Id>{}(key.second) << 1);
+        void Erase(const void* object) override {
+            const uint32_t slot = Index.Erase(object);
+            if (slot != ObjectIndex::NoSlot) {
+                Values[slot].reset();
+                FreeSlots.push_back(slot);
+            }
         }
+
+      private:
+        ObjectIndex Index;
+        std::deque<std::optional<T>> Values;
+        std::vector<uint32_t> FreeSlots;
     };
 
-    // Collection of all object extension data.
-    std::unordered_map<std::pair<const void*, ObjectExtension::Id>, std::any, KeyHash> Data;
+    // Takes ownership of the storage of a newly registered type and returns the type's Id
+    Id RegisterStorage(std::unique_ptr<StorageBase> storage);
+
+    template <typename T> Storage<T>& GetStorage() {
+        return static_cast<Storage<T>&>(*Storages[ObjectExtension::Register<T>::Id]);
+    }
+
+    // Storage of every registered type, indexed by Id
+    std::vector<std::unique_ptr<StorageBase>> Storages;
 };
 
 // Static template globals
@@ -11,6 +11,8 @@
 #include "resource/type/Array.h"
 #include "resource/type/Skeleton.h"
 #include "resource/type/PlayerAnimation.h"
+#include "resource/type/Background.h"
+#include "resource/BackgroundDecoder.h"
 #include <fast/Fast3dWindow.h>
 #include <fast/resource/ResourceType.h>
 #include <fast/resource/type/DisplayList.h>
@@ -224,42 +226,24 @@ extern "C" uint8_t ResourceMgr_ResourceIsBackground(char* texPath) {
     return res->GetInitData()->Type == static_cast<uint32_t>(SOH::ResourceType::SOH_Background);
 }
 
-extern "C" char* ResourceMgr_LoadJPEG(char* data, size_t dataSize) {
-    static char* finalBuffer = 0;
+extern "C" uint8_t ResourceMgr_LoadJPEG(const char* data, size_t dataSize, char* out, size_t outSize) {
+    return SOH::BackgroundDecoder::Instance().Decode((const uint8_t*)data, dataSize, (uint8_t*)out, outSize);
+}
 
-    if (finalBuffer == 0) {
-        finalBuffer = (char*)malloc(dataSize);
+extern "C" void ResourceMgr_PrefetchBackground(const char* texPath) {
+    ResourceMgr_UnloadOriginalWhenAltExists(texPath);
+    auto res = ResourceMgr_GetResourceByNameHandlingMQ(texPath);
+    if (res == nullptr || res->GetInitData()->Type != static_cast<uint32_t>(SOH::ResourceType::SOH_Background)) {
+        return;
     }
 
-    int w;
-    int h;
-    int comp;
-
-    unsigned char* pixels =
-        stbi_load_from_memory((const unsigned char*)data, 320 * 240 * 2, &w, &h, &comp, STBI_rgb_alpha);
-    // unsigned char* pixels = stbi_load_from_memory((const unsigned char*)data, 480 * 240 * 2, &w, &h, &comp,
-    // STBI_rgb_alpha);
-    int idx = 0;
-
-    for (int y = 0; y < h; y++) {
-        for (int x = 0; x < w; x++) {
-            uint16_t* bufferTest = (uint16_t*)finalBuffer;
-            int pixelIdx = ((y * w) + x) * 4;
-
-            uint8_t r = pixels[pixelIdx + 0] / 8;
-            uint8_t g = pixels[pixelIdx + 1] / 8;
-            uint8_t b = pixels[pixelIdx + 2] / 8;
-
-            uint8_t alphaBit = pixels[pixelIdx + 3] != 0;
-
-            uint16_t data = (r << 11) + (g << 6) + (b << 1) + alphaBit;
-
-            finalBuffer[idx++] = (data & 0xFF00) >> 8;
-            finalBuffer[idx++] = (data & 0x00FF);
-        }
+    // Already converted in place by an earlier draw
+    auto background = std::static_pointer_cast<SOH::Background>(res);
+    if (background->Data.size() < BACKGROUND_BUFFER_SIZE || background->Data[0] != 0xFF ||
+        background->Data[1] != 0xD8) {
+        return;
     }
-
-    return (char*)finalBuffer;
+    SOH::BackgroundDecoder::Instance().Prefetch(background->Data.data(), BACKGROUND_BUFFER_SIZE);
 }
 
 extern "C" char* ResourceMgr_LoadTexOrDListByName(const char* filePath) {
@@ -377,6 +361,20 @@ extern "C" void ResourceMgr_PatchGfxCopyCommandByName(const char* path, const ch
     *destinationGfx = sourceGfx;
 }
 
+Gfx* ResourceMgr_GetGfxPatchSlotByName(const char* path, int index, std::shared_ptr<Ship::IResource>& resource) {
+    auto res = std::static_pointer_cast<Fast::DisplayList>(
+        Ship::Context::GetInstance()->GetResourceManager()->LoadResource(path));
+
+    // Do not patch custom assets as they most likely do not have the same instructions as authentic assets
+    if (res->GetInitData()->IsCustom) {
+        resource = nullptr;
+        return nullptr;
+    }
+
+    resource = res;
+    return (Gfx*)&res->Instructions[index];
+}
+
 extern "C" void ResourceMgr_UnpatchGfxByName(const char* path, const char* patchName) {
     if (originalGfx.contains(path) && originalGfx[path].contains(patchName)) {
         auto res = std::static_pointer_cast<Fast::DisplayList>(
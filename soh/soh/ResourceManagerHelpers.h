@@ -8,11 +8,17 @@
 #define GAME_PLATFORM_N64 0
 #define GAME_PLATFORM_GC 1
 
+// Prerendered backgrounds are stored in a full 320x240 RGBA16 buffer, the JPEG stream sits at its start
+#define BACKGROUND_BUFFER_SIZE (320 * 240 * 2)
+
 #ifdef __cplusplus
 #include <memory>
 #include <ship/resource/Resource.h>
 
 std::shared_ptr<Ship::IResource> ResourceMgr_GetResourceByNameHandlingMQ(const char* path);
+// Returns the instruction at index in the display list at path, with resource holding the display list alive for as
+// long as the pointer is used. Returns nullptr for custom assets, which are never patched.
+Gfx* ResourceMgr_GetGfxPatchSlotByName(const char* path, int index, std::shared_ptr<Ship::IResource>& resource);
 
 extern "C" {
 #endif // __cplusplus
@@ -36,7 +42,8 @@ uint8_t ResourceMgr_FileAltExists(const char* resName);
 void ResourceMgr_UnloadOriginalWhenAltExists(const char* resName);
 uint8_t ResourceMgr_TexIsRaw(const char* texPath);
 uint8_t ResourceMgr_ResourceIsBackground(char* texPath);
-char* ResourceMgr_LoadJPEG(char* data, size_t dataSize);
+uint8_t ResourceMgr_LoadJPEG(const char* data, size_t dataSize, char* out, size_t outSize);
+void ResourceMgr_PrefetchBackground(const char* texPath);
 uint16_t ResourceMgr_LoadTexWidthByName(char* texPath);
 uint16_t ResourceMgr_LoadTexHeightByName(char* texPath);
 char* ResourceMgr_LoadTexOrDListByName(const char* filePath);
@@ -9,6 +9,8 @@
 #include <unordered_map>
 #include <functional>
 
+#include "soh/CVarHandle.h"
+
 struct ShipInit {
     static std::unordered_map<std::string, std::vector<std::function<void()>>>& GetAll() {
         static std::unordered_map<std::string, std::vector<std::function<void()>>> shipInitFuncs;
@@ -20,6 +22,8 @@ struct ShipInit {
     }
 
     static void Init(const std::string& path) {
+        // Anything that may have changed a CVar runs through here, so cached handles must re-resolve
+        CVarHandle_Invalidate();
         auto& shipInitFuncs = ShipInit::GetAll();
         for (const auto& initFunc : shipInitFuncs[path]) {
             initFunc();
@@ -511,8 +511,12 @@ void Menu::MenuDrawItem(WidgetInfo& widget, uint32_t width, UIWidgets::Colors me
                     modifiers |= UIWidgets::ColorPickerResetButton;
                 if (options->showRainbow)
                     modifiers |= UIWidgets::ColorPickerRainbowCheck;
-                UIWidgets::CVarColorPicker(widget.name.c_str(), widget.cVar, options->defaultValue, options->useAlpha,
-                                           modifiers, options->color);
+                if (UIWidgets::CVarColorPicker(widget.name.c_str(), widget.cVar, options->defaultValue,
+                                               options->useAlpha, modifiers, options->color)) {
+                    if (widget.callback != nullptr) {
+                        widget.callback(widget);
+                    }
+                }
             } break;
             case WIDGET_SEARCH: {
                 UIWidgets::PushStyleButton(menuThemeIndex);
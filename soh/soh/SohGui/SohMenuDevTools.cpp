@@ -23,6 +23,14 @@ static const std::unordered_map<int32_t, const char*> debugSaveFileModes = {
     { 2, "Maxed" },
 };
 
+#ifdef ENABLE_FRAME_PROFILER
+static const std::unordered_map<int32_t, const char*> frameProfilerExportModes = {
+    { 0, "Off" },
+    { 1, "Chrome Trace" },
+    { 2, "CSV Summary" },
+};
+#endif
+
 void SohMenu::AddMenuDevTools() {
     // Add Dev Tools Menu
     AddMenuEntry("Dev Tools", CVAR_SETTING("Menu.DevToolsSidebarSection"));
@@ -77,6 +85,11 @@ void SohMenu::AddMenuDevTools() {
     AddWidget(path, "Resource logging", WIDGET_CVAR_CHECKBOX)
         .CVar(CVAR_DEVELOPER_TOOLS("ResourceLogging"))
         .Options(CheckboxOptions().Tooltip("Logs some resources as XML when they're loaded in binary format."));
+    AddWidget(path, "Verify Camera Collision Cache", WIDGET_CVAR_CHECKBOX)
+        .CVar(CVAR_DEVELOPER_TOOLS("CameraCollisionCacheVerify"))
+        .Options(CheckboxOptions().Tooltip(
+            "Repeats every camera collision query answered from the per-frame cache and logs any result that differs "
+            "from the cached one."));
 
     AddWidget(path, "Frame Advance", WIDGET_CHECKBOX)
         .Options(CheckboxOptions().Tooltip(
@@ -133,6 +146,21 @@ void SohMenu::AddMenuDevTools() {
         .WindowName("Stats##Soh")
         .HideInSearch(true)
         .Options(WindowButtonOptions().Tooltip("Enables the separate Stats Window."));
+#ifdef ENABLE_FRAME_PROFILER
+    AddWidget(path, "Profiler Export Frames: %d", WIDGET_CVAR_SLIDER_INT)
+        .CVar(CVAR_DEVELOPER_TOOLS("FrameProfiler.ExportFrames"))
+        .Options(IntSliderOptions()
+                     .Min(1)
+                     .Max(3600)
+                     .DefaultValue(600)
+                     .Tooltip("Number of frames captured by the next profiler export."));
+    AddWidget(path, "Profiler Export", WIDGET_CVAR_COMBOBOX)
+        .CVar(CVAR_DEVELOPER_TOOLS("FrameProfiler.Export"))
+        .Options(ComboboxOptions()
+                     .Tooltip("Captures profiler zones for the configured number of frames, then writes "
+                              "frame_profile.json (Chrome trace) or frame_profile.csv next to the save folder.")
+                     .ComboMap(frameProfilerExportModes));
+#endif
 
     // Console
     path.sidebarName = "Console";
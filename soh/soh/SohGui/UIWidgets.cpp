@@ -885,6 +885,8 @@ bool CVarColorPicker(const char* label, const char* cvarName, Color_RGBA8 defaul
     Color_RGBA8 color = CVarGetColor(valueCVar.c_str(), defaultColor);
     ImVec4 colorVec = ImVec4(color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f);
     bool changed = false;
+    // Reset and Random write the cvar themselves, so they are reported separately from the picker edit below
+    bool buttonChanged = false;
     bool showReset = modifiers & ColorPickerResetButton;
     bool showRandom = modifiers & ColorPickerRandomButton;
     bool showRainbow = modifiers & ColorPickerRainbowCheck;
@@ -916,6 +918,7 @@ bool CVarColorPicker(const char* label, const char* cvarName, Color_RGBA8 defaul
             CVarClear((std::string(cvarName) + ".Type").c_str());
             CVarClearBlock(valueCVar.c_str());
             Ship::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesNextFrame();
+            buttonChanged = true;
         }
     }
     if (showRandom) {
@@ -933,6 +936,7 @@ bool CVarColorPicker(const char* label, const char* cvarName, Color_RGBA8 defaul
             CVarSetInteger(rainbowCVar.c_str(), 0); // On click disable rainbow mode.
             ShipInit::Init(rainbowCVar.c_str());
             Ship::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesNextFrame();
+            buttonChanged = true;
         }
     }
     if (showRainbow) {
@@ -965,7 +969,7 @@ bool CVarColorPicker(const char* label, const char* cvarName, Color_RGBA8 defaul
         changed = true;
     }
 
-    return changed;
+    return changed || buttonChanged;
 }
 
 bool RadioButton(const char* label, bool active, const RadioButtonsOptions& options) {
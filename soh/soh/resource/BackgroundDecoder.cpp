@@ -0,0 +1,174 @@
+#include "BackgroundDecoder.h"
+
+#include <cstring>
+#include <libultraship/libultraship.h>
+#include <fast/Fast3dWindow.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BACKGROUND_DECODER_SSE2
+#endif
+
+namespace SOH {
+
+namespace {
+
+// Enough for every background of the area the player is in, plus the area they just left
+constexpr size_t kCacheCapacity = 8;
+
+inline uint16_t PackRgba5551(const uint8_t* px) {
+    uint16_t value = ((px[0] >> 3) << 11) | ((px[1] >> 3) << 6) | ((px[2] >> 3) << 1) | (px[3] != 0);
+    return (value >> 8) | (value << 8);
+}
+
+// RGBA8 to big-endian RGBA5551, alpha becomes 1 for any non-zero alpha
+void ConvertRgba8ToRgba5551(const uint8_t* src, uint8_t* dst, size_t pixelCount) {
+    size_t i = 0;
+
+#ifdef BACKGROUND_DECODER_SSE2
+    const __m128i mask5 = _mm_set1_epi32(0x1F);
+    const __m128i alphaMask = _mm_set1_epi32(static_cast<int32_t>(0xFF000000));
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i lowByte = _mm_set1_epi32(0xFF);
+
+    auto convert4 = [&](__m128i px) {
+        __m128i r = _mm_and_si128(_mm_srli_epi32(px, 3), mask5);
+        __m128i g = _mm_and_si128(_mm_srli_epi32(px, 11), mask5);
+        __m128i b = _mm_and_si128(_mm_srli_epi32(px, 19), mask5);
+        __m128i a = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(px, alphaMask), _mm_setzero_si128()), one);
+        __m128i value = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 11), _mm_slli_epi32(g, 6)),
+                                     _mm_or_si128(_mm_slli_epi32(b, 1), a));
+        // Byte swap to big-endian, then sign-extend so the signed 32->16 pack below is exact
+        value = _mm_or_si128(_mm_srli_epi32(value, 8), _mm_slli_epi32(_mm_and_si128(value, lowByte), 8));
+        return _mm_srai_epi32(_mm_slli_epi32(value, 16), 16);
+    };
+
+    for (; i + 8 <= pixelCount; i += 8) {
+        __m128i lo = convert4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i * 4])));
+        __m128i hi = convert4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i * 4 + 16])));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i * 2]), _mm_packs_epi32(lo, hi));
+    }
+#endif
+
+    for (; i < pixelCount; i++) {
+        uint16_t value = PackRgba5551(&src[i * 4]);
+        memcpy(&dst[i * 2], &value, sizeof(value));
+    }
+}
+
+} // namespace
+
+BackgroundDecoder& BackgroundDecoder::Instance() {
+    static BackgroundDecoder sInstance;
+    return sInstance;
+}
+
+BackgroundDecoder::BackgroundDecoder() : mWorkers(std::make_unique<BS::thread_pool>(1)) {
+}
+
+BackgroundDecoder::~BackgroundDecoder() {
+    mWorkers->wait();
+}
+
+uint64_t BackgroundDecoder::HashStream(const uint8_t* data, size_t dataSize) {
+    // FNV-1a over 64-bit words, far cheaper than the decode it guards
+    uint64_t hash = 0xCBF29CE484222325ull ^ dataSize;
+    size_t i = 0;
+    for (; i + 8 <= dataSize; i += 8) {
+        uint64_t word;
+        memcpy(&word, &data[i], sizeof(word));
+        hash = (hash ^ word) * 0x100000001B3ull;
+    }
+    for (; i < dataSize; i++) {
+        hash = (hash ^ data[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+BackgroundDecoder::Pixels BackgroundDecoder::DecodeJpeg(const uint8_t* data, size_t dataSize) {
+    int width;
+    int height;
+    int comp;
+    uint8_t* rgba = stbi_load_from_memory(data, static_cast<int>(dataSize), &width, &height, &comp, STBI_rgb_alpha);
+    if (rgba == nullptr) {
+        SPDLOG_ERROR("Failed to decode background: {}", stbi_failure_reason());
+        return nullptr;
+    }
+
+    auto pixels = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(width) * height * 2);
+    ConvertRgba8ToRgba5551(rgba, pixels->data(), static_cast<size_t>(width) * height);
+    stbi_image_free(rgba);
+    return pixels;
+}
+
+BackgroundDecoder::Pixels BackgroundDecoder::FindLocked(uint64_t key) {
+    auto it = mEntries.find(key);
+    if (it == mEntries.end()) {
+        return nullptr;
+    }
+    mLru.splice(mLru.begin(), mLru, it->second);
+    return it->second->pixels;
+}
+
+void BackgroundDecoder::InsertLocked(uint64_t key, Pixels pixels) {
+    if (pixels == nullptr || mEntries.contains(key)) {
+        return;
+    }
+    mLru.push_front({ key, std::move(pixels) });
+    mEntries[key] = mLru.begin();
+    if (mLru.size() > kCacheCapacity) {
+        mEntries.erase(mLru.back().key);
+        mLru.pop_back();
+    }
+}
+
+bool BackgroundDecoder::Decode(const uint8_t* data, size_t dataSize, uint8_t* out, size_t outSize) {
+    const uint64_t key = HashStream(data, dataSize);
+
+    Pixels pixels;
+    std::shared_future<Pixels> pending;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        pixels = FindLocked(key);
+        if (pixels == nullptr) {
+            auto it = mPending.find(key);
+            if (it != mPending.end()) {
+                pending = it->second;
+            }
+        }
+    }
+
+    if (pixels == nullptr) {
+        pixels = pending.valid() ? pending.get() : DecodeJpeg(data, dataSize);
+        std::lock_guard<std::mutex> lock(mMutex);
+        InsertLocked(key, pixels);
+    }
+
+    if (pixels == nullptr || pixels->size() > outSize) {
+        return false;
+    }
+    memcpy(out, pixels->data(), pixels->size());
+    return true;
+}
+
+void BackgroundDecoder::Prefetch(const uint8_t* data, size_t dataSize) {
+    const uint64_t key = HashStream(data, dataSize);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mEntries.contains(key) || mPending.contains(key)) {
+        return;
+    }
+
+    auto jpeg = std::make_shared<std::vector<uint8_t>>(data, data + dataSize);
+    mPending[key] = mWorkers
+                        ->submit_task([this, key, jpeg]() {
+                            Pixels pixels = DecodeJpeg(jpeg->data(), jpeg->size());
+                            std::lock_guard<std::mutex> lock(mMutex);
+                            InsertLocked(key, pixels);
+                            mPending.erase(key);
+                            return pixels;
+                        })
+                        .share();
+}
+
+} // namespace SOH
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <BS_thread_pool.hpp>
+
+namespace SOH {
+
+// Decodes prerendered room backgrounds (JPEG) into the big-endian RGBA5551 layout the N64 background microcode
+// expects. Decoded images are kept in a small LRU keyed by the JPEG stream, so re-entering a room, or reloading the
+// same background resource, only costs a copy.
+class BackgroundDecoder {
+  public:
+    static BackgroundDecoder& Instance();
+
+    BackgroundDecoder();
+    ~BackgroundDecoder();
+
+    // Writes the decoded image for data to out, which may alias data. Blocks on a pending prefetch of the same image,
+    // otherwise decodes on the calling thread if the image is not cached. Returns false if the JPEG could not be
+    // decoded or does not fit in outSize.
+    bool Decode(const uint8_t* data, size_t dataSize, uint8_t* out, size_t outSize);
+
+    // Queues a decode of data on the worker thread. The bytes are copied, so the caller may modify data right away.
+    void Prefetch(const uint8_t* data, size_t dataSize);
+
+  private:
+    using Pixels = std::shared_ptr<const std::vector<uint8_t>>;
+
+    struct Entry {
+        uint64_t key;
+        Pixels pixels;
+    };
+
+    static uint64_t HashStream(const uint8_t* data, size_t dataSize);
+    static Pixels DecodeJpeg(const uint8_t* data, size_t dataSize);
+
+    Pixels FindLocked(uint64_t key);
+    void InsertLocked(uint64_t key, Pixels pixels);
+
+    std::mutex mMutex;
+    std::list<Entry> mLru; // most recently used first
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> mEntries;
+    std::unordered_map<uint64_t, std::shared_future<Pixels>> mPending;
+    std::unique_ptr<BS::thread_pool> mWorkers;
+};
+
+} // namespace SOH
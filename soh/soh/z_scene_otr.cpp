@@ -131,6 +131,13 @@ bool Scene_CommandMeshHeader(PlayState* play, SOH::ISceneCommand* cmd) {
     SOH::SetMesh* otrMesh = (SOH::SetMesh*)cmd;
     play->roomCtx.curRoom.meshHeader = (MeshHeader*)otrMesh->GetRawPointer();
 
+    // Decode prerendered backgrounds off-thread so the first draw of the room only has to copy them
+    if (otrMesh->meshHeader.base.type == 1) {
+        for (const std::string& imagePath : otrMesh->imagePaths) {
+            ResourceMgr_PrefetchBackground(imagePath.c_str());
+        }
+    }
+
     return false;
 }
 
@@ -142,6 +142,66 @@ void ArenaImpl_Unlock(Arena* arena) {
     osRecvMesg(&arena->lock, NULL, OS_MESG_BLOCK);
 }
 
+// #region SOH [General] Size class free lists
+_Static_assert(sizeof(ArenaNode) % 16 == 0, "Arena blocks have to stay 16 byte aligned");
+
+s32 ArenaImpl_GetFreeListIndex(size_t size) {
+    s32 index;
+
+    if (size <= ARENA_SMALL_BLOCK_MAX) {
+        return size >> 4;
+    }
+
+    index = (ARENA_SMALL_BLOCK_MAX >> 4) + 1;
+    for (size /= ARENA_SMALL_BLOCK_MAX * 2; size != 0 && index < ARENA_FREE_LIST_COUNT - 1; size >>= 1) {
+        index++;
+    }
+    return index;
+}
+
+// The block has to be removed again before its size changes
+void ArenaImpl_InsertFreeBlock(Arena* arena, ArenaNode* node) {
+    ArenaNode** list = &arena->freeLists[ArenaImpl_GetFreeListIndex(node->size)];
+
+    node->freePrev = NULL;
+    node->freeNext = *list;
+    if (*list != NULL) {
+        (*list)->freePrev = node;
+    }
+    *list = node;
+}
+
+void ArenaImpl_RemoveFreeBlock(Arena* arena, ArenaNode* node) {
+    if (node->freePrev != NULL) {
+        node->freePrev->freeNext = node->freeNext;
+    } else {
+        arena->freeLists[ArenaImpl_GetFreeListIndex(node->size)] = node->freeNext;
+    }
+    if (node->freeNext != NULL) {
+        node->freeNext->freePrev = node->freePrev;
+    }
+}
+
+// Free block from the smallest size class that fits. Blocks in a power of two class can be smaller than the request,
+// so only that class is searched block by block, any block of a larger class fits.
+ArenaNode* ArenaImpl_FindFreeBlock(Arena* arena, size_t size) {
+    ArenaNode* iter;
+    s32 index = ArenaImpl_GetFreeListIndex(size);
+
+    for (iter = arena->freeLists[index]; iter != NULL; iter = iter->freeNext) {
+        if (iter->size >= size) {
+            return iter;
+        }
+    }
+    for (index++; index < ARENA_FREE_LIST_COUNT; index++) {
+        if (arena->freeLists[index] != NULL) {
+            return arena->freeLists[index];
+        }
+    }
+    return NULL;
+}
+// #endregion
+
 #if OOT_DEBUG
 ArenaNode* ArenaImpl_GetNextBlock(ArenaNode* node) {
     ArenaNode* next = node->next;
@@ -214,6 +274,7 @@ void __osMallocAddBlock(Arena* arena, void* start, ptrdiff_t size) {
                 firstNode->prev = lastNode;
                 lastNode->next = firstNode;
             }
+            ArenaImpl_InsertFreeBlock(arena, firstNode); // SOH [General]
             ArenaImpl_Unlock(arena);
         }
     }
@@ -282,38 +343,36 @@ void* __osMalloc_NoLockDebug(Arena* arena, size_t size, const char* file, int li
 
     size = ALIGN16(size);
     blockSize = ALIGN16(size) + sizeof(ArenaNode);
-    iter = arena->head;
-
-    while (iter != NULL) {
-        if (iter->isFree && iter->size >= size) {
-            CHECK_FREE_BLOCK(arena, iter);
-
-            if (blockSize < iter->size) {
-                newNode = (ArenaNode*)((uintptr_t)iter + blockSize);
-                newNode->next = NODE_GET_NEXT(iter);
-                newNode->prev = iter;
-                newNode->size = iter->size - blockSize;
-                newNode->isFree = true;
-                newNode->magic = NODE_MAGIC;
-
-                iter->next = newNode;
-                iter->size = size;
-                next = NODE_GET_NEXT(newNode);
-                if (next) {
-                    next->prev = newNode;
-                }
+    // #region SOH [General] Take the block from the free lists instead of walking every block from the head
+    iter = ArenaImpl_FindFreeBlock(arena, size);
+
+    if (iter != NULL) {
+        CHECK_FREE_BLOCK(arena, iter);
+        ArenaImpl_RemoveFreeBlock(arena, iter);
+
+        if (blockSize < iter->size) {
+            newNode = (ArenaNode*)((uintptr_t)iter + blockSize);
+            newNode->next = NODE_GET_NEXT(iter);
+            newNode->prev = iter;
+            newNode->size = iter->size - blockSize;
+            newNode->isFree = true;
+            newNode->magic = NODE_MAGIC;
+
+            iter->next = newNode;
+            iter->size = size;
+            next = NODE_GET_NEXT(newNode);
+            if (next) {
+                next->prev = newNode;
             }
-
-            iter->isFree = false;
-            SET_DEBUG_INFO(iter, file, line, arena);
-            alloc = (void*)((uintptr_t)iter + sizeof(ArenaNode));
-            FILL_ALLOC_BLOCK(arena, alloc, size);
-
-            break;
+            ArenaImpl_InsertFreeBlock(arena, newNode);
         }
 
-        iter = NODE_GET_NEXT(iter);
+        iter->isFree = false;
+        SET_DEBUG_INFO(iter, file, line, arena);
+        alloc = (void*)((uintptr_t)iter + sizeof(ArenaNode));
+        FILL_ALLOC_BLOCK(arena, alloc, size);
     }
+    // #endregion
 
     return alloc;
 }
@@ -342,6 +401,7 @@ void* __osMallocRDebug(Arena* arena, size_t size, const char* file, int line) {
     while (iter != NULL) {
         if (iter->isFree && iter->size >= size) {
             CHECK_FREE_BLOCK(arena, iter);
+            ArenaImpl_RemoveFreeBlock(arena, iter); // SOH [General]
 
             blockSize = ALIGN16(size) + sizeof(ArenaNode);
             if (blockSize < iter->size) {
@@ -357,6 +417,7 @@ void* __osMallocRDebug(Arena* arena, size_t size, const char* file, int line) {
                 if (next) {
                     next->prev = newNode;
                 }
+                ArenaImpl_InsertFreeBlock(arena, iter); // SOH [General]
                 iter = newNode;
             }
 
@@ -386,38 +447,36 @@ void* __osMalloc_NoLock(Arena* arena, size_t size) {
 
     size = ALIGN16(size);
     blockSize = ALIGN16(size) + sizeof(ArenaNode);
-    iter = arena->head;
-
-    while (iter != NULL) {
-        if (iter->isFree && iter->size >= size) {
-            CHECK_FREE_BLOCK(arena, iter);
-
-            if (blockSize < iter->size) {
-                newNode = (ArenaNode*)((uintptr_t)iter + blockSize);
-                newNode->next = NODE_GET_NEXT(iter);
-                newNode->prev = iter;
-                newNode->size = iter->size - blockSize;
-                newNode->isFree = true;
-                newNode->magic = NODE_MAGIC;
-
-                iter->next = newNode;
-                iter->size = size;
-                next = NODE_GET_NEXT(newNode);
-                if (next) {
-                    next->prev = newNode;
-                }
+    // #region SOH [General] Take the block from the free lists instead of walking every block from the head
+    iter = ArenaImpl_FindFreeBlock(arena, size);
+
+    if (iter != NULL) {
+        CHECK_FREE_BLOCK(arena, iter);
+        ArenaImpl_RemoveFreeBlock(arena, iter);
+
+        if (blockSize < iter->size) {
+            newNode = (ArenaNode*)((uintptr_t)iter + blockSize);
+            newNode->next = NODE_GET_NEXT(iter);
+            newNode->prev = iter;
+            newNode->size = iter->size - blockSize;
+            newNode->isFree = true;
+            newNode->magic = NODE_MAGIC;
+
+            iter->next = newNode;
+            iter->size = size;
+            next = NODE_GET_NEXT(newNode);
+            if (next) {
+                next->prev = newNode;
             }
-
-            iter->isFree = false;
-            SET_DEBUG_INFO(iter, NULL, 0, arena);
-            alloc = (void*)((uintptr_t)iter + sizeof(ArenaNode));
-            FILL_ALLOC_BLOCK(arena, alloc, size);
-
-            break;
+            ArenaImpl_InsertFreeBlock(arena, newNode);
         }
 
-        iter = NODE_GET_NEXT(iter);
+        iter->isFree = false;
+        SET_DEBUG_INFO(iter, NULL, 0, arena);
+        alloc = (void*)((uintptr_t)iter + sizeof(ArenaNode));
+        FILL_ALLOC_BLOCK(arena, alloc, size);
     }
+    // #endregion
 
     CHECK_ALLOC_FAILURE(arena, alloc);
 
@@ -450,6 +509,7 @@ void* __osMallocR(Arena* arena, size_t size) {
     while (iter != NULL) {
         if (iter->isFree && iter->size >= size) {
             CHECK_FREE_BLOCK(arena, iter);
+            ArenaImpl_RemoveFreeBlock(arena, iter); // SOH [General]
 
             if (blockSize < iter->size) {
                 allocNode = (ArenaNode*)((uintptr_t)iter + (iter->size - size));
@@ -466,6 +526,7 @@ void* __osMallocR(Arena* arena, size_t size) {
                 if (next) {
                     next->prev = newNode;
                 }
+                ArenaImpl_InsertFreeBlock(arena, iter); // SOH [General]
                 iter = newNode;
             }
 
@@ -528,6 +589,7 @@ void __osFree_NoLock(Arena* arena, void* ptr) {
             newNext->prev = node;
         }
 
+        ArenaImpl_RemoveFreeBlock(arena, next); // SOH [General]
         node->size += next->size + sizeof(ArenaNode);
         FILL_FREE_BLOCK_HEADER(arena, next);
         node->next = newNext;
@@ -538,9 +600,13 @@ void __osFree_NoLock(Arena* arena, void* ptr) {
         if (next) {
             next->prev = prev;
         }
+        ArenaImpl_RemoveFreeBlock(arena, prev); // SOH [General]
         prev->next = next;
         prev->size += node->size + sizeof(ArenaNode);
         FILL_FREE_BLOCK_HEADER(arena, node);
+        ArenaImpl_InsertFreeBlock(arena, prev); // SOH [General]
+    } else {
+        ArenaImpl_InsertFreeBlock(arena, node); // SOH [General]
     }
 }
 
@@ -596,6 +662,7 @@ void __osFree_NoLockDebug(Arena* arena, void* ptr, const char* file, int line) {
             newNext->prev = node;
         }
 
+        ArenaImpl_RemoveFreeBlock(arena, next); // SOH [General]
         node->size += next->size + sizeof(ArenaNode);
         FILL_FREE_BLOCK_HEADER(arena, next);
         node->next = newNext;
@@ -606,9 +673,13 @@ void __osFree_NoLockDebug(Arena* arena, void* ptr, const char* file, int line) {
         if (next != NULL) {
             next->prev = prev;
         }
+        ArenaImpl_RemoveFreeBlock(arena, prev); // SOH [General]
         prev->next = next;
         prev->size += node->size + sizeof(ArenaNode);
         FILL_FREE_BLOCK_HEADER(arena, node);
+        ArenaImpl_InsertFreeBlock(arena, prev); // SOH [General]
+    } else {
+        ArenaImpl_InsertFreeBlock(arena, node); // SOH [General]
     }
 }
 
@@ -654,6 +725,7 @@ void* __osRealloc(Arena* arena, void* ptr, size_t newSize) {
                 next->size >= sizeDiff) {
                 // "Merge because there is a free block after the current memory block"
                 osSyncPrintf("現メモリブロックの後ろにフリーブロックがあるので結合します\n");
+                ArenaImpl_RemoveFreeBlock(arena, next); // SOH [General]
                 next->size -= sizeDiff;
                 overNext = NODE_GET_NEXT(next);
                 newNext = (ArenaNode*)((uintptr_t)next + sizeDiff);
@@ -663,6 +735,7 @@ void* __osRealloc(Arena* arena, void* ptr, size_t newSize) {
                 node->next = newNext;
                 node->size = newSize;
                 memmove(node->next, next, sizeof(ArenaNode));
+                ArenaImpl_InsertFreeBlock(arena, node->next); // SOH [General]
             } else {
                 // "Allocate a new memory block and move the contents"
                 osSyncPrintf("新たにメモリブロックを確保して内容を移動します\n");
@@ -680,6 +753,7 @@ void* __osRealloc(Arena* arena, void* ptr, size_t newSize) {
                 // "Increased free block behind current memory block"
                 osSyncPrintf("現メモリブロックの後ろのフリーブロックを大きくしました\n");
                 newNext2 = (ArenaNode*)((uintptr_t)node + blockSize);
+                ArenaImpl_RemoveFreeBlock(arena, next2); // SOH [General]
                 localCopy = *next2;
                 *newNext2 = localCopy;
                 newNext2->size += node->size - newSize;
@@ -689,6 +763,7 @@ void* __osRealloc(Arena* arena, void* ptr, size_t newSize) {
                 if (overNext2 != NULL) {
                     overNext2->prev = newNext2;
                 }
+                ArenaImpl_InsertFreeBlock(arena, newNext2); // SOH [General]
             } else if (newSize + sizeof(ArenaNode) < node->size) {
                 blockSize = ALIGN16(newSize) + sizeof(ArenaNode);
                 // "Generated because there is no free block after the current memory block"
@@ -705,6 +780,7 @@ void* __osRealloc(Arena* arena, void* ptr, size_t newSize) {
                 if (overNext2 != NULL) {
                     overNext2->prev = newNext2;
                 }
+                ArenaImpl_InsertFreeBlock(arena, newNext2); // SOH [General]
             } else {
                 // "There is no room to generate free blocks"
                 osSyncPrintf("フリーブロック生成するだけの空きがありません\n");
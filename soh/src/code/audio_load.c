@@ -1434,6 +1434,9 @@ void AudioLoad_Init(void* heap, size_t heapSize) {
 
     free(customSeqList);
 
+    // Sequences may already be replaced by the custom sequences that were just added
+    AudioCollection_RebuildReplacementTable();
+
     numFonts = fntListSize;
 
     // #end region
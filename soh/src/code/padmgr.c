@@ -3,6 +3,7 @@
 #include <string.h>
 
 #include "soh/Enhancements/game-interactor/GameInteractor.h"
+#include "soh/Enhancements/debugger/replayHarness.h"
 #include "soh/Enhancements/controls/Mouse.h"
 #include "soh/OTRGlobals.h"
 #include "soh/ResourceManagerHelpers.h"
@@ -317,6 +318,7 @@ void PadMgr_HandleRetraceMsg(PadMgr* padMgr) {
     }
     osRecvMesg(queue, NULL, OS_MESG_BLOCK);
     osContGetReadData(padMgr->pads);
+    ReplayHarness_ProcessPad(&padMgr->pads[0]); // SOH [Debug] Input replay
 
     Mouse_UpdateAll();
 
@@ -17,6 +17,8 @@
 #include "soh/Enhancements/nametag.h"
 
 #include "soh/ActorDB.h"
+#include "soh/ActorGrid.h"
+#include "soh/CVarHandle.h"
 #include "soh/OTRGlobals.h"
 
 #include <string.h>
@@ -1240,6 +1242,7 @@ void Actor_SetObjectDependency(PlayState* play, Actor* actor) {
 
 void Actor_Init(Actor* actor, PlayState* play) {
     Actor_SetWorldToHome(actor);
+    ActorGrid_Rebin(&play->actorCtx, actor); // SOH [Port] Was binned at the zeroed world position on insertion
     Actor_SetShapeRotToWorld(actor);
     Actor_SetFocus(actor, 0.0f);
     Math_Vec3f_Copy(&actor->prevPos, &actor->world.pos);
@@ -2537,6 +2540,7 @@ void func_800304DC(PlayState* play, ActorContext* actorCtx, ActorEntry* actorEnt
     savedSceneFlags = &gSaveContext.sceneFlags[play->sceneNum];
 
     memset(actorCtx, 0, sizeof(*actorCtx));
+    ActorGrid_Init(actorCtx);
 
     Matrix_MtxFCopy(&play->billboardMtxF, &gMtxFClear);
     Matrix_MtxFCopy(&play->viewProjectionMtxF, &gMtxFClear);
@@ -2603,6 +2607,10 @@ void Actor_UpdateAll(PlayState* play, ActorContext* actorCtx) {
         actorCtx->unk_02--;
     }
 
+    // #region SOH [Port] Pick up anything moved since the last update (cutscenes, bg actor carrying, ...)
+    ActorGrid_RebinAll(actorCtx);
+    // #endregion
+
     if (KREG(0) == -100) {
         refActor = &GET_PLAYER(play)->actor;
         KREG(0) = 0;
@@ -2644,6 +2652,7 @@ void Actor_UpdateAll(PlayState* play, ActorContext* actorCtx) {
                         actor->init = NULL;
                         Actor_Kill(actor);
                     }
+                    ActorGrid_Rebin(actorCtx, actor);
                 }
                 actor = actor->next;
             } else if (!Object_IsLoaded(&play->objectCtx, actor->objBankIndex)) {
@@ -2691,6 +2700,7 @@ void Actor_UpdateAll(PlayState* play, ActorContext* actorCtx) {
                         GameInteractor_ExecuteOnActorUpdate(actor);
                     }
                     func_8003F8EC(play, &play->colCtx.dyna, actor);
+                    ActorGrid_Rebin(actorCtx, actor);
                 }
 
                 CollisionCheck_ResetDamage(&actor->colChkInfo);
@@ -2722,6 +2732,7 @@ void Actor_UpdateAll(PlayState* play, ActorContext* actorCtx) {
     func_8002C7BC(&actorCtx->targetCtx, player, actor, play);
     TitleCard_Update(play, &actorCtx->titleCtx);
     DynaPoly_UpdateBgActorTransforms(play, &play->colCtx.dyna);
+    ActorGrid_RebinAll(actorCtx);
 }
 
 void Actor_FaultPrint(Actor* actor, char* command) {
@@ -2963,6 +2974,12 @@ s32 func_800314D4(PlayState* play, Actor* actor, Vec3f* arg2, f32 arg3) {
     return false;
 }
 
+// Read once per actor per frame, so resolved once through CVarHandle
+static CVarHandle sDisableDrawDistanceCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("DisableDrawDistance"));
+static CVarHandle sWidescreenActorCullingCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("WidescreenActorCulling"));
+static CVarHandle sExtendedCullingExcludeGlitchActorsCVar =
+    CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("ExtendedCullingExcludeGlitchActors"));
+
 // #region SOH [Enhancements] Allows us to increase the draw and update distance independently,
 // mostly a modified version of the function above and additional tweaks for some specfic actors
 s32 Ship_CalcShouldDrawAndUpdate(PlayState* play, Actor* actor, Vec3f* projectedPos, f32 projectedW, bool* shouldDraw,
@@ -2981,7 +2998,7 @@ s32 Ship_CalcShouldDrawAndUpdate(PlayState* play, Actor* actor, Vec3f* projected
         return false;
     }
 
-    s32 multiplier = CVarGetInteger(CVAR_ENHANCEMENT("DisableDrawDistance"), 1);
+    s32 multiplier = CVarHandle_GetInteger(&sDisableDrawDistanceCVar, 1);
     multiplier = MAX(multiplier, 1);
 
     // Some actors have a really short forward value, so we need to add to it before the multiplier to increase the
@@ -2994,7 +3011,7 @@ s32 Ship_CalcShouldDrawAndUpdate(PlayState* play, Actor* actor, Vec3f* projected
 
         f32 ratioAdjusted = 1.0f;
 
-        if (CVarGetInteger(CVAR_ENHANCEMENT("WidescreenActorCulling"), 0)) {
+        if (CVarHandle_GetInteger(&sWidescreenActorCullingCVar, 0)) {
             f32 originalAspectRatio = 4.0f / 3.0f;
             f32 currentAspectRatio = OTRGetAspectRatio();
             ratioAdjusted = MAX(currentAspectRatio / originalAspectRatio, 1.0f);
@@ -3004,7 +3021,7 @@ s32 Ship_CalcShouldDrawAndUpdate(PlayState* play, Actor* actor, Vec3f* projected
             (((projectedPos->y + actor->uncullZoneDownward) * clampedProjectedW) > -1.0f) &&
             (((projectedPos->y - actor->uncullZoneScale) * clampedProjectedW) < 1.0f)) {
 
-            if (CVarGetInteger(CVAR_ENHANCEMENT("ExtendedCullingExcludeGlitchActors"), 0)) {
+            if (CVarHandle_GetInteger(&sExtendedCullingExcludeGlitchActorsCVar, 0)) {
                 // These actors are safe to draw without impacting glitches
                 if ((actor->id == ACTOR_OBJ_BOMBIWA || actor->id == ACTOR_OBJ_HAMISHI ||
                      actor->id == ACTOR_EN_ISHI) || // Boulders (hookshot through collision)
@@ -3076,8 +3093,8 @@ void func_800315AC(PlayState* play, ActorContext* actorCtx) {
             bool shipShouldDraw = false;
             bool shipShouldUpdate = false;
             if ((HREG(64) != 1) || ((HREG(65) != -1) && (HREG(65) != HREG(66))) || (HREG(70) == 0)) {
-                if (CVarGetInteger(CVAR_ENHANCEMENT("DisableDrawDistance"), 1) > 1 ||
-                    CVarGetInteger(CVAR_ENHANCEMENT("WidescreenActorCulling"), 0)) {
+                if (CVarHandle_GetInteger(&sDisableDrawDistanceCVar, 1) > 1 ||
+                    CVarHandle_GetInteger(&sWidescreenActorCullingCVar, 0)) {
                     Ship_CalcShouldDrawAndUpdate(play, actor, &actor->projectedPos, actor->projectedW, &shipShouldDraw,
                                                  &shipShouldUpdate);
 
@@ -3258,6 +3275,8 @@ void Actor_AddToCategory(ActorContext* actorCtx, Actor* actorToAdd, u8 actorCate
 
     actorCtx->actorLists[actorCategory].head = actorToAdd;
     actorToAdd->next = prevHead;
+
+    ActorGrid_Insert(actorCtx, actorToAdd);
 }
 
 /**
@@ -3285,6 +3304,8 @@ Actor* Actor_RemoveFromCategory(PlayState* play, ActorContext* actorCtx, Actor*
     actorToRemove->next = NULL;
     actorToRemove->prev = NULL;
 
+    ActorGrid_Remove(actorCtx, actorToRemove);
+
     if ((actorToRemove->room == play->roomCtx.curRoom.num) && (actorToRemove->category == ACTORCAT_ENEMY) &&
         (actorCtx->actorLists[ACTORCAT_ENEMY].length == 0)) {
         Flags_SetTempClear(play, play->roomCtx.curRoom.num);
@@ -3417,6 +3438,8 @@ Actor* Actor_Spawn(ActorContext* actorCtx, PlayState* play, s16 actorId, f32 pos
     Actor_Init(actor, play);
     gSegments[6] = temp;
 
+    ActorGrid_Rebin(actorCtx, actor);
+
     GameInteractor_ExecuteOnActorSpawn(actor);
 
     return actor;
@@ -4701,6 +4724,12 @@ u8 func_800353E8(PlayState* play) {
  * specified category rather than a specific ID.
  */
 Actor* Actor_FindNearby(PlayState* play, Actor* refActor, s16 actorId, u8 actorCategory, f32 range) {
+    // #region SOH [Port] Only look at actors in grid cells around refActor
+    if (range <= ACTOR_GRID_MAX_QUERY_RANGE) {
+        return ActorGrid_FindFirst(&play->actorCtx, &refActor->world.pos, range, actorId, actorCategory, refActor);
+    }
+    // #endregion
+
     Actor* actor = play->actorCtx.actorLists[actorCategory].head;
 
     while (actor != NULL) {
@@ -3,10 +3,16 @@
 
 #include "soh/OTRGlobals.h"
 #include "soh/ResourceManagerHelpers.h"
+#include "soh/CVarHandle.h"
 #include <assert.h>
 
 #define SS_NULL 0xFFFF
 
+// Read on every wall check and surface query
+static CVarHandle sNoClipCVar = CVAR_HANDLE_INIT(CVAR_CHEAT("NoClip"));
+static CVarHandle sClimbEverythingCVar = CVAR_HANDLE_INIT(CVAR_CHEAT("ClimbEverything"));
+static CVarHandle sHookshotEverythingCVar = CVAR_HANDLE_INIT(CVAR_CHEAT("HookshotEverything"));
+
 // bccFlags
 #define BGCHECK_CHECK_WALL (1 << 0)
 #define BGCHECK_CHECK_FLOOR (1 << 1)
@@ -1902,7 +1908,7 @@ s32 BgCheck_CheckWallImpl(CollisionContext* colCtx, u16 xpFlags, Vec3f* posResul
     s32 bgId2;
     f32 nx, ny, nz; // unit normal of polygon
 
-    if (CVarGetInteger(CVAR_CHEAT("NoClip"), 0) && actor != NULL && actor->id == ACTOR_PLAYER) {
+    if (CVarHandle_GetInteger(&sNoClipCVar, 0) && actor != NULL && actor->id == ACTOR_PLAYER) {
         return false;
     }
 
@@ -4021,7 +4027,7 @@ u32 func_80041D94(CollisionContext* colCtx, CollisionPoly* poly, s32 bgId) {
  * SurfaceType Get Wall Flags
  */
 s32 func_80041DB8(CollisionContext* colCtx, CollisionPoly* poly, s32 bgId) {
-    if (CVarGetInteger(CVAR_CHEAT("ClimbEverything"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sClimbEverythingCVar, 0) != 0) {
         return (1 << 3) | D_80119D90[func_80041D94(colCtx, poly, bgId)];
     } else {
         return D_80119D90[func_80041D94(colCtx, poly, bgId)];
@@ -4118,7 +4124,7 @@ u32 SurfaceType_GetEcho(CollisionContext* colCtx, CollisionPoly* poly, s32 bgId)
  * SurfaceType Is Hookshot Surface
  */
 u32 SurfaceType_IsHookshotSurface(CollisionContext* colCtx, CollisionPoly* poly, s32 bgId) {
-    return CVarGetInteger(CVAR_CHEAT("HookshotEverything"), 0) || SurfaceType_GetData(colCtx, poly, bgId, 1) >> 17 & 1;
+    return CVarHandle_GetInteger(&sHookshotEverythingCVar, 0) || SurfaceType_GetData(colCtx, poly, bgId, 1) >> 17 & 1;
 }
 
 /**
@@ -8,6 +8,7 @@
 
 #include "soh/frame_interpolation.h"
 #include "soh/Enhancements/controls/Mouse.h"
+#include "soh/CVarHandle.h"
 
 s16 Camera_ChangeSettingFlags(Camera* camera, s16 setting, s16 flags);
 s32 Camera_ChangeModeFlags(Camera* camera, s16 mode, u8 flags);
@@ -208,10 +209,95 @@ Vec3f* Camera_Vec3fTranslateByUnitVector(Vec3f* dest, Vec3f* src, Vec3f* unitVec
     return dest;
 }
 
+// #region SOH [Enhancement] Camera collision query cache
+/**
+ * The camera modes repeat the same collision queries several times during one Camera_Update, and no collision moves
+ * while the camera updates, so the results are remembered until Camera_Update returns. Keys compare the exact bits of
+ * the query, so a cached result is always the one the query would have returned.
+ */
+#define CAM_COL_CACHE_SIZE 16
+
+typedef struct {
+    Vec3f from;
+    Vec3f to;
+    CamColChk result;
+    s32 ret;
+} CamColCacheLine;
+
+typedef struct {
+    Vec3f pos;
+    f32 playerGroundY;
+    Vec3f norm;
+    Vec3f posResult;
+    s32 bgId;
+    f32 floorY;
+} CamColCacheFloor;
+
+typedef struct {
+    u8 active;
+    u8 verify;
+    u32 lineCount;
+    u32 floorCount;
+    u32 floorLayerCount;
+    CamColCacheLine line[CAM_COL_CACHE_SIZE];
+    CamColCacheFloor floor[CAM_COL_CACHE_SIZE];
+    CamColCacheFloor floorLayer[CAM_COL_CACHE_SIZE];
+} CamColCache;
+
+static CamColCache sCamColCache;
+// Read on every Camera_Update, so resolved once through CVarHandle
+static CVarHandle sCamColCacheVerifyCVar = CVAR_HANDLE_INIT(CVAR_DEVELOPER_TOOLS("CameraCollisionCacheVerify"));
+
+static void Camera_ColCacheBegin(void) {
+    sCamColCache.active = true;
+    sCamColCache.verify = CVarHandle_GetInteger(&sCamColCacheVerifyCVar, 0);
+    sCamColCache.lineCount = 0;
+    sCamColCache.floorCount = 0;
+    sCamColCache.floorLayerCount = 0;
+}
+
+static void Camera_ColCacheEnd(void) {
+    sCamColCache.active = false;
+}
+
+static CamColCacheLine* Camera_ColCacheFindLine(Vec3f* from, Vec3f* to) {
+    u32 count = sCamColCache.lineCount < CAM_COL_CACHE_SIZE ? sCamColCache.lineCount : CAM_COL_CACHE_SIZE;
+    u32 i;
+
+    for (i = 0; i < count; i++) {
+        CamColCacheLine* entry = &sCamColCache.line[i];
+
+        if (memcmp(&entry->from, from, sizeof(Vec3f)) == 0 && memcmp(&entry->to, to, sizeof(Vec3f)) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static CamColCacheFloor* Camera_ColCacheFindFloor(CamColCacheFloor* entries, u32 entryCount, Vec3f* pos,
+                                                  f32 playerGroundY) {
+    u32 count = entryCount < CAM_COL_CACHE_SIZE ? entryCount : CAM_COL_CACHE_SIZE;
+    u32 i;
+
+    for (i = 0; i < count; i++) {
+        if (memcmp(&entries[i].pos, pos, sizeof(Vec3f)) == 0 &&
+            memcmp(&entries[i].playerGroundY, &playerGroundY, sizeof(f32)) == 0) {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+static void Camera_ColCacheReportMismatch(const char* query, Vec3f* pos) {
+    osSyncPrintf(VT_COL(RED, WHITE) "camera: %s cache mismatch at (%f, %f, %f)\n" VT_RST, query, pos->x, pos->y,
+                 pos->z);
+}
+// #endregion
+
 /**
  * Detects the collision poly between `from` and `to`, places collision info in `to`
  */
-s32 Camera_BGCheckInfo(Camera* camera, Vec3f* from, CamColChk* to) {
+static s32 Camera_BGCheckInfoImpl(Camera* camera, Vec3f* from, CamColChk* to) {
     CollisionContext* colCtx = &camera->play->colCtx;
     Vec3f toNewPos;
     Vec3f toPoint;
@@ -261,6 +347,44 @@ s32 Camera_BGCheckInfo(Camera* camera, Vec3f* from, CamColChk* to) {
     return floorBgId + 1;
 }
 
+s32 Camera_BGCheckInfo(Camera* camera, Vec3f* from, CamColChk* to) {
+    CamColCacheLine* entry;
+    CamColChk fresh;
+    s32 ret;
+
+    if (!sCamColCache.active) {
+        return Camera_BGCheckInfoImpl(camera, from, to);
+    }
+
+    entry = Camera_ColCacheFindLine(from, &to->pos);
+    if (entry != NULL) {
+        if (sCamColCache.verify) {
+            fresh.pos = to->pos;
+            ret = Camera_BGCheckInfoImpl(camera, from, &fresh);
+            if (ret != entry->ret || fresh.poly != entry->result.poly || fresh.bgId != entry->result.bgId ||
+                memcmp(&fresh.pos, &entry->result.pos, sizeof(Vec3f)) != 0 ||
+                memcmp(&fresh.norm, &entry->result.norm, sizeof(Vec3f)) != 0) {
+                Camera_ColCacheReportMismatch("BGCheckInfo", &to->pos);
+                entry->result = fresh;
+                entry->ret = ret;
+            }
+        }
+        // sphNorm isn't written by the query, it keeps the caller's value
+        to->pos = entry->result.pos;
+        to->norm = entry->result.norm;
+        to->poly = entry->result.poly;
+        to->bgId = entry->result.bgId;
+        return entry->ret;
+    }
+
+    entry = &sCamColCache.line[sCamColCache.lineCount++ % CAM_COL_CACHE_SIZE];
+    entry->from = *from;
+    entry->to = to->pos;
+    entry->ret = Camera_BGCheckInfoImpl(camera, from, to);
+    entry->result = *to;
+    return entry->ret;
+}
+
 /**
  * Detects if there is collision between `from` and `to`
  */
@@ -376,7 +500,7 @@ s32 Camera_CheckOOB(Camera* camera, Vec3f* from, Vec3f* to) {
  * Gets the floor position underneath `chkPos`, and returns the normal of the floor to `floorNorm`,
  * and bgId to `bgId`.  If no floor is found, then the normal is a flat surface pointing upwards.
  */
-f32 Camera_GetFloorYNorm(Camera* camera, Vec3f* floorNorm, Vec3f* chkPos, s32* bgId) {
+static f32 Camera_GetFloorYNormImpl(Camera* camera, Vec3f* floorNorm, Vec3f* chkPos, s32* bgId) {
     s32 pad;
     CollisionPoly* floorPoly;
     f32 floorY = BgCheck_EntityRaycastFloor3(&camera->play->colCtx, &floorPoly, bgId, chkPos);
@@ -395,6 +519,42 @@ f32 Camera_GetFloorYNorm(Camera* camera, Vec3f* floorNorm, Vec3f* chkPos, s32* b
     return floorY;
 }
 
+f32 Camera_GetFloorYNorm(Camera* camera, Vec3f* floorNorm, Vec3f* chkPos, s32* bgId) {
+    CamColCacheFloor* entry;
+    Vec3f freshNorm;
+    s32 freshBgId;
+    f32 floorY;
+
+    if (!sCamColCache.active) {
+        return Camera_GetFloorYNormImpl(camera, floorNorm, chkPos, bgId);
+    }
+
+    entry = Camera_ColCacheFindFloor(sCamColCache.floor, sCamColCache.floorCount, chkPos, 0.0f);
+    if (entry != NULL) {
+        if (sCamColCache.verify) {
+            floorY = Camera_GetFloorYNormImpl(camera, &freshNorm, chkPos, &freshBgId);
+            if (floorY != entry->floorY || freshBgId != entry->bgId ||
+                memcmp(&freshNorm, &entry->norm, sizeof(Vec3f)) != 0) {
+                Camera_ColCacheReportMismatch("GetFloorYNorm", chkPos);
+                entry->norm = freshNorm;
+                entry->bgId = freshBgId;
+                entry->floorY = floorY;
+            }
+        }
+        *floorNorm = entry->norm;
+        *bgId = entry->bgId;
+        return entry->floorY;
+    }
+
+    entry = &sCamColCache.floor[sCamColCache.floorCount++ % CAM_COL_CACHE_SIZE];
+    entry->pos = *chkPos;
+    entry->playerGroundY = 0.0f;
+    entry->floorY = Camera_GetFloorYNormImpl(camera, floorNorm, chkPos, bgId);
+    entry->norm = *floorNorm;
+    entry->bgId = *bgId;
+    return entry->floorY;
+}
+
 /**
  * Gets the position of the floor from `pos`
  */
@@ -413,7 +573,7 @@ f32 Camera_GetFloorY(Camera* camera, Vec3f* pos) {
  * Gets the position of the floor from `pos`, and if the floor is considered not solid,
  * it checks the next floor below that up to 3 times.  Returns the normal of the floor into `norm`
  */
-f32 Camera_GetFloorYLayer(Camera* camera, Vec3f* norm, Vec3f* pos, s32* bgId) {
+static f32 Camera_GetFloorYLayerImpl(Camera* camera, Vec3f* norm, Vec3f* pos, s32* bgId) {
     CollisionPoly* floorPoly;
     CollisionContext* colCtx = &camera->play->colCtx;
     f32 floorY;
@@ -446,6 +606,49 @@ f32 Camera_GetFloorYLayer(Camera* camera, Vec3f* norm, Vec3f* pos, s32* bgId) {
     return floorY;
 }
 
+f32 Camera_GetFloorYLayer(Camera* camera, Vec3f* norm, Vec3f* pos, s32* bgId) {
+    CamColCacheFloor* entry;
+    Vec3f freshNorm;
+    Vec3f freshPos;
+    s32 freshBgId;
+    f32 floorY;
+
+    if (!sCamColCache.active) {
+        return Camera_GetFloorYLayerImpl(camera, norm, pos, bgId);
+    }
+
+    // The result depends on the player's ground height as well as on `pos`
+    entry = Camera_ColCacheFindFloor(sCamColCache.floorLayer, sCamColCache.floorLayerCount, pos, camera->playerGroundY);
+    if (entry != NULL) {
+        if (sCamColCache.verify) {
+            freshPos = *pos;
+            floorY = Camera_GetFloorYLayerImpl(camera, &freshNorm, &freshPos, &freshBgId);
+            if (floorY != entry->floorY || freshBgId != entry->bgId ||
+                memcmp(&freshNorm, &entry->norm, sizeof(Vec3f)) != 0 ||
+                memcmp(&freshPos, &entry->posResult, sizeof(Vec3f)) != 0) {
+                Camera_ColCacheReportMismatch("GetFloorYLayer", pos);
+                entry->norm = freshNorm;
+                entry->posResult = freshPos;
+                entry->bgId = freshBgId;
+                entry->floorY = floorY;
+            }
+        }
+        *norm = entry->norm;
+        *pos = entry->posResult;
+        *bgId = entry->bgId;
+        return entry->floorY;
+    }
+
+    entry = &sCamColCache.floorLayer[sCamColCache.floorLayerCount++ % CAM_COL_CACHE_SIZE];
+    entry->pos = *pos;
+    entry->playerGroundY = camera->playerGroundY;
+    entry->floorY = Camera_GetFloorYLayerImpl(camera, norm, pos, bgId);
+    entry->norm = *norm;
+    entry->posResult = *pos;
+    entry->bgId = *bgId;
+    return entry->floorY;
+}
+
 /**
  * Returns the CameraSettingType of the camera at index `camDataIdx`
  */
@@ -7485,7 +7688,7 @@ void Camera_UpdateDistortion(Camera* camera) {
 }
 
 s32 sOOBTimer = 0;
-Vec3s Camera_Update(Camera* camera) {
+static Vec3s Camera_UpdateImpl(Camera* camera) {
     Vec3f viewAt;
     Vec3f viewEye;
     Vec3f viewUp;
@@ -7735,6 +7938,17 @@ Vec3s Camera_Update(Camera* camera) {
     return camera->inputDir;
 }
 
+Vec3s Camera_Update(Camera* camera) {
+    Vec3s inputDir;
+
+    // SOH [Enhancement] Collision queries are cached for the duration of the update
+    Camera_ColCacheBegin();
+    inputDir = Camera_UpdateImpl(camera);
+    Camera_ColCacheEnd();
+
+    return inputDir;
+}
+
 /**
  * When the camera's timer is 0, change the camera to its parent
  */
@@ -3,6 +3,7 @@
 #include "overlays/effects/ovl_Effect_Ss_HitMark/z_eff_ss_hitmark.h"
 #include "soh/Enhancements/game-interactor/GameInteractor.h"
 #include "soh/Enhancements/Fuse/Hooks/FuseHooks_Objects.h"
+#include "soh/Enhancements/debugger/frameProfiler.h"
 #include <assert.h>
 
 typedef s32 (*ColChkResetFunc)(PlayState*, Collider*);
@@ -2648,6 +2649,7 @@ void CollisionCheck_AT(PlayState* play, CollisionCheckContext* colChkCtx) {
     if (colChkCtx->colATCount == 0 || colChkCtx->colACCount == 0) {
         return;
     }
+    FRAME_PROFILER_BEGIN("CollisionCheck_AC");
     for (col = colChkCtx->colAT; col < colChkCtx->colAT + colChkCtx->colATCount; col++) {
         Collider* colAT = *col;
 
@@ -2658,6 +2660,7 @@ void CollisionCheck_AT(PlayState* play, CollisionCheckContext* colChkCtx) {
             CollisionCheck_AC(play, colChkCtx, colAT);
         }
     }
+    FRAME_PROFILER_END();
     CollisionCheck_SetHitEffects(play, colChkCtx);
 }
 
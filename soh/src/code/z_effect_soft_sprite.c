@@ -3,9 +3,73 @@
 
 #include "soh/frame_interpolation.h"
 #include <assert.h>
+#include <string.h>
 
 EffectSsInfo sEffectSsInfo = { 0 }; // "EffectSS2Info"
 
+// #region SOH [Port] Slot search trees
+// The slot whose update, draw or init callback is running, its tree leaves are refreshed before any nested search
+static s32 sEffectSsActiveIndex = -1;
+
+/**
+ * A slot can be evicted by an effect of priority p when its key is at least 2p + 1: either its priority is lower
+ * (a higher value), or it is equal and flag 0 is not set.
+ */
+static u16 EffectSs_GetEvictKey(EffectSs* effectSs) {
+    return (effectSs->priority * 2) + !(effectSs->flags & 1);
+}
+
+static void EffectSs_TreeSet(u16* tree, s32 index, u16 value) {
+    s32 node = sEffectSsInfo.treeLeafCount + index;
+
+    if (tree[node] == value) {
+        return;
+    }
+    tree[node] = value;
+
+    for (node >>= 1; node > 0; node >>= 1) {
+        tree[node] = (tree[node * 2] > tree[node * 2 + 1]) ? tree[node * 2] : tree[node * 2 + 1];
+    }
+}
+
+// First index in [lo, hi) whose leaf is at least threshold, or -1
+static s32 EffectSs_TreeFind(u16* tree, s32 node, s32 nodeLo, s32 nodeHi, s32 lo, s32 hi, s32 threshold) {
+    s32 mid;
+    s32 found;
+
+    if ((nodeHi <= lo) || (hi <= nodeLo) || (tree[node] < threshold)) {
+        return -1;
+    }
+    if (nodeHi - nodeLo == 1) {
+        return nodeLo;
+    }
+
+    mid = (nodeLo + nodeHi) / 2;
+    found = EffectSs_TreeFind(tree, node * 2, nodeLo, mid, lo, hi, threshold);
+    if (found < 0) {
+        found = EffectSs_TreeFind(tree, node * 2 + 1, mid, nodeHi, lo, hi, threshold);
+    }
+    return found;
+}
+
+// First index at or after start, wrapping around the table, whose leaf is at least threshold, or -1
+static s32 EffectSs_TreeFindFrom(u16* tree, s32 start, s32 threshold) {
+    s32 found = EffectSs_TreeFind(tree, 1, 0, sEffectSsInfo.treeLeafCount, start, sEffectSsInfo.tableSize, threshold);
+
+    if (found < 0) {
+        found = EffectSs_TreeFind(tree, 1, 0, sEffectSsInfo.treeLeafCount, 0, start, threshold);
+    }
+    return found;
+}
+
+static void EffectSs_SyncSlot(s32 index) {
+    EffectSs* effectSs = &sEffectSsInfo.table[index];
+
+    EffectSs_TreeSet(sEffectSsInfo.freeTree, index, effectSs->life == -1);
+    EffectSs_TreeSet(sEffectSsInfo.evictTree, index, EffectSs_GetEvictKey(effectSs));
+}
+// #endregion
+
 void EffectSs_InitInfo(PlayState* play, s32 tableSize) {
     u32 i;
     EffectSs* effectSs;
@@ -28,6 +92,22 @@ void EffectSs_InitInfo(PlayState* play, s32 tableSize) {
         EffectSs_Reset(effectSs);
     }
 
+    // #region SOH [Port] Slot search trees
+    for (sEffectSsInfo.treeLeafCount = 1; sEffectSsInfo.treeLeafCount < tableSize; sEffectSsInfo.treeLeafCount *= 2) {}
+
+    sEffectSsInfo.freeTree = GAMESTATE_ALLOC_MC(&play->state, sEffectSsInfo.treeLeafCount * 2 * sizeof(u16));
+    sEffectSsInfo.evictTree = GAMESTATE_ALLOC_MC(&play->state, sEffectSsInfo.treeLeafCount * 2 * sizeof(u16));
+    assert(sEffectSsInfo.freeTree != NULL && sEffectSsInfo.evictTree != NULL);
+
+    // Leaves past the end of the table stay 0, which no search threshold matches
+    memset(sEffectSsInfo.freeTree, 0, sEffectSsInfo.treeLeafCount * 2 * sizeof(u16));
+    memset(sEffectSsInfo.evictTree, 0, sEffectSsInfo.treeLeafCount * 2 * sizeof(u16));
+    for (i = 0; i < tableSize; i++) {
+        EffectSs_SyncSlot(i);
+    }
+    sEffectSsActiveIndex = -1;
+    // #endregion
+
     overlay = &gEffectSsOverlayTable[0];
     for (i = 0; i < ARRAY_COUNT(gEffectSsOverlayTable); i++) {
         overlay->loadedRamAddr = NULL;
@@ -44,6 +124,9 @@ void EffectSs_ClearAll(PlayState* play) {
     sEffectSsInfo.table = NULL;
     sEffectSsInfo.searchStartIndex = 0;
     sEffectSsInfo.tableSize = 0;
+    sEffectSsInfo.freeTree = NULL;
+    sEffectSsInfo.evictTree = NULL;
+    sEffectSsInfo.treeLeafCount = 0;
 
     // This code doesn't actually work, since table was just set to NULL and tableSize to 0
     for (effectSs = &sEffectSsInfo.table[0]; effectSs < &sEffectSsInfo.table[sEffectSsInfo.tableSize]; effectSs++) {
@@ -96,14 +179,41 @@ void EffectSs_Reset(EffectSs* effectSs) {
     }
 }
 
-s32 EffectSs_FindSlot(s32 priority, s32* pIndex) {
-    s32 foundFree;
+// #region SOH [Port] Both searches walk the table circularly from searchStartIndex and take the first match. The
+// trees answer "first match at or after an index" directly, so the slot picked is the same as the original scans.
+static s32 EffectSs_FindSlotInTrees(s32 priority, s32* pIndex) {
     s32 i;
 
-    if (sEffectSsInfo.searchStartIndex >= sEffectSsInfo.tableSize) {
-        sEffectSsInfo.searchStartIndex = 0;
+    if (sEffectSsActiveIndex >= 0) {
+        EffectSs_SyncSlot(sEffectSsActiveIndex);
     }
 
+    // Search for a free slot
+    i = EffectSs_TreeFindFrom(sEffectSsInfo.freeTree, sEffectSsInfo.searchStartIndex, 1);
+    if (i >= 0) {
+        *pIndex = i;
+        return 0;
+    }
+
+    // If all slots are in use, search for a slot with a lower priority
+    // Note that a lower priority is representend by a higher value
+    // Equal priority should only be considered "lower" if flag 0 is not set
+    i = EffectSs_TreeFindFrom(sEffectSsInfo.evictTree, sEffectSsInfo.searchStartIndex, CLAMP_MIN(priority * 2 + 1, 0));
+    if (i < 0) {
+        // Return 1 to indicate that we failed to find a suitable slot
+        return 1;
+    }
+
+    *pIndex = i;
+    return 0;
+}
+
+#ifndef NDEBUG
+// The original search, which debug builds run next to the trees on every spawn to check they pick the same slot
+static s32 EffectSs_FindSlotLinear(s32 priority, s32* pIndex) {
+    s32 foundFree;
+    s32 i;
+
     // Search for a free slot
     i = sEffectSsInfo.searchStartIndex;
     foundFree = false;
@@ -155,6 +265,30 @@ s32 EffectSs_FindSlot(s32 priority, s32* pIndex) {
     *pIndex = i;
     return 0;
 }
+#endif
+// #endregion
+
+s32 EffectSs_FindSlot(s32 priority, s32* pIndex) {
+    s32 result;
+#ifndef NDEBUG
+    s32 linearResult;
+    s32 linearIndex;
+#endif
+
+    if (sEffectSsInfo.searchStartIndex >= sEffectSsInfo.tableSize) {
+        sEffectSsInfo.searchStartIndex = 0;
+    }
+
+    // #region SOH [Port] Slot search trees
+    result = EffectSs_FindSlotInTrees(priority, pIndex);
+#ifndef NDEBUG
+    linearResult = EffectSs_FindSlotLinear(priority, &linearIndex);
+    assert(result == linearResult && (result != 0 || *pIndex == linearIndex));
+#endif
+    // #endregion
+
+    return result;
+}
 
 void EffectSs_Insert(PlayState* play, EffectSs* effectSs) {
     s32 index;
@@ -163,6 +297,7 @@ void EffectSs_Insert(PlayState* play, EffectSs* effectSs) {
         if (EffectSs_FindSlot(effectSs->priority, &index) == 0) {
             sEffectSsInfo.searchStartIndex = index + 1;
             sEffectSsInfo.table[index] = *effectSs;
+            EffectSs_SyncSlot(index);
         }
     }
 }
@@ -170,6 +305,8 @@ void EffectSs_Insert(PlayState* play, EffectSs* effectSs) {
 // original name: "EffectSoftSprite2_makeEffect"
 void EffectSs_Spawn(PlayState* play, s32 type, s32 priority, void* initParams) {
     s32 index;
+    s32 prevActiveIndex;
+    s32 initResult;
     u32 overlaySize;
     EffectSsOverlay* overlayEntry;
     EffectSsInit* initInfo;
@@ -239,7 +376,15 @@ void EffectSs_Spawn(PlayState* play, s32 type, s32 priority, void* initParams) {
     sEffectSsInfo.table[index].priority = priority;
     sEffectSsInfo.table[index].epoch++;
 
-    if (initInfo->init(play, index, &sEffectSsInfo.table[index], initParams) == 0) {
+    // #region SOH [Port] Slot search trees
+    prevActiveIndex = sEffectSsActiveIndex;
+    sEffectSsActiveIndex = index;
+    EffectSs_SyncSlot(index);
+    initResult = initInfo->init(play, index, &sEffectSsInfo.table[index], initParams);
+    sEffectSsActiveIndex = prevActiveIndex;
+    // #endregion
+
+    if (initResult == 0) {
         osSyncPrintf(VT_FGCOL(GREEN));
         // "Construction failed for some reason. The constructor returned an error.
         // Ceasing effect addition."
@@ -249,6 +394,8 @@ void EffectSs_Spawn(PlayState* play, s32 type, s32 priority, void* initParams) {
         osSyncPrintf(VT_RST);
         EffectSs_Reset(&sEffectSsInfo.table[index]);
     }
+
+    EffectSs_SyncSlot(index); // SOH [Port]
 }
 
 void EffectSs_Update(PlayState* play, s32 index) {
@@ -263,7 +410,9 @@ void EffectSs_Update(PlayState* play, s32 index) {
         effectSs->pos.y += effectSs->velocity.y;
         effectSs->pos.z += effectSs->velocity.z;
 
+        sEffectSsActiveIndex = index; // SOH [Port]
         effectSs->update(play, index, effectSs);
+        sEffectSsActiveIndex = -1; // SOH [Port]
     }
 }
 
@@ -282,6 +431,8 @@ void EffectSs_UpdateAll(PlayState* play) {
         if (sEffectSsInfo.table[i].life > -1) {
             EffectSs_Update(play, i);
         }
+
+        EffectSs_SyncSlot(i); // SOH [Port]
     }
 }
 
@@ -290,7 +441,9 @@ void EffectSs_Draw(PlayState* play, s32 index) {
 
     if (effectSs->draw != NULL) {
         FrameInterpolation_RecordOpenChild(effectSs, effectSs->epoch);
+        sEffectSsActiveIndex = index; // SOH [Port]
         effectSs->draw(play, index, effectSs);
+        sEffectSsActiveIndex = -1; // SOH [Port]
         FrameInterpolation_RecordCloseChild();
     }
 }
@@ -326,6 +479,8 @@ void EffectSs_DrawAll(PlayState* play) {
             } else {
                 EffectSs_Draw(play, i);
             }
+
+            EffectSs_SyncSlot(i); // SOH [Port]
         }
     }
 }
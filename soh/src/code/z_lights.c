@@ -158,12 +158,20 @@ void Lights_BindDirectional(Lights* lights, LightParams* params, Vec3f* vec) {
  * available in the Lights group. This is at most 7 slots for a new group, but could be less.
  */
 void Lights_BindAll(Lights* lights, LightNode* listHead, Vec3f* vec) {
-    LightsBindFunc bindFuncs[] = { Lights_BindPoint, Lights_BindDirectional, Lights_BindPoint };
+    static const LightsBindFunc bindFuncs[] = { Lights_BindPoint, Lights_BindDirectional, Lights_BindPoint };
     LightInfo* info;
 
     while (listHead != NULL) {
+        // #region SOH [General] Stop once every slot is taken, the remaining lights can't bind anything. Point lights
+        // bind nothing without a position, so only directional lights need to be visited then.
+        if (lights->numLights >= 7) {
+            break;
+        }
         info = listHead->info;
-        bindFuncs[info->type](lights, &info->params, vec);
+        if (vec != NULL || info->type == LIGHT_DIRECTIONAL) {
+            bindFuncs[info->type](lights, &info->params, vec);
+        }
+        // #endregion
         listHead = listHead->next;
     }
 }
@@ -1,5 +1,6 @@
 #include "global.h"
 #include <string.h>
+#include "soh/Enhancements/debugger/arenaBenchmark.h"
 
 #define LOG_SEVERITY_NOLOG 0
 #define LOG_SEVERITY_ERROR 2
@@ -8,6 +9,15 @@
 s32 gZeldaArenaLogSeverity = LOG_SEVERITY_ERROR;
 Arena sZeldaArena;
 
+// #region SOH [General] Allocation trace for the arena benchmark
+#define ZELDA_ARENA_TRACE(op, ptr, size, result)         \
+    do {                                                 \
+        if (gArenaTraceEnabled) {                        \
+            ArenaBenchmark_Trace(op, ptr, size, result); \
+        }                                                \
+    } while (0)
+// #endregion
+
 void ZeldaArena_CheckPointer(void* ptr, size_t size, const char* name, const char* action) {
     if (ptr == NULL) {
         if (gZeldaArenaLogSeverity >= LOG_SEVERITY_ERROR) {
@@ -23,6 +33,7 @@ void ZeldaArena_CheckPointer(void* ptr, size_t size, const char* name, const cha
 
 void* ZeldaArena_Malloc(size_t size) {
     void* ptr = __osMalloc(&sZeldaArena, size);
+    ZELDA_ARENA_TRACE(ARENA_TRACE_MALLOC, NULL, size, ptr); // SOH [General]
 
     ZeldaArena_CheckPointer(ptr, size, "zelda_malloc", "確保"); // "Secure"
     return ptr;
@@ -30,6 +41,7 @@ void* ZeldaArena_Malloc(size_t size) {
 
 void* ZeldaArena_MallocDebug(size_t size, const char* file, s32 line) {
     void* ptr = __osMallocDebug(&sZeldaArena, size, file, line);
+    ZELDA_ARENA_TRACE(ARENA_TRACE_MALLOC, NULL, size, ptr); // SOH [General]
 
     ZeldaArena_CheckPointer(ptr, size, "zelda_malloc_DEBUG", "確保"); // "Secure"
     return ptr;
@@ -37,6 +49,7 @@ void* ZeldaArena_MallocDebug(size_t size, const char* file, s32 line) {
 
 void* ZeldaArena_MallocR(size_t size) {
     void* ptr = __osMallocR(&sZeldaArena, size);
+    ZELDA_ARENA_TRACE(ARENA_TRACE_MALLOC_R, NULL, size, ptr); // SOH [General]
 
     ZeldaArena_CheckPointer(ptr, size, "zelda_malloc_r", "確保"); // "Secure"
     return ptr;
@@ -44,29 +57,36 @@ void* ZeldaArena_MallocR(size_t size) {
 
 void* ZeldaArena_MallocRDebug(size_t size, const char* file, s32 line) {
     void* ptr = __osMallocRDebug(&sZeldaArena, size, file, line);
+    ZELDA_ARENA_TRACE(ARENA_TRACE_MALLOC_R, NULL, size, ptr); // SOH [General]
 
     ZeldaArena_CheckPointer(ptr, size, "zelda_malloc_r_DEBUG", "確保"); // "Secure"
     return ptr;
 }
 
 void* ZeldaArena_Realloc(void* ptr, size_t newSize) {
+    void* oldPtr = ptr; // SOH [General]
     ptr = __osRealloc(&sZeldaArena, ptr, newSize);
+    ZELDA_ARENA_TRACE(ARENA_TRACE_REALLOC, oldPtr, newSize, ptr); // SOH [General]
     ZeldaArena_CheckPointer(ptr, newSize, "zelda_realloc", "再確保"); // "Re-securing"
     return ptr;
 }
 
 void* ZeldaArena_ReallocDebug(void* ptr, size_t newSize, const char* file, s32 line) {
+    void* oldPtr = ptr; // SOH [General]
     ptr = __osReallocDebug(&sZeldaArena, ptr, newSize, file, line);
+    ZELDA_ARENA_TRACE(ARENA_TRACE_REALLOC, oldPtr, newSize, ptr); // SOH [General]
     ZeldaArena_CheckPointer(ptr, newSize, "zelda_realloc_DEBUG", "再確保"); // "Re-securing"
     return ptr;
 }
 
 void ZeldaArena_Free(void* ptr) {
     __osFree(&sZeldaArena, ptr);
+    ZELDA_ARENA_TRACE(ARENA_TRACE_FREE, ptr, 0, NULL); // SOH [General]
 }
 
 void ZeldaArena_FreeDebug(void* ptr, const char* file, s32 line) {
     __osFreeDebug(&sZeldaArena, ptr, file, line);
+    ZELDA_ARENA_TRACE(ARENA_TRACE_FREE, ptr, 0, NULL); // SOH [General]
 }
 
 void* ZeldaArena_Calloc(size_t num, size_t size) {
@@ -74,6 +94,7 @@ void* ZeldaArena_Calloc(size_t num, size_t size) {
     size_t n = num * size;
 
     ret = __osMalloc(&sZeldaArena, n);
+    ZELDA_ARENA_TRACE(ARENA_TRACE_MALLOC, NULL, n, ret); // SOH [General]
     if (ret != NULL) {
         memset(ret, 0, n);
     }
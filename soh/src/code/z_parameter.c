@@ -12,6 +12,7 @@
 #include "soh/Enhancements/cosmetics/cosmeticsTypes.h"
 #include "soh/Enhancements/enhancementTypes.h"
 #include "soh/ShipUtils.h"
+#include "soh/CVarHandle.h"
 
 #include <string.h>
 #include <stdlib.h>
@@ -44,6 +45,120 @@ s16 Left_HUD_Margin = 0;
 s16 Right_HUD_Margin = 0;
 s16 Bottom_HUD_Margin = 0;
 
+// Read on every frame by the HUD code, so resolved once through CVarHandle
+static CVarHandle sBetterFaroreCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("BetterFarore"));
+static CVarHandle sConsumableBlueRupeeChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("Consumable.BlueRupee.Changed"));
+static CVarHandle sConsumableGreenRupeeChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("Consumable.GreenRupee.Changed"));
+static CVarHandle sConsumableMagicChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("Consumable.Magic.Changed"));
+static CVarHandle sConsumableMagicActiveChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("Consumable.MagicActive.Changed"));
+static CVarHandle sConsumableMagicBorderChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("Consumable.MagicBorder.Changed"));
+static CVarHandle sConsumableMagicBorderActiveChangedCVar =
+    CVAR_HANDLE_INIT(CVAR_COSMETIC("Consumable.MagicBorderActive.Changed"));
+static CVarHandle sConsumablePurpleRupeeChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("Consumable.PurpleRupee.Changed"));
+static CVarHandle sConsumableRedRupeeChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("Consumable.RedRupee.Changed"));
+static CVarHandle sDefaultColorSchemeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("DefaultColorScheme"));
+static CVarHandle sDisableNaviCallAudioCVar = CVAR_HANDLE_INIT(CVAR_AUDIO("DisableNaviCallAudio"));
+static CVarHandle sDpadEquipsCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("DpadEquips"));
+static CVarHandle sDrawLineupTickCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("DrawLineupTick"));
+static CVarHandle sDynamicWalletIconCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("DynamicWalletIcon"));
+static CVarHandle sEnemyHealthBarCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("EnemyHealthBar"));
+static CVarHandle sHUDAButtonChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.AButton.Changed"));
+static CVarHandle sHUDAButtonPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.AButton.PosType"));
+static CVarHandle sHUDAButtonPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.AButton.PosX"));
+static CVarHandle sHUDAButtonPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.AButton.PosY"));
+static CVarHandle sHUDAButtonUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.AButton.UseMargins"));
+static CVarHandle sHUDArcheryScorePosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.ArcheryScore.PosType"));
+static CVarHandle sHUDArcheryScorePosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.ArcheryScore.PosX"));
+static CVarHandle sHUDArcheryScorePosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.ArcheryScore.PosY"));
+static CVarHandle sHUDArcheryScoreUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.ArcheryScore.UseMargins"));
+static CVarHandle sHUDBButtonChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.BButton.Changed"));
+static CVarHandle sHUDBButtonPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.BButton.PosType"));
+static CVarHandle sHUDBButtonPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.BButton.PosX"));
+static CVarHandle sHUDBButtonPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.BButton.PosY"));
+static CVarHandle sHUDBButtonScaleCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.BButton.Scale"));
+static CVarHandle sHUDBButtonUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.BButton.UseMargins"));
+static CVarHandle sHUDCarrotsPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Carrots.PosType"));
+static CVarHandle sHUDCarrotsPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Carrots.PosX"));
+static CVarHandle sHUDCarrotsPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Carrots.PosY"));
+static CVarHandle sHUDCarrotsUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Carrots.UseMargins"));
+static CVarHandle sHUDCButtonsChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CButtons.Changed"));
+static CVarHandle sHUDCDownButtonChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CDownButton.Changed"));
+static CVarHandle sHUDCDownButtonPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CDownButton.PosType"));
+static CVarHandle sHUDCDownButtonPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CDownButton.PosX"));
+static CVarHandle sHUDCDownButtonPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CDownButton.PosY"));
+static CVarHandle sHUDCDownButtonScaleCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CDownButton.Scale"));
+static CVarHandle sHUDCDownButtonUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CDownButton.UseMargins"));
+static CVarHandle sHUDCLeftButtonChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CLeftButton.Changed"));
+static CVarHandle sHUDCLeftButtonPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CLeftButton.PosType"));
+static CVarHandle sHUDCLeftButtonPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CLeftButton.PosX"));
+static CVarHandle sHUDCLeftButtonPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CLeftButton.PosY"));
+static CVarHandle sHUDCLeftButtonScaleCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CLeftButton.Scale"));
+static CVarHandle sHUDCLeftButtonUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"));
+static CVarHandle sHUDCRightButtonChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CRightButton.Changed"));
+static CVarHandle sHUDCRightButtonPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CRightButton.PosType"));
+static CVarHandle sHUDCRightButtonPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CRightButton.PosX"));
+static CVarHandle sHUDCRightButtonPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CRightButton.PosY"));
+static CVarHandle sHUDCRightButtonScaleCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CRightButton.Scale"));
+static CVarHandle sHUDCRightButtonUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CRightButton.UseMargins"));
+static CVarHandle sHUDCUpButtonChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CUpButton.Changed"));
+static CVarHandle sHUDCUpButtonPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CUpButton.PosType"));
+static CVarHandle sHUDCUpButtonPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CUpButton.PosX"));
+static CVarHandle sHUDCUpButtonPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CUpButton.PosY"));
+static CVarHandle sHUDCUpButtonScaleCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CUpButton.Scale"));
+static CVarHandle sHUDCUpButtonUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.CUpButton.UseMargins"));
+static CVarHandle sHUDDpadChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Dpad.Changed"));
+static CVarHandle sHUDDpadPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Dpad.PosType"));
+static CVarHandle sHUDDpadPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Dpad.PosX"));
+static CVarHandle sHUDDpadPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Dpad.PosY"));
+static CVarHandle sHUDDpadUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Dpad.UseMargins"));
+static CVarHandle sHUDEnemyHealthBarChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.EnemyHealthBar.Changed"));
+static CVarHandle sHUDEnemyHealthBarPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.EnemyHealthBar.PosType"));
+static CVarHandle sHUDEnemyHealthBarPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.EnemyHealthBar.PosX"));
+static CVarHandle sHUDEnemyHealthBarPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.EnemyHealthBar.PosY"));
+static CVarHandle sHUDEnemyHealthBarWidthChangedCVar =
+    CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.EnemyHealthBar.Width.Changed"));
+static CVarHandle sHUDEnemyHealthBarWidthValueCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.EnemyHealthBar.Width.Value"));
+static CVarHandle sHUDEnemyHealthBorderChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.EnemyHealthBorder.Changed"));
+static CVarHandle sHUDHeartsLineLengthCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Hearts.LineLength"));
+static CVarHandle sHUDIGTPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.IGT.PosType"));
+static CVarHandle sHUDIGTPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.IGT.PosX"));
+static CVarHandle sHUDIGTPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.IGT.PosY"));
+static CVarHandle sHUDIGTUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.IGT.UseMargins"));
+static CVarHandle sHUDKeyCountChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.KeyCount.Changed"));
+static CVarHandle sHUDMagicBarPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.MagicBar.PosType"));
+static CVarHandle sHUDMagicBarPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.MagicBar.PosX"));
+static CVarHandle sHUDMagicBarPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.MagicBar.PosY"));
+static CVarHandle sHUDMagicBarUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.MagicBar.UseMargins"));
+static CVarHandle sHUDMarginBCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Margin.B"));
+static CVarHandle sHUDMarginLCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Margin.L"));
+static CVarHandle sHUDMarginRCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Margin.R"));
+static CVarHandle sHUDMarginTCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Margin.T"));
+static CVarHandle sHUDRupeesPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Rupees.PosType"));
+static CVarHandle sHUDRupeesPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Rupees.PosX"));
+static CVarHandle sHUDRupeesPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Rupees.PosY"));
+static CVarHandle sHUDRupeesUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Rupees.UseMargins"));
+static CVarHandle sHUDSmallKeyPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.SmallKey.PosType"));
+static CVarHandle sHUDSmallKeyPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.SmallKey.PosX"));
+static CVarHandle sHUDSmallKeyPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.SmallKey.PosY"));
+static CVarHandle sHUDSmallKeyUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.SmallKey.UseMargins"));
+static CVarHandle sHUDStartButtonChangedCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.StartButton.Changed"));
+static CVarHandle sHUDStartButtonPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.StartButton.PosType"));
+static CVarHandle sHUDStartButtonPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.StartButton.PosX"));
+static CVarHandle sHUDStartButtonPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.StartButton.PosY"));
+static CVarHandle sHUDStartButtonScaleCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.StartButton.Scale"));
+static CVarHandle sHUDStartButtonUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.StartButton.UseMargins"));
+static CVarHandle sHUDTimersPosTypeCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Timers.PosType"));
+static CVarHandle sHUDTimersPosXCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Timers.PosX"));
+static CVarHandle sHUDTimersPosYCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Timers.PosY"));
+static CVarHandle sHUDTimersUseMarginsCVar = CVAR_HANDLE_INIT(CVAR_COSMETIC("HUD.Timers.UseMargins"));
+static CVarHandle sInfiniteEponaBoostCVar = CVAR_HANDLE_INIT(CVAR_CHEAT("InfiniteEponaBoost"));
+static CVarHandle sMinimalUICVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("MinimalUI"));
+static CVarHandle sMirroredWorldCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("MirroredWorld"));
+static CVarHandle sMMBunnyHoodCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("MMBunnyHood"));
+static CVarHandle sNaviTextFixCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("NaviTextFix"));
+static CVarHandle sShowIngameTimerCVar = CVAR_HANDLE_INIT(CVAR_GAMEPLAY_STATS("ShowIngameTimer"));
+static CVarHandle sSuperTunicCVar = CVAR_HANDLE_INIT(CVAR_CHEAT("SuperTunic"));
+
 typedef struct {
     /* 0x00 */ u8 scene;
     /* 0x01 */ u8 flags1;
@@ -1158,8 +1273,7 @@ void func_80083108(PlayState* play) {
 
                 if (interfaceCtx->restrictions.tradeItems != 0) {
                     for (i = 1; i < ARRAY_COUNT(gSaveContext.equips.buttonItems); i++) {
-                        if ((CVarGetInteger(CVAR_ENHANCEMENT("MMBunnyHood"), BUNNY_HOOD_VANILLA) !=
-                             BUNNY_HOOD_VANILLA) &&
+                        if ((CVarHandle_GetInteger(&sMMBunnyHoodCVar, BUNNY_HOOD_VANILLA) != BUNNY_HOOD_VANILLA) &&
                             (gSaveContext.equips.buttonItems[i] >= ITEM_MASK_KEATON) &&
                             (gSaveContext.equips.buttonItems[i] <= ITEM_MASK_TRUTH)) {
                             gSaveContext.buttonStatus[BUTTON_STATUS_INDEX(i)] = BTN_ENABLED;
@@ -1391,7 +1505,7 @@ void Interface_SetSceneRestrictions(PlayState* play) {
                          interfaceCtx->restrictions.farores, interfaceCtx->restrictions.dinsNayrus,
                          interfaceCtx->restrictions.all);
             osSyncPrintf(VT_RST);
-            if (CVarGetInteger(CVAR_ENHANCEMENT("BetterFarore"), 0)) {
+            if (CVarHandle_GetInteger(&sBetterFaroreCVar, 0)) {
                 if (currentScene == SCENE_GERUDO_TRAINING_GROUND || currentScene == SCENE_INSIDE_GANONS_CASTLE) {
                     interfaceCtx->restrictions.farores = 0;
                 }
@@ -2808,7 +2922,7 @@ void Interface_SetNaviCall(PlayState* play, u16 naviCallState) {
 
     if (((naviCallState == 0x1D) || (naviCallState == 0x1E)) && !interfaceCtx->naviCalling &&
         (play->csCtx.state == CS_STATE_IDLE)) {
-        if (!CVarGetInteger(CVAR_AUDIO("DisableNaviCallAudio"), 0)) {
+        if (!CVarHandle_GetInteger(&sDisableNaviCallAudioCVar, 0)) {
             // clang-format off
             if (naviCallState == 0x1E) { Audio_PlaySoundGeneral(NA_SE_VO_NAVY_CALL, &gSfxDefaultPos, 4,
                                                                 &gSfxDefaultFreqAndVolScale, &gSfxDefaultFreqAndVolScale, &gSfxDefaultReverb); }
@@ -3161,8 +3275,8 @@ void Interface_UpdateMagicBar(PlayState* play) {
     Color_RGB8 MagicBorder_2 = { 255, 255, 150 };
     Color_RGB8 MagicBorder_3 = { 255, 255, 50 };
 
-    if (CVarGetInteger(CVAR_COSMETIC("Consumable.MagicBorderActive.Changed"),
-                       0)) { // This will make custom color based on users selected colors.
+    if (CVarHandle_GetInteger(&sConsumableMagicBorderActiveChangedCVar,
+                              0)) { // This will make custom color based on users selected colors.
         sMagicBorderColors[0][0] = CVarGetColor24(CVAR_COSMETIC("Consumable.MagicBorderActive.Value"), MagicBorder_0).r;
         sMagicBorderColors[0][1] = CVarGetColor24(CVAR_COSMETIC("Consumable.MagicBorderActive.Value"), MagicBorder_0).g;
         sMagicBorderColors[0][2] = CVarGetColor24(CVAR_COSMETIC("Consumable.MagicBorderActive.Value"), MagicBorder_0).b;
@@ -3247,14 +3361,14 @@ void Interface_UpdateMagicBar(PlayState* play) {
                 if (gSaveContext.magic <= 0) {
                     gSaveContext.magic = 0;
                     gSaveContext.magicState = MAGIC_STATE_METER_FLASH_1;
-                    if (CVarGetInteger(CVAR_COSMETIC("Consumable.MagicBorder.Changed"), 0)) {
+                    if (CVarHandle_GetInteger(&sConsumableMagicBorderChangedCVar, 0)) {
                         sMagicBorder = CVarGetColor24(CVAR_COSMETIC("Consumable.MagicBorder.Value"), sMagicBorder_ori);
                     } else {
                         sMagicBorder = sMagicBorder_ori;
                     }
                 } else if (gSaveContext.magic == gSaveContext.magicTarget) {
                     gSaveContext.magicState = MAGIC_STATE_METER_FLASH_1;
-                    if (CVarGetInteger(CVAR_COSMETIC("Consumable.MagicBorder.Changed"), 0)) {
+                    if (CVarHandle_GetInteger(&sConsumableMagicBorderChangedCVar, 0)) {
                         sMagicBorder = CVarGetColor24(CVAR_COSMETIC("Consumable.MagicBorder.Value"), sMagicBorder_ori);
                     } else {
                         sMagicBorder = sMagicBorder_ori;
@@ -3301,7 +3415,7 @@ void Interface_UpdateMagicBar(PlayState* play) {
             break;
 
         case MAGIC_STATE_RESET:
-            if (CVarGetInteger(CVAR_COSMETIC("Consumable.MagicBorder.Changed"), 0)) {
+            if (CVarHandle_GetInteger(&sConsumableMagicBorderChangedCVar, 0)) {
                 sMagicBorder = CVarGetColor24(CVAR_COSMETIC("Consumable.MagicBorder.Value"), sMagicBorder_ori);
             } else {
                 sMagicBorder = sMagicBorder_ori;
@@ -3314,7 +3428,7 @@ void Interface_UpdateMagicBar(PlayState* play) {
                 (play->gameOverCtx.state == GAMEOVER_INACTIVE) && (play->transitionTrigger == TRANS_TRIGGER_OFF) &&
                 (play->transitionMode == TRANS_MODE_OFF) && !Play_InCsMode(play)) {
                 bool hasLens = false;
-                for (int buttonIndex = 1; buttonIndex < ((CVarGetInteger(CVAR_ENHANCEMENT("DpadEquips"), 0) != 0)
+                for (int buttonIndex = 1; buttonIndex < ((CVarHandle_GetInteger(&sDpadEquipsCVar, 0) != 0)
                                                              ? ARRAY_COUNT(gSaveContext.equips.buttonItems)
                                                              : 4);
                      buttonIndex++) {
@@ -3330,7 +3444,7 @@ void Interface_UpdateMagicBar(PlayState* play) {
                     Audio_PlaySoundGeneral(NA_SE_SY_GLASSMODE_OFF, &gSfxDefaultPos, 4, &gSfxDefaultFreqAndVolScale,
                                            &gSfxDefaultFreqAndVolScale, &gSfxDefaultReverb);
                     gSaveContext.magicState = MAGIC_STATE_IDLE;
-                    if (CVarGetInteger(CVAR_COSMETIC("Consumable.MagicBorder.Changed"), 0)) {
+                    if (CVarHandle_GetInteger(&sConsumableMagicBorderChangedCVar, 0)) {
                         sMagicBorder = CVarGetColor24(CVAR_COSMETIC("Consumable.MagicBorder.Value"), sMagicBorder_ori);
                     } else {
                         sMagicBorder = sMagicBorder_ori;
@@ -3394,7 +3508,7 @@ void Interface_UpdateMagicBar(PlayState* play) {
 
         default:
             gSaveContext.magicState = MAGIC_STATE_IDLE;
-            if (CVarGetInteger(CVAR_COSMETIC("Consumable.MagicBorder.Changed"), 0)) {
+            if (CVarHandle_GetInteger(&sConsumableMagicBorderChangedCVar, 0)) {
                 sMagicBorder = CVarGetColor24(CVAR_COSMETIC("Consumable.MagicBorder.Value"), sMagicBorder_ori);
             } else {
                 sMagicBorder = sMagicBorder_ori;
@@ -3435,10 +3549,10 @@ void Interface_DrawMagicBar(PlayState* play) {
                                   R_MAGIC_FILL_COLOR(2) }; // Magic bar fill
     Color_RGB8 magicbar_blue = { 0, 0, 200 };              // Infinite magic bar
 
-    if (CVarGetInteger(CVAR_COSMETIC("Consumable.MagicActive.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sConsumableMagicActiveChangedCVar, 0)) {
         magicbar_yellow = CVarGetColor24(CVAR_COSMETIC("Consumable.MagicActive.Value"), magicbar_yellow);
     }
-    if (CVarGetInteger(CVAR_COSMETIC("Consumable.Magic.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sConsumableMagicChangedCVar, 0)) {
         magicbar_green = CVarGetColor24(CVAR_COSMETIC("Consumable.Magic.Value"), magicbar_green);
     }
     if (CVarGetInteger("gCosmetics.Consumable_MagicInfinite.Changed", 0)) {
@@ -3450,7 +3564,7 @@ void Interface_DrawMagicBar(PlayState* play) {
     if (gSaveContext.magicLevel != 0) {
         s16 X_Margins;
         s16 Y_Margins;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.UseMargins"), 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDMagicBarUseMarginsCVar, 0) != 0) {
             X_Margins = Left_HUD_Margin;
             Y_Margins = (Top_HUD_Margin * -1);
         } else {
@@ -3468,54 +3582,50 @@ void Interface_DrawMagicBar(PlayState* play) {
         s16 rMagicBarX;
         s16 PosX_MidEnd;
         s16 rMagicFillX;
-        s32 lineLength = CVarGetInteger(CVAR_COSMETIC("HUD.Hearts.LineLength"), 10);
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosType"), 0) != ORIGINAL_LOCATION) {
-            magicBarY = CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosY"), 0) + Y_Margins;
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosType"), 0) == ANCHOR_LEFT) {
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.UseMargins"), 0) != 0) {
+        s32 lineLength = CVarHandle_GetInteger(&sHUDHeartsLineLengthCVar, 10);
+        if (CVarHandle_GetInteger(&sHUDMagicBarPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+            magicBarY = CVarHandle_GetInteger(&sHUDMagicBarPosYCVar, 0) + Y_Margins;
+            if (CVarHandle_GetInteger(&sHUDMagicBarPosTypeCVar, 0) == ANCHOR_LEFT) {
+                if (CVarHandle_GetInteger(&sHUDMagicBarUseMarginsCVar, 0) != 0) {
                     X_Margins = Left_HUD_Margin;
                 };
-                PosX_Start =
-                    OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins);
-                rMagicBarX =
-                    OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins);
+                PosX_Start = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins);
+                rMagicBarX = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins);
                 PosX_MidEnd =
-                    OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins + 8);
+                    OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins + 8);
                 rMagicFillX =
-                    OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins + 8);
-            } else if (CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosType"), 0) == ANCHOR_RIGHT) {
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.UseMargins"), 0) != 0) {
+                    OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins + 8);
+            } else if (CVarHandle_GetInteger(&sHUDMagicBarPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                if (CVarHandle_GetInteger(&sHUDMagicBarUseMarginsCVar, 0) != 0) {
                     X_Margins = Right_HUD_Margin;
                 };
-                PosX_Start =
-                    OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins);
-                rMagicBarX =
-                    OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins);
+                PosX_Start = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins);
+                rMagicBarX = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins);
                 PosX_MidEnd =
-                    OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins + 8);
+                    OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins + 8);
                 rMagicFillX =
-                    OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins + 8);
-            } else if (CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosType"), 0) == ANCHOR_NONE) {
-                PosX_Start = CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins;
-                rMagicBarX = CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins;
-                PosX_MidEnd = CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins + 8;
-                rMagicFillX = CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + X_Margins + 8;
-            } else if (CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosType"), 0) == HIDDEN) {
+                    OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins + 8);
+            } else if (CVarHandle_GetInteger(&sHUDMagicBarPosTypeCVar, 0) == ANCHOR_NONE) {
+                PosX_Start = CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins;
+                rMagicBarX = CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins;
+                PosX_MidEnd = CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins + 8;
+                rMagicFillX = CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + X_Margins + 8;
+            } else if (CVarHandle_GetInteger(&sHUDMagicBarPosTypeCVar, 0) == HIDDEN) {
                 PosX_Start = -9999;
                 rMagicBarX = -9999;
                 PosX_MidEnd = -9999;
                 rMagicFillX = -9999;
-            } else if (CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosType"), 0) == ANCHOR_TO_LIFE_METER) {
+            } else if (CVarHandle_GetInteger(&sHUDMagicBarPosTypeCVar, 0) == ANCHOR_TO_LIFE_METER) {
                 magicBarY =
                     R_MAGIC_BAR_SMALL_Y - 2 +
                     magicDrop * (lineLength == 0 ? 0 : (gSaveContext.healthCapacity - 1) / (0x10 * lineLength)) +
-                    CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosY"), 0) + getHealthMeterYOffset();
+                    CVarHandle_GetInteger(&sHUDMagicBarPosYCVar, 0) + getHealthMeterYOffset();
                 s16 xPushover =
-                    CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + getHealthMeterXOffset() + R_MAGIC_BAR_X - 1;
+                    CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + getHealthMeterXOffset() + R_MAGIC_BAR_X - 1;
                 PosX_Start = xPushover;
                 rMagicBarX = xPushover;
                 PosX_MidEnd = xPushover + 8;
-                rMagicFillX = CVarGetInteger(CVAR_COSMETIC("HUD.MagicBar.PosX"), 0) + getHealthMeterXOffset() +
+                rMagicFillX = CVarHandle_GetInteger(&sHUDMagicBarPosXCVar, 0) + getHealthMeterXOffset() +
                               R_MAGIC_FILL_X - 1;
             }
         } else {
@@ -3624,18 +3734,18 @@ void Interface_DrawEnemyHealthBar(TargetContext* targetCtx, PlayState* play) {
     Color_RGBA8 healthbar_border = { 255, 255, 255, 255 };
     s16 healthbar_fillWidth = 64;
     s16 healthbar_actorOffset = 40;
-    s32 healthbar_offsetX = CVarGetInteger(CVAR_COSMETIC("HUD.EnemyHealthBar.PosX"), 0);
-    s32 healthbar_offsetY = CVarGetInteger(CVAR_COSMETIC("HUD.EnemyHealthBar.PosY"), 0);
-    s8 anchorType = CVarGetInteger(CVAR_COSMETIC("HUD.EnemyHealthBar.PosType"), ENEMYHEALTH_ANCHOR_ACTOR);
+    s32 healthbar_offsetX = CVarHandle_GetInteger(&sHUDEnemyHealthBarPosXCVar, 0);
+    s32 healthbar_offsetY = CVarHandle_GetInteger(&sHUDEnemyHealthBarPosYCVar, 0);
+    s8 anchorType = CVarHandle_GetInteger(&sHUDEnemyHealthBarPosTypeCVar, ENEMYHEALTH_ANCHOR_ACTOR);
 
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.EnemyHealthBar.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDEnemyHealthBarChangedCVar, 0)) {
         healthbar_red = CVarGetColor(CVAR_COSMETIC("HUD.EnemyHealthBar.Value"), healthbar_red);
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.EnemyHealthBorder.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDEnemyHealthBorderChangedCVar, 0)) {
         healthbar_border = CVarGetColor(CVAR_COSMETIC("HUD.EnemyHealthBorder.Value"), healthbar_border);
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.EnemyHealthBar.Width.Changed"), 0)) {
-        healthbar_fillWidth = CVarGetInteger(CVAR_COSMETIC("HUD.EnemyHealthBar.Width.Value"), healthbar_fillWidth);
+    if (CVarHandle_GetInteger(&sHUDEnemyHealthBarWidthChangedCVar, 0)) {
+        healthbar_fillWidth = CVarHandle_GetInteger(&sHUDEnemyHealthBarWidthValueCVar, healthbar_fillWidth);
     }
 
     OPEN_DISPS(play->state.gfxCtx);
@@ -3653,7 +3763,7 @@ void Interface_DrawEnemyHealthBar(TargetContext* targetCtx, PlayState* play) {
             func_8002BE04(play, &targetCtx->targetCenterPos, &projTargetCenter, &projTargetCappedInvW);
 
             projTargetCenter.x = (SCREEN_WIDTH / 2) * (projTargetCenter.x * projTargetCappedInvW);
-            projTargetCenter.x = projTargetCenter.x * (CVarGetInteger(CVAR_ENHANCEMENT("MirroredWorld"), 0) ? -1 : 1);
+            projTargetCenter.x = projTargetCenter.x * (CVarHandle_GetInteger(&sMirroredWorldCVar, 0) ? -1 : 1);
             projTargetCenter.x =
                 CLAMP(projTargetCenter.x, (-SCREEN_WIDTH / 2) + halfBarWidth, (SCREEN_WIDTH / 2) - halfBarWidth);
 
@@ -3817,37 +3927,37 @@ void Interface_DrawItemButtons(PlayState* play) {
     s16 height;
 
     Color_RGB8 bButtonColor = { 0, 150, 0 };
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDBButtonChangedCVar, 0)) {
         bButtonColor = CVarGetColor24(CVAR_COSMETIC("HUD.BButton.Value"), bButtonColor);
-    } else if (CVarGetInteger(CVAR_COSMETIC("DefaultColorScheme"), COLORSCHEME_N64) == COLORSCHEME_GAMECUBE) {
+    } else if (CVarHandle_GetInteger(&sDefaultColorSchemeCVar, COLORSCHEME_N64) == COLORSCHEME_GAMECUBE) {
         bButtonColor = (Color_RGB8){ 255, 30, 30 };
     }
 
     Color_RGB8 cButtonsColor = { 255, 160, 0 };
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CButtons.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDCButtonsChangedCVar, 0)) {
         cButtonsColor = CVarGetColor24(CVAR_COSMETIC("HUD.CButtons.Value"), cButtonsColor);
     }
     Color_RGB8 cUpButtonColor = cButtonsColor;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDCUpButtonChangedCVar, 0)) {
         cUpButtonColor = CVarGetColor24(CVAR_COSMETIC("HUD.CUpButton.Value"), cUpButtonColor);
     }
     Color_RGB8 cDownButtonColor = cButtonsColor;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDCDownButtonChangedCVar, 0)) {
         cDownButtonColor = CVarGetColor24(CVAR_COSMETIC("HUD.CDownButton.Value"), cDownButtonColor);
     }
     Color_RGB8 cLeftButtonColor = cButtonsColor;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDCLeftButtonChangedCVar, 0)) {
         cLeftButtonColor = CVarGetColor24(CVAR_COSMETIC("HUD.CLeftButton.Value"), cLeftButtonColor);
     }
     Color_RGB8 cRightButtonColor = cButtonsColor;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDCRightButtonChangedCVar, 0)) {
         cRightButtonColor = CVarGetColor24(CVAR_COSMETIC("HUD.CRightButton.Value"), cRightButtonColor);
     }
 
     Color_RGB8 startButtonColor = { 200, 0, 0 };
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDStartButtonChangedCVar, 0)) {
         startButtonColor = CVarGetColor24(CVAR_COSMETIC("HUD.StartButton.Value"), startButtonColor);
-    } else if (CVarGetInteger(CVAR_COSMETIC("DefaultColorScheme"), COLORSCHEME_N64) == COLORSCHEME_GAMECUBE) {
+    } else if (CVarHandle_GetInteger(&sDefaultColorSchemeCVar, COLORSCHEME_N64) == COLORSCHEME_GAMECUBE) {
         startButtonColor = (Color_RGB8){ 120, 120, 120 };
     }
 
@@ -3856,12 +3966,12 @@ void Interface_DrawItemButtons(PlayState* play) {
     s16 Y_Margins_BtnB;
     s16 BBtn_Size = 32;
     int BBtnScaled = BBtn_Size * 0.95f;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        BBtnScaled = BBtn_Size * CVarGetFloat(CVAR_COSMETIC("HUD.BButton.Scale"), 0.95f);
+    if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        BBtnScaled = BBtn_Size * CVarHandle_GetFloat(&sHUDBButtonScaleCVar, 0.95f);
     }
     int BBtn_factor = (1 << 10) * BBtn_Size / BBtnScaled;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_BtnB = Right_HUD_Margin;
         };
         Y_Margins_BtnB = (Top_HUD_Margin * -1);
@@ -3873,23 +3983,21 @@ void Interface_DrawItemButtons(PlayState* play) {
     s16 PosY_BtnB_ori = R_ITEM_BTN_Y(0) + Y_Margins_BtnB;
     s16 PosX_BtnB;
     s16 PosY_BtnB;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        PosY_BtnB = CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosY"), 0) + Y_Margins_BtnB;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        PosY_BtnB = CVarHandle_GetInteger(&sHUDBButtonPosYCVar, 0) + Y_Margins_BtnB;
+        if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_BtnB = Left_HUD_Margin;
             };
-            PosX_BtnB =
-                OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0) + X_Margins_BtnB);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
+            PosX_BtnB = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0) + X_Margins_BtnB);
+        } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_BtnB = Right_HUD_Margin;
             };
-            PosX_BtnB =
-                OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0) + X_Margins_BtnB);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_NONE) {
-            PosX_BtnB = CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == HIDDEN) {
+            PosX_BtnB = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0) + X_Margins_BtnB);
+        } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            PosX_BtnB = CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0);
+        } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == HIDDEN) {
             PosX_BtnB = -9999;
         }
     } else {
@@ -3899,8 +4007,8 @@ void Interface_DrawItemButtons(PlayState* play) {
     // Start Button
     s16 X_Margins_StartBtn;
     s16 Y_Margins_StartBtn;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDStartButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDStartButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_StartBtn = Right_HUD_Margin;
         };
         Y_Margins_StartBtn = Top_HUD_Margin * -1;
@@ -3911,8 +4019,8 @@ void Interface_DrawItemButtons(PlayState* play) {
     s16 StartBtn_Icon_H = 32;
     s16 StartBtn_Icon_W = 32;
     float Start_BTN_Scale = 0.75f;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        Start_BTN_Scale = CVarGetFloat(CVAR_COSMETIC("HUD.StartButton.Scale"), 0.75f);
+    if (CVarHandle_GetInteger(&sHUDStartButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        Start_BTN_Scale = CVarHandle_GetFloat(&sHUDStartButtonScaleCVar, 0.75f);
     }
     int StartBTN_H_Scaled = StartBtn_Icon_H * Start_BTN_Scale;
     int StartBTN_W_Scaled = StartBtn_Icon_W * Start_BTN_Scale;
@@ -3925,24 +4033,24 @@ void Interface_DrawItemButtons(PlayState* play) {
     s16 StartBTN_Label_H = DO_ACTION_TEX_HEIGHT();
     s16 PosX_StartBtn;
     s16 PosY_StartBtn;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.PosType"), 0) != ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDStartButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
         PosY_StartBtn =
-            CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.PosY"), 0) - (Start_BTN_Scale * 13) + Y_Margins_StartBtn;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.UseMargins"), 0) != 0) {
+            CVarHandle_GetInteger(&sHUDStartButtonPosYCVar, 0) - (Start_BTN_Scale * 13) + Y_Margins_StartBtn;
+        if (CVarHandle_GetInteger(&sHUDStartButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDStartButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_StartBtn = Left_HUD_Margin;
             };
-            PosX_StartBtn = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.PosX"), 0) -
+            PosX_StartBtn = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDStartButtonPosXCVar, 0) -
                                                         (Start_BTN_Scale * 13) + X_Margins_StartBtn);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.UseMargins"), 0) != 0) {
+        } else if (CVarHandle_GetInteger(&sHUDStartButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDStartButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_StartBtn = Right_HUD_Margin;
             };
-            PosX_StartBtn = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.PosX"), 0) -
+            PosX_StartBtn = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDStartButtonPosXCVar, 0) -
                                                          (Start_BTN_Scale * 13) + X_Margins_StartBtn);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.PosType"), 0) == ANCHOR_NONE) {
-            PosX_StartBtn = CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.PosX"), 0);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.StartButton.PosType"), 0) == HIDDEN) {
+        } else if (CVarHandle_GetInteger(&sHUDStartButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            PosX_StartBtn = CVarHandle_GetInteger(&sHUDStartButtonPosXCVar, 0);
+        } else if (CVarHandle_GetInteger(&sHUDStartButtonPosTypeCVar, 0) == HIDDEN) {
             PosX_StartBtn = -9999;
         }
     } else {
@@ -3962,8 +4070,8 @@ void Interface_DrawItemButtons(PlayState* play) {
     s16 Y_Margins_CR;
     s16 Y_Margins_CU;
     s16 Y_Margins_CD;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_CL = Right_HUD_Margin;
         };
         Y_Margins_CL = (Top_HUD_Margin * -1);
@@ -3971,8 +4079,8 @@ void Interface_DrawItemButtons(PlayState* play) {
         X_Margins_CL = 0;
         Y_Margins_CL = 0;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_CR = Right_HUD_Margin;
         };
         Y_Margins_CR = (Top_HUD_Margin * -1);
@@ -3980,8 +4088,8 @@ void Interface_DrawItemButtons(PlayState* play) {
         X_Margins_CR = 0;
         Y_Margins_CR = 0;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCUpButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDCUpButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_CU = Right_HUD_Margin;
         };
         Y_Margins_CU = (Top_HUD_Margin * -1);
@@ -3989,8 +4097,8 @@ void Interface_DrawItemButtons(PlayState* play) {
         X_Margins_CU = 0;
         Y_Margins_CU = 0;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_CD = Right_HUD_Margin;
         };
         Y_Margins_CD = (Top_HUD_Margin * -1);
@@ -4002,7 +4110,7 @@ void Interface_DrawItemButtons(PlayState* play) {
     const s16 C_Right_BTN_Pos_ori[] = { C_RIGHT_BUTTON_X + X_Margins_CR, C_RIGHT_BUTTON_Y + Y_Margins_CR };
     const s16 C_Up_BTN_Pos_ori[] = { C_UP_BUTTON_X + X_Margins_CU, C_UP_BUTTON_Y + Y_Margins_CU };
     const s16 C_Down_BTN_Pos_ori[] = { C_DOWN_BUTTON_X + X_Margins_CD, C_DOWN_BUTTON_Y + Y_Margins_CD };
-    s16 LabelX_Navi = 7 + !!CVarGetInteger(CVAR_ENHANCEMENT("NaviTextFix"), 0);
+    s16 LabelX_Navi = 7 + !!CVarHandle_GetInteger(&sNaviTextFixCVar, 0);
     s16 LabelY_Navi = 4;
     s16 C_Left_BTN_Pos[2]; //(X,Y)
     s16 C_Right_BTN_Pos[2];
@@ -4010,29 +4118,29 @@ void Interface_DrawItemButtons(PlayState* play) {
     s16 C_Down_BTN_Pos[2];
     // C button Left
     s16 C_Left_BTN_Size = 32;
-    float CLeftScale = CVarGetFloat(CVAR_COSMETIC("HUD.CLeftButton.Scale"), 0.87f);
+    float CLeftScale = CVarHandle_GetFloat(&sHUDCLeftButtonScaleCVar, 0.87f);
     int CLeftScaled = C_Left_BTN_Size * 0.87f;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) != ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
         CLeftScaled = C_Left_BTN_Size * CLeftScale;
     }
     int CLeft_factor = (1 << 10) * C_Left_BTN_Size / CLeftScaled;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        C_Left_BTN_Pos[1] = CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosY"), 0) + Y_Margins_CL;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        C_Left_BTN_Pos[1] = CVarHandle_GetInteger(&sHUDCLeftButtonPosYCVar, 0) + Y_Margins_CL;
+        if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CL = Left_HUD_Margin;
             };
             C_Left_BTN_Pos[0] =
-                OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0) + X_Margins_CL);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
+                OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0) + X_Margins_CL);
+        } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CL = Right_HUD_Margin;
             };
             C_Left_BTN_Pos[0] =
-                OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0) + X_Margins_CL);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_NONE) {
-            C_Left_BTN_Pos[0] = CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == HIDDEN) {
+                OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0) + X_Margins_CL);
+        } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            C_Left_BTN_Pos[0] = CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0);
+        } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == HIDDEN) {
             C_Left_BTN_Pos[0] = -9999;
         }
     } else {
@@ -4041,29 +4149,29 @@ void Interface_DrawItemButtons(PlayState* play) {
     }
     // C button Right
     s16 C_Right_BTN_Size = 32;
-    float CRightScale = CVarGetFloat(CVAR_COSMETIC("HUD.CRightButton.Scale"), 0.87f);
+    float CRightScale = CVarHandle_GetFloat(&sHUDCRightButtonScaleCVar, 0.87f);
     int CRightScaled = C_Right_BTN_Size * 0.87f;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) != ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
         CRightScaled = C_Right_BTN_Size * CRightScale;
     }
     int CRight_factor = (1 << 10) * C_Right_BTN_Size / CRightScaled;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        C_Right_BTN_Pos[1] = CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosY"), 0) + Y_Margins_CR;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        C_Right_BTN_Pos[1] = CVarHandle_GetInteger(&sHUDCRightButtonPosYCVar, 0) + Y_Margins_CR;
+        if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CR = Left_HUD_Margin;
             };
             C_Right_BTN_Pos[0] =
-                OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0) + X_Margins_CR);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
+                OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0) + X_Margins_CR);
+        } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CR = Right_HUD_Margin;
             };
             C_Right_BTN_Pos[0] =
-                OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0) + X_Margins_CR);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_NONE) {
-            C_Right_BTN_Pos[0] = CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == HIDDEN) {
+                OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0) + X_Margins_CR);
+        } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            C_Right_BTN_Pos[0] = CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0);
+        } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == HIDDEN) {
             C_Right_BTN_Pos[0] = -9999;
         }
     } else {
@@ -4073,28 +4181,28 @@ void Interface_DrawItemButtons(PlayState* play) {
     // C Button Up
     s16 C_Up_BTN_Size = 32;
     int CUpScaled = C_Up_BTN_Size * 0.5f;
-    float CUpScale = CVarGetFloat(CVAR_COSMETIC("HUD.CUpButton.Scale"), 0.5f);
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.PosType"), 0) != ORIGINAL_LOCATION) {
+    float CUpScale = CVarHandle_GetFloat(&sHUDCUpButtonScaleCVar, 0.5f);
+    if (CVarHandle_GetInteger(&sHUDCUpButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
         CUpScaled = C_Up_BTN_Size * CUpScale;
     }
     int CUp_factor = (1 << 10) * C_Up_BTN_Size / CUpScaled;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        C_Up_BTN_Pos[1] = CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.PosY"), 0) + Y_Margins_CU;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDCUpButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        C_Up_BTN_Pos[1] = CVarHandle_GetInteger(&sHUDCUpButtonPosYCVar, 0) + Y_Margins_CU;
+        if (CVarHandle_GetInteger(&sHUDCUpButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDCUpButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CU = Left_HUD_Margin;
             };
             C_Up_BTN_Pos[0] =
-                OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.PosX"), 0) + X_Margins_CU);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.UseMargins"), 0) != 0) {
+                OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDCUpButtonPosXCVar, 0) + X_Margins_CU);
+        } else if (CVarHandle_GetInteger(&sHUDCUpButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDCUpButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CU = Right_HUD_Margin;
             };
             C_Up_BTN_Pos[0] =
-                OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.PosX"), 0) + X_Margins_CU);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.PosType"), 0) == ANCHOR_NONE) {
-            C_Up_BTN_Pos[0] = CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.PosX"), 0);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CUpButton.PosType"), 0) == HIDDEN) {
+                OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDCUpButtonPosXCVar, 0) + X_Margins_CU);
+        } else if (CVarHandle_GetInteger(&sHUDCUpButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            C_Up_BTN_Pos[0] = CVarHandle_GetInteger(&sHUDCUpButtonPosXCVar, 0);
+        } else if (CVarHandle_GetInteger(&sHUDCUpButtonPosTypeCVar, 0) == HIDDEN) {
             C_Up_BTN_Pos[0] = -9999;
         }
     } else {
@@ -4103,30 +4211,30 @@ void Interface_DrawItemButtons(PlayState* play) {
     }
     // C Button down
     s16 C_Down_BTN_Size = 32;
-    float CDownScale = CVarGetFloat(CVAR_COSMETIC("HUD.CDownButton.Scale"), 0.87f);
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    float CDownScale = CVarHandle_GetFloat(&sHUDCDownButtonScaleCVar, 0.87f);
+    if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
         CDownScale = 0.87f;
     }
     int CDownScaled = C_Down_BTN_Size * CDownScale;
     int CDown_factor = (1 << 10) * C_Down_BTN_Size / CDownScaled;
     int PositionAdjustment = CDownScaled / 2;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        C_Down_BTN_Pos[1] = CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosY"), 0) + Y_Margins_CD;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        C_Down_BTN_Pos[1] = CVarHandle_GetInteger(&sHUDCDownButtonPosYCVar, 0) + Y_Margins_CD;
+        if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CD = Left_HUD_Margin;
             };
             C_Down_BTN_Pos[0] =
-                OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0) + X_Margins_CD);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
+                OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0) + X_Margins_CD);
+        } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CD = Right_HUD_Margin;
             };
             C_Down_BTN_Pos[0] =
-                OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0) + X_Margins_CD);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_NONE) {
-            C_Down_BTN_Pos[0] = CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == HIDDEN) {
+                OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0) + X_Margins_CD);
+        } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            C_Down_BTN_Pos[0] = CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0);
+        } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == HIDDEN) {
             C_Down_BTN_Pos[0] = -9999;
         }
     } else {
@@ -4262,8 +4370,8 @@ void Interface_DrawItemButtons(PlayState* play) {
             s16 Y_Margins_CL;
             s16 Y_Margins_CR;
             s16 Y_Margins_CD;
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ORIGINAL_LOCATION) {
+            if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
+                if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
                     X_Margins_CL = Right_HUD_Margin;
                 };
                 Y_Margins_CL = (Top_HUD_Margin * -1);
@@ -4271,8 +4379,8 @@ void Interface_DrawItemButtons(PlayState* play) {
                 X_Margins_CL = 0;
                 Y_Margins_CL = 0;
             }
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ORIGINAL_LOCATION) {
+            if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
+                if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
                     X_Margins_CR = Right_HUD_Margin;
                 };
                 Y_Margins_CR = (Top_HUD_Margin * -1);
@@ -4280,8 +4388,8 @@ void Interface_DrawItemButtons(PlayState* play) {
                 X_Margins_CR = 0;
                 Y_Margins_CR = 0;
             }
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ORIGINAL_LOCATION) {
+            if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
+                if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
                     X_Margins_CD = Right_HUD_Margin;
                 };
                 Y_Margins_CD = (Top_HUD_Margin * -1);
@@ -4301,23 +4409,23 @@ void Interface_DrawItemButtons(PlayState* play) {
             };
             s16 ItemIconPos[3][2]; //(X,Y)
             // C button Left
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) != ORIGINAL_LOCATION) {
-                ItemIconPos[0][1] = CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosY"), 0) + Y_Margins_CL;
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_LEFT) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
+            if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+                ItemIconPos[0][1] = CVarHandle_GetInteger(&sHUDCLeftButtonPosYCVar, 0) + Y_Margins_CL;
+                if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+                    if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
                         X_Margins_CL = Left_HUD_Margin;
                     };
                     ItemIconPos[0][0] = OTRGetDimensionFromLeftEdge(
-                        CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0) + X_Margins_CL);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_RIGHT) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
+                        CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0) + X_Margins_CL);
+                } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                    if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
                         X_Margins_CL = Right_HUD_Margin;
                     };
                     ItemIconPos[0][0] = OTRGetDimensionFromRightEdge(
-                        CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0) + X_Margins_CL);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_NONE) {
-                    ItemIconPos[0][0] = CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == HIDDEN) {
+                        CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0) + X_Margins_CL);
+                } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+                    ItemIconPos[0][0] = CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0);
+                } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == HIDDEN) {
                     ItemIconPos[0][0] = -9999;
                 }
             } else {
@@ -4325,23 +4433,23 @@ void Interface_DrawItemButtons(PlayState* play) {
                 ItemIconPos[0][1] = ItemIconPos_ori[0][1];
             }
             // C Button down
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) != ORIGINAL_LOCATION) {
-                ItemIconPos[1][1] = CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosY"), 0) + Y_Margins_CD;
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_LEFT) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
+            if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+                ItemIconPos[1][1] = CVarHandle_GetInteger(&sHUDCDownButtonPosYCVar, 0) + Y_Margins_CD;
+                if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+                    if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
                         X_Margins_CD = Left_HUD_Margin;
                     };
                     ItemIconPos[1][0] = OTRGetDimensionFromLeftEdge(
-                        CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0) + X_Margins_CD);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_RIGHT) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
+                        CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0) + X_Margins_CD);
+                } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                    if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
                         X_Margins_CD = Right_HUD_Margin;
                     };
                     ItemIconPos[1][0] = OTRGetDimensionFromRightEdge(
-                        CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0) + X_Margins_CD);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_NONE) {
-                    ItemIconPos[1][0] = CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == HIDDEN) {
+                        CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0) + X_Margins_CD);
+                } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+                    ItemIconPos[1][0] = CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0);
+                } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == HIDDEN) {
                     ItemIconPos[1][0] = -9999;
                 }
             } else {
@@ -4349,23 +4457,23 @@ void Interface_DrawItemButtons(PlayState* play) {
                 ItemIconPos[1][1] = ItemIconPos_ori[1][1];
             }
             // C button Right
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) != ORIGINAL_LOCATION) {
-                ItemIconPos[2][1] = CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosY"), 0) + Y_Margins_CR;
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_LEFT) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
+            if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+                ItemIconPos[2][1] = CVarHandle_GetInteger(&sHUDCRightButtonPosYCVar, 0) + Y_Margins_CR;
+                if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+                    if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
                         X_Margins_CR = Left_HUD_Margin;
                     };
                     ItemIconPos[2][0] = OTRGetDimensionFromLeftEdge(
-                        CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0) + X_Margins_CR);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_RIGHT) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
+                        CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0) + X_Margins_CR);
+                } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                    if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
                         X_Margins_CR = Right_HUD_Margin;
                     };
                     ItemIconPos[2][0] = OTRGetDimensionFromRightEdge(
-                        CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0) + X_Margins_CR);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_NONE) {
-                    ItemIconPos[2][0] = CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == HIDDEN) {
+                        CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0) + X_Margins_CR);
+                } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+                    ItemIconPos[2][0] = CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0);
+                } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == HIDDEN) {
                     ItemIconPos[2][0] = -9999;
                 }
             } else {
@@ -4419,8 +4527,8 @@ void Interface_DrawItemIconTexture(PlayState* play, void* texture, s16 button) {
     s16 Y_Margins_BtnB;
     s16 X_Margins_DPad_Items;
     s16 Y_Margins_DPad_Items;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_BtnB = Right_HUD_Margin;
         };
         Y_Margins_BtnB = (Top_HUD_Margin * -1);
@@ -4428,8 +4536,8 @@ void Interface_DrawItemIconTexture(PlayState* play, void* texture, s16 button) {
         X_Margins_BtnB = 0;
         Y_Margins_BtnB = 0;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_CL = Right_HUD_Margin;
         };
         Y_Margins_CL = (Top_HUD_Margin * -1);
@@ -4437,8 +4545,8 @@ void Interface_DrawItemIconTexture(PlayState* play, void* texture, s16 button) {
         X_Margins_CL = 0;
         Y_Margins_CL = 0;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_CR = Right_HUD_Margin;
         };
         Y_Margins_CR = (Top_HUD_Margin * -1);
@@ -4446,8 +4554,8 @@ void Interface_DrawItemIconTexture(PlayState* play, void* texture, s16 button) {
         X_Margins_CR = 0;
         Y_Margins_CR = 0;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_CD = Right_HUD_Margin;
         };
         Y_Margins_CD = (Top_HUD_Margin * -1);
@@ -4455,8 +4563,8 @@ void Interface_DrawItemIconTexture(PlayState* play, void* texture, s16 button) {
         X_Margins_CD = 0;
         Y_Margins_CD = 0;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDDpadUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_DPad_Items = Right_HUD_Margin;
         };
         Y_Margins_DPad_Items = (Top_HUD_Margin * -1);
@@ -4483,45 +4591,45 @@ void Interface_DrawItemIconTexture(PlayState* play, void* texture, s16 button) {
     };                     //(X,Y) Used with custom position to place it properly.
     s16 ItemIconPos[8][2]; //(X,Y)
     // DPadItems
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) != ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) != ORIGINAL_LOCATION) {
         ItemIconPos[4][1] =
-            CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosY"), 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[0][1]; // Up
+            CVarHandle_GetInteger(&sHUDDpadPosYCVar, 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[0][1]; // Up
         ItemIconPos[5][1] =
-            CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosY"), 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[1][1]; // Down
+            CVarHandle_GetInteger(&sHUDDpadPosYCVar, 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[1][1]; // Down
         ItemIconPos[6][1] =
-            CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosY"), 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[2][1]; // Left
+            CVarHandle_GetInteger(&sHUDDpadPosYCVar, 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[2][1]; // Left
         ItemIconPos[7][1] =
-            CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosY"), 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[3][1]; // Right
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.UseMargins"), 0) != 0) {
+            CVarHandle_GetInteger(&sHUDDpadPosYCVar, 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[3][1]; // Right
+        if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDDpadUseMarginsCVar, 0) != 0) {
                 X_Margins_DPad_Items = Left_HUD_Margin;
             };
-            ItemIconPos[4][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[4][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                             X_Margins_DPad_Items + DPad_ItemsOffset[0][0]);
-            ItemIconPos[5][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[5][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                             X_Margins_DPad_Items + DPad_ItemsOffset[1][0]);
-            ItemIconPos[6][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[6][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                             X_Margins_DPad_Items + DPad_ItemsOffset[2][0]);
-            ItemIconPos[7][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[7][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                             X_Margins_DPad_Items + DPad_ItemsOffset[3][0]);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.UseMargins"), 0) != 0) {
+        } else if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDDpadUseMarginsCVar, 0) != 0) {
                 X_Margins_DPad_Items = Right_HUD_Margin;
             };
-            ItemIconPos[4][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[4][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                              X_Margins_DPad_Items + DPad_ItemsOffset[0][0]);
-            ItemIconPos[5][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[5][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                              X_Margins_DPad_Items + DPad_ItemsOffset[1][0]);
-            ItemIconPos[6][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[6][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                              X_Margins_DPad_Items + DPad_ItemsOffset[2][0]);
-            ItemIconPos[7][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[7][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                              X_Margins_DPad_Items + DPad_ItemsOffset[3][0]);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ANCHOR_NONE) {
-            ItemIconPos[4][0] = CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) + DPad_ItemsOffset[0][0];
-            ItemIconPos[5][0] = CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) + DPad_ItemsOffset[1][0];
-            ItemIconPos[6][0] = CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) + DPad_ItemsOffset[2][0];
-            ItemIconPos[7][0] = CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) + DPad_ItemsOffset[3][0];
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == HIDDEN) {
+        } else if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ANCHOR_NONE) {
+            ItemIconPos[4][0] = CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) + DPad_ItemsOffset[0][0];
+            ItemIconPos[5][0] = CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) + DPad_ItemsOffset[1][0];
+            ItemIconPos[6][0] = CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) + DPad_ItemsOffset[2][0];
+            ItemIconPos[7][0] = CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) + DPad_ItemsOffset[3][0];
+        } else if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == HIDDEN) {
             ItemIconPos[4][0] = -9999;
             ItemIconPos[5][0] = -9999;
             ItemIconPos[6][0] = -9999;
@@ -4538,23 +4646,23 @@ void Interface_DrawItemIconTexture(PlayState* play, void* texture, s16 button) {
         ItemIconPos[7][1] = ItemIconPos_ori[7][1];
     }
     // B Button
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        ItemIconPos[0][1] = CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosY"), 0) + Y_Margins_BtnB;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        ItemIconPos[0][1] = CVarHandle_GetInteger(&sHUDBButtonPosYCVar, 0) + Y_Margins_BtnB;
+        if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_BtnB = Left_HUD_Margin;
             };
             ItemIconPos[0][0] =
-                OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0) + X_Margins_BtnB);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
+                OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0) + X_Margins_BtnB);
+        } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_BtnB = Right_HUD_Margin;
             };
             ItemIconPos[0][0] =
-                OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0) + X_Margins_BtnB);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_NONE) {
-            ItemIconPos[0][0] = CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == HIDDEN) {
+                OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0) + X_Margins_BtnB);
+        } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            ItemIconPos[0][0] = CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0);
+        } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == HIDDEN) {
             ItemIconPos[0][0] = -9999;
         }
     } else {
@@ -4562,23 +4670,23 @@ void Interface_DrawItemIconTexture(PlayState* play, void* texture, s16 button) {
         ItemIconPos[0][1] = ItemIconPos_ori[0][1];
     }
     // C button Left
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        ItemIconPos[1][1] = CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosY"), 0) + Y_Margins_CL;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        ItemIconPos[1][1] = CVarHandle_GetInteger(&sHUDCLeftButtonPosYCVar, 0) + Y_Margins_CL;
+        if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CL = Left_HUD_Margin;
             };
             ItemIconPos[1][0] =
-                OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0) + X_Margins_CL);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
+                OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0) + X_Margins_CL);
+        } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CL = Right_HUD_Margin;
             };
             ItemIconPos[1][0] =
-                OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0) + X_Margins_CL);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_NONE) {
-            ItemIconPos[1][0] = CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == HIDDEN) {
+                OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0) + X_Margins_CL);
+        } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            ItemIconPos[1][0] = CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0);
+        } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == HIDDEN) {
             ItemIconPos[1][0] = -9999;
         }
     } else {
@@ -4586,23 +4694,23 @@ void Interface_DrawItemIconTexture(PlayState* play, void* texture, s16 button) {
         ItemIconPos[1][1] = ItemIconPos_ori[1][1];
     }
     // C Button down
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        ItemIconPos[2][1] = CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosY"), 0) + Y_Margins_CD;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        ItemIconPos[2][1] = CVarHandle_GetInteger(&sHUDCDownButtonPosYCVar, 0) + Y_Margins_CD;
+        if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CD = Left_HUD_Margin;
             };
             ItemIconPos[2][0] =
-                OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0) + X_Margins_CD);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
+                OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0) + X_Margins_CD);
+        } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CD = Right_HUD_Margin;
             };
             ItemIconPos[2][0] =
-                OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0) + X_Margins_CD);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_NONE) {
-            ItemIconPos[2][0] = CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == HIDDEN) {
+                OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0) + X_Margins_CD);
+        } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            ItemIconPos[2][0] = CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0);
+        } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == HIDDEN) {
             ItemIconPos[2][0] = -9999;
         }
     } else {
@@ -4610,23 +4718,23 @@ void Interface_DrawItemIconTexture(PlayState* play, void* texture, s16 button) {
         ItemIconPos[2][1] = ItemIconPos_ori[2][1];
     }
     // C button Right
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        ItemIconPos[3][1] = CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosY"), 0) + Y_Margins_CR;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        ItemIconPos[3][1] = CVarHandle_GetInteger(&sHUDCRightButtonPosYCVar, 0) + Y_Margins_CR;
+        if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CR = Left_HUD_Margin;
             };
             ItemIconPos[3][0] =
-                OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0) + X_Margins_CR);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
+                OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0) + X_Margins_CR);
+        } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CR = Right_HUD_Margin;
             };
             ItemIconPos[3][0] =
-                OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0) + X_Margins_CR);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_NONE) {
-            ItemIconPos[3][0] = CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == HIDDEN) {
+                OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0) + X_Margins_CR);
+        } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            ItemIconPos[3][0] = CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0);
+        } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == HIDDEN) {
             ItemIconPos[3][0] = -9999;
         }
     } else {
@@ -4667,8 +4775,8 @@ void Interface_DrawAmmoCount(PlayState* play, s16 button, s16 alpha) {
     s16 Y_Margins_BtnB;
     s16 X_Margins_DPad_Items;
     s16 Y_Margins_DPad_Items;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_BtnB = Right_HUD_Margin;
         };
         Y_Margins_BtnB = (Top_HUD_Margin * -1);
@@ -4676,8 +4784,8 @@ void Interface_DrawAmmoCount(PlayState* play, s16 button, s16 alpha) {
         X_Margins_BtnB = 0;
         Y_Margins_BtnB = 0;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_CL = Right_HUD_Margin;
         };
         Y_Margins_CL = (Top_HUD_Margin * -1);
@@ -4685,8 +4793,8 @@ void Interface_DrawAmmoCount(PlayState* play, s16 button, s16 alpha) {
         X_Margins_CL = 0;
         Y_Margins_CL = 0;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_CR = Right_HUD_Margin;
         };
         Y_Margins_CR = (Top_HUD_Margin * -1);
@@ -4694,8 +4802,8 @@ void Interface_DrawAmmoCount(PlayState* play, s16 button, s16 alpha) {
         X_Margins_CR = 0;
         Y_Margins_CR = 0;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_CD = Right_HUD_Margin;
         };
         Y_Margins_CD = (Top_HUD_Margin * -1);
@@ -4703,8 +4811,8 @@ void Interface_DrawAmmoCount(PlayState* play, s16 button, s16 alpha) {
         X_Margins_CD = 0;
         Y_Margins_CD = 0;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.UseMargins"), 0) != 0) {
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDDpadUseMarginsCVar, 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ORIGINAL_LOCATION) {
             X_Margins_DPad_Items = Right_HUD_Margin;
         };
         Y_Margins_DPad_Items = (Top_HUD_Margin * -1);
@@ -4730,45 +4838,45 @@ void Interface_DrawAmmoCount(PlayState* play, s16 button, s16 alpha) {
         { 23, 19 }, // Right
     };              //(X,Y) Used with custom position to place it properly.
     // DPadItems
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) != ORIGINAL_LOCATION) {
+    if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) != ORIGINAL_LOCATION) {
         ItemIconPos[4][1] =
-            CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosY"), 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[0][1]; // Up
+            CVarHandle_GetInteger(&sHUDDpadPosYCVar, 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[0][1]; // Up
         ItemIconPos[5][1] =
-            CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosY"), 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[1][1]; // Down
+            CVarHandle_GetInteger(&sHUDDpadPosYCVar, 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[1][1]; // Down
         ItemIconPos[6][1] =
-            CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosY"), 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[2][1]; // Left
+            CVarHandle_GetInteger(&sHUDDpadPosYCVar, 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[2][1]; // Left
         ItemIconPos[7][1] =
-            CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosY"), 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[3][1]; // Right
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.UseMargins"), 0) != 0) {
+            CVarHandle_GetInteger(&sHUDDpadPosYCVar, 0) + Y_Margins_DPad_Items + DPad_ItemsOffset[3][1]; // Right
+        if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDDpadUseMarginsCVar, 0) != 0) {
                 X_Margins_DPad_Items = Left_HUD_Margin;
             };
-            ItemIconPos[4][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[4][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                             X_Margins_DPad_Items + DPad_ItemsOffset[0][0]);
-            ItemIconPos[5][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[5][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                             X_Margins_DPad_Items + DPad_ItemsOffset[1][0]);
-            ItemIconPos[6][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[6][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                             X_Margins_DPad_Items + DPad_ItemsOffset[2][0]);
-            ItemIconPos[7][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[7][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                             X_Margins_DPad_Items + DPad_ItemsOffset[3][0]);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.UseMargins"), 0) != 0) {
+        } else if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDDpadUseMarginsCVar, 0) != 0) {
                 X_Margins_DPad_Items = Right_HUD_Margin;
             };
-            ItemIconPos[4][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[4][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                              X_Margins_DPad_Items + DPad_ItemsOffset[0][0]);
-            ItemIconPos[5][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[5][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                              X_Margins_DPad_Items + DPad_ItemsOffset[1][0]);
-            ItemIconPos[6][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[6][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                              X_Margins_DPad_Items + DPad_ItemsOffset[2][0]);
-            ItemIconPos[7][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+            ItemIconPos[7][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                              X_Margins_DPad_Items + DPad_ItemsOffset[3][0]);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ANCHOR_NONE) {
-            ItemIconPos[4][0] = CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) + DPad_ItemsOffset[0][0];
-            ItemIconPos[5][0] = CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) + DPad_ItemsOffset[1][0];
-            ItemIconPos[6][0] = CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) + DPad_ItemsOffset[2][0];
-            ItemIconPos[7][0] = CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) + DPad_ItemsOffset[3][0];
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == HIDDEN) {
+        } else if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ANCHOR_NONE) {
+            ItemIconPos[4][0] = CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) + DPad_ItemsOffset[0][0];
+            ItemIconPos[5][0] = CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) + DPad_ItemsOffset[1][0];
+            ItemIconPos[6][0] = CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) + DPad_ItemsOffset[2][0];
+            ItemIconPos[7][0] = CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) + DPad_ItemsOffset[3][0];
+        } else if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == HIDDEN) {
             ItemIconPos[4][0] = -9999;
             ItemIconPos[5][0] = -9999;
             ItemIconPos[6][0] = -9999;
@@ -4787,23 +4895,23 @@ void Interface_DrawAmmoCount(PlayState* play, s16 button, s16 alpha) {
     // B Button
     s16 PosX_adjust = 1;
     s16 PosY_adjust = 17;
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        ItemIconPos[0][1] = CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosY"), 0) + Y_Margins_BtnB + PosY_adjust;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        ItemIconPos[0][1] = CVarHandle_GetInteger(&sHUDBButtonPosYCVar, 0) + Y_Margins_BtnB + PosY_adjust;
+        if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_BtnB = Left_HUD_Margin;
             };
-            ItemIconPos[0][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0) +
+            ItemIconPos[0][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0) +
                                                             X_Margins_BtnB + PosX_adjust);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
+        } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_BtnB = Right_HUD_Margin;
             };
-            ItemIconPos[0][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0) +
+            ItemIconPos[0][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0) +
                                                              X_Margins_BtnB + PosX_adjust);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_NONE) {
-            ItemIconPos[0][0] = CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0) + PosX_adjust;
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == HIDDEN) {
+        } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            ItemIconPos[0][0] = CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0) + PosX_adjust;
+        } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == HIDDEN) {
             ItemIconPos[0][0] = -9999;
         }
     } else {
@@ -4811,23 +4919,23 @@ void Interface_DrawAmmoCount(PlayState* play, s16 button, s16 alpha) {
         ItemIconPos[0][1] = ItemIconPos_ori[0][1];
     }
     // C button Left
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        ItemIconPos[1][1] = CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosY"), 0) + Y_Margins_CL + PosY_adjust;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        ItemIconPos[1][1] = CVarHandle_GetInteger(&sHUDCLeftButtonPosYCVar, 0) + Y_Margins_CL + PosY_adjust;
+        if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CL = Left_HUD_Margin;
             };
-            ItemIconPos[1][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0) +
+            ItemIconPos[1][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0) +
                                                             X_Margins_CL + PosX_adjust);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.UseMargins"), 0) != 0) {
+        } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDCLeftButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CL = Right_HUD_Margin;
             };
-            ItemIconPos[1][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0) +
+            ItemIconPos[1][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0) +
                                                              X_Margins_CL + PosX_adjust);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == ANCHOR_NONE) {
-            ItemIconPos[1][0] = CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosX"), 0) + PosX_adjust;
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CLeftButton.PosType"), 0) == HIDDEN) {
+        } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            ItemIconPos[1][0] = CVarHandle_GetInteger(&sHUDCLeftButtonPosXCVar, 0) + PosX_adjust;
+        } else if (CVarHandle_GetInteger(&sHUDCLeftButtonPosTypeCVar, 0) == HIDDEN) {
             ItemIconPos[1][0] = -9999;
         }
     } else {
@@ -4835,23 +4943,23 @@ void Interface_DrawAmmoCount(PlayState* play, s16 button, s16 alpha) {
         ItemIconPos[1][1] = ItemIconPos_ori[1][1];
     }
     // C Button down
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        ItemIconPos[2][1] = CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosY"), 0) + Y_Margins_CD + PosY_adjust;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        ItemIconPos[2][1] = CVarHandle_GetInteger(&sHUDCDownButtonPosYCVar, 0) + Y_Margins_CD + PosY_adjust;
+        if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CD = Left_HUD_Margin;
             };
-            ItemIconPos[2][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0) +
+            ItemIconPos[2][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0) +
                                                             X_Margins_CD + PosX_adjust);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.UseMargins"), 0) != 0) {
+        } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDCDownButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CD = Right_HUD_Margin;
             };
-            ItemIconPos[2][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0) +
+            ItemIconPos[2][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0) +
                                                              X_Margins_CD + PosX_adjust);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == ANCHOR_NONE) {
-            ItemIconPos[2][0] = CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosX"), 0) + PosX_adjust;
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CDownButton.PosType"), 0) == HIDDEN) {
+        } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            ItemIconPos[2][0] = CVarHandle_GetInteger(&sHUDCDownButtonPosXCVar, 0) + PosX_adjust;
+        } else if (CVarHandle_GetInteger(&sHUDCDownButtonPosTypeCVar, 0) == HIDDEN) {
             ItemIconPos[2][0] = -9999;
         }
     } else {
@@ -4859,23 +4967,23 @@ void Interface_DrawAmmoCount(PlayState* play, s16 button, s16 alpha) {
         ItemIconPos[2][1] = ItemIconPos_ori[2][1];
     }
     // C button Right
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) != ORIGINAL_LOCATION) {
-        ItemIconPos[3][1] = CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosY"), 0) + Y_Margins_CR + PosY_adjust;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_LEFT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
+    if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+        ItemIconPos[3][1] = CVarHandle_GetInteger(&sHUDCRightButtonPosYCVar, 0) + Y_Margins_CR + PosY_adjust;
+        if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+            if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CR = Left_HUD_Margin;
             };
-            ItemIconPos[3][0] = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0) +
+            ItemIconPos[3][0] = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0) +
                                                             X_Margins_CR + PosX_adjust);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_RIGHT) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.UseMargins"), 0) != 0) {
+        } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+            if (CVarHandle_GetInteger(&sHUDCRightButtonUseMarginsCVar, 0) != 0) {
                 X_Margins_CR = Right_HUD_Margin;
             };
-            ItemIconPos[3][0] = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0) +
+            ItemIconPos[3][0] = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0) +
                                                              X_Margins_CR + PosX_adjust);
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == ANCHOR_NONE) {
-            ItemIconPos[3][0] = CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosX"), 0) + PosX_adjust;
-        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.CRightButton.PosType"), 0) == HIDDEN) {
+        } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+            ItemIconPos[3][0] = CVarHandle_GetInteger(&sHUDCRightButtonPosXCVar, 0) + PosX_adjust;
+        } else if (CVarHandle_GetInteger(&sHUDCRightButtonPosTypeCVar, 0) == HIDDEN) {
             ItemIconPos[3][0] = -9999;
         }
     } else {
@@ -5101,19 +5209,19 @@ void Interface_Draw(PlayState* play) {
     Color_RGB8 rColor;
 
     Color_RGB8 keyCountColor = { 200, 230, 255 };
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.KeyCount.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDKeyCountChangedCVar, 0)) {
         keyCountColor = CVarGetColor24(CVAR_COSMETIC("HUD.KeyCount.Value"), keyCountColor);
     }
 
     Color_RGB8 dPadColor = { 255, 255, 255 };
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDDpadChangedCVar, 0)) {
         dPadColor = CVarGetColor24(CVAR_COSMETIC("HUD.Dpad.Value"), dPadColor);
     }
 
     Color_RGB8 aButtonColor = { 90, 90, 255 };
-    if (CVarGetInteger(CVAR_COSMETIC("HUD.AButton.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sHUDAButtonChangedCVar, 0)) {
         aButtonColor = CVarGetColor24(CVAR_COSMETIC("HUD.AButton.Value"), aButtonColor);
-    } else if (CVarGetInteger(CVAR_COSMETIC("DefaultColorScheme"), COLORSCHEME_N64) == COLORSCHEME_GAMECUBE) {
+    } else if (CVarHandle_GetInteger(&sDefaultColorSchemeCVar, COLORSCHEME_N64) == COLORSCHEME_GAMECUBE) {
         aButtonColor = (Color_RGB8){ 0, 200, 50 };
     }
 
@@ -5135,7 +5243,7 @@ void Interface_Draw(PlayState* play) {
     s16 svar4;
     s16 svar5;
     s16 svar6;
-    bool fullUi = !CVarGetInteger(CVAR_ENHANCEMENT("MinimalUI"), 0) || !R_MINIMAP_DISABLED || play->pauseCtx.state != 0;
+    bool fullUi = !CVarHandle_GetInteger(&sMinimalUICVar, 0) || !R_MINIMAP_DISABLED || play->pauseCtx.state != 0;
     // #region SOH [NTSC]
     s32 languageOffset = gSaveContext.language;
 
@@ -5169,10 +5277,10 @@ void Interface_Draw(PlayState* play) {
             s16 PosY_RC;
             if (GameInteractor_Should(VB_RENDER_RUPEE_COUNTER, true)) {
                 // Rupee Icon
-                if (CVarGetInteger(CVAR_ENHANCEMENT("DynamicWalletIcon"), 0)) {
+                if (CVarHandle_GetInteger(&sDynamicWalletIconCVar, 0)) {
                     switch (CUR_UPG_VALUE(UPG_WALLET)) {
                         case 0:
-                            if (CVarGetInteger(CVAR_COSMETIC("Consumable.GreenRupee.Changed"), 0)) {
+                            if (CVarHandle_GetInteger(&sConsumableGreenRupeeChangedCVar, 0)) {
                                 rColor =
                                     CVarGetColor24(CVAR_COSMETIC("Consumable.GreenRupee.Value"), rupeeWalletColors[0]);
                             } else {
@@ -5180,7 +5288,7 @@ void Interface_Draw(PlayState* play) {
                             }
                             break;
                         case 1:
-                            if (CVarGetInteger(CVAR_COSMETIC("Consumable.BlueRupee.Changed"), 0)) {
+                            if (CVarHandle_GetInteger(&sConsumableBlueRupeeChangedCVar, 0)) {
                                 rColor =
                                     CVarGetColor24(CVAR_COSMETIC("Consumable.BlueRupee.Value"), rupeeWalletColors[1]);
                             } else {
@@ -5188,7 +5296,7 @@ void Interface_Draw(PlayState* play) {
                             }
                             break;
                         case 2:
-                            if (CVarGetInteger(CVAR_COSMETIC("Consumable.RedRupee.Changed"), 0)) {
+                            if (CVarHandle_GetInteger(&sConsumableRedRupeeChangedCVar, 0)) {
                                 rColor =
                                     CVarGetColor24(CVAR_COSMETIC("Consumable.RedRupee.Value"), rupeeWalletColors[2]);
                             } else {
@@ -5196,7 +5304,7 @@ void Interface_Draw(PlayState* play) {
                             }
                             break;
                         case 3:
-                            if (CVarGetInteger(CVAR_COSMETIC("Consumable.PurpleRupee.Changed"), 0)) {
+                            if (CVarHandle_GetInteger(&sConsumablePurpleRupeeChangedCVar, 0)) {
                                 rColor =
                                     CVarGetColor24(CVAR_COSMETIC("Consumable.PurpleRupee.Value"), rupeeWalletColors[3]);
                             } else {
@@ -5205,7 +5313,7 @@ void Interface_Draw(PlayState* play) {
                             break;
                     }
                 } else {
-                    if (CVarGetInteger(CVAR_COSMETIC("Consumable.GreenRupee.Changed"), rupeeWalletColors)) {
+                    if (CVarHandle_GetInteger(&sConsumableGreenRupeeChangedCVar, rupeeWalletColors)) {
                         rColor = CVarGetColor24(CVAR_COSMETIC("Consumable.GreenRupee.Value"), rupeeWalletColors[0]);
                     } else {
                         rColor = rupeeWalletColors[0];
@@ -5215,8 +5323,8 @@ void Interface_Draw(PlayState* play) {
                 // Rupee icon & counter
                 s16 X_Margins_RC;
                 s16 Y_Margins_RC;
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.UseMargins"), 0) != 0) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.PosType"), 0) == ORIGINAL_LOCATION) {
+                if (CVarHandle_GetInteger(&sHUDRupeesUseMarginsCVar, 0) != 0) {
+                    if (CVarHandle_GetInteger(&sHUDRupeesPosTypeCVar, 0) == ORIGINAL_LOCATION) {
                         X_Margins_RC = Left_HUD_Margin;
                     };
                     Y_Margins_RC = Bottom_HUD_Margin;
@@ -5226,23 +5334,23 @@ void Interface_Draw(PlayState* play) {
                 }
                 s16 PosX_RC_ori = OTRGetRectDimensionFromLeftEdge(26 + X_Margins_RC);
                 s16 PosY_RC_ori = 206 + Y_Margins_RC;
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.PosType"), 0) != ORIGINAL_LOCATION) {
-                    PosY_RC = CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.PosY"), 0) + Y_Margins_RC;
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.PosType"), 0) == ANCHOR_LEFT) {
-                        if (CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.UseMargins"), 0) != 0) {
+                if (CVarHandle_GetInteger(&sHUDRupeesPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+                    PosY_RC = CVarHandle_GetInteger(&sHUDRupeesPosYCVar, 0) + Y_Margins_RC;
+                    if (CVarHandle_GetInteger(&sHUDRupeesPosTypeCVar, 0) == ANCHOR_LEFT) {
+                        if (CVarHandle_GetInteger(&sHUDRupeesUseMarginsCVar, 0) != 0) {
                             X_Margins_RC = Left_HUD_Margin;
                         };
-                        PosX_RC = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.PosX"), 0) +
+                        PosX_RC = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDRupeesPosXCVar, 0) +
                                                               X_Margins_RC);
-                    } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.PosType"), 0) == ANCHOR_RIGHT) {
-                        if (CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.UseMargins"), 0) != 0) {
+                    } else if (CVarHandle_GetInteger(&sHUDRupeesPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                        if (CVarHandle_GetInteger(&sHUDRupeesUseMarginsCVar, 0) != 0) {
                             X_Margins_RC = Right_HUD_Margin;
                         };
-                        PosX_RC = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.PosX"), 0) +
+                        PosX_RC = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDRupeesPosXCVar, 0) +
                                                                X_Margins_RC);
-                    } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.PosType"), 0) == ANCHOR_NONE) {
-                        PosX_RC = CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.PosX"), 0);
-                    } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Rupees.PosType"), 0) == HIDDEN) {
+                    } else if (CVarHandle_GetInteger(&sHUDRupeesPosTypeCVar, 0) == ANCHOR_NONE) {
+                        PosX_RC = CVarHandle_GetInteger(&sHUDRupeesPosXCVar, 0);
+                    } else if (CVarHandle_GetInteger(&sHUDRupeesPosTypeCVar, 0) == HIDDEN) {
                         PosX_RC = -9999;
                     }
                 } else {
@@ -5273,8 +5381,8 @@ void Interface_Draw(PlayState* play) {
                         if (gSaveContext.inventory.dungeonKeys[gSaveContext.mapIndex] >= 0) {
                             s16 X_Margins_SKC;
                             s16 Y_Margins_SKC;
-                            if (CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.UseMargins"), 0) != 0) {
-                                if (CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.PosType"), 0) == ORIGINAL_LOCATION) {
+                            if (CVarHandle_GetInteger(&sHUDSmallKeyUseMarginsCVar, 0) != 0) {
+                                if (CVarHandle_GetInteger(&sHUDSmallKeyPosTypeCVar, 0) == ORIGINAL_LOCATION) {
                                     X_Margins_SKC = Left_HUD_Margin;
                                 };
                                 Y_Margins_SKC = Bottom_HUD_Margin;
@@ -5286,23 +5394,23 @@ void Interface_Draw(PlayState* play) {
                             s16 PosY_SKC_ori = 190 + Y_Margins_SKC;
                             s16 PosX_SKC;
                             s16 PosY_SKC;
-                            if (CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.PosType"), 0) != ORIGINAL_LOCATION) {
-                                PosY_SKC = CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.PosY"), 0) + Y_Margins_SKC;
-                                if (CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.PosType"), 0) == ANCHOR_LEFT) {
-                                    if (CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.UseMargins"), 0) != 0) {
+                            if (CVarHandle_GetInteger(&sHUDSmallKeyPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+                                PosY_SKC = CVarHandle_GetInteger(&sHUDSmallKeyPosYCVar, 0) + Y_Margins_SKC;
+                                if (CVarHandle_GetInteger(&sHUDSmallKeyPosTypeCVar, 0) == ANCHOR_LEFT) {
+                                    if (CVarHandle_GetInteger(&sHUDSmallKeyUseMarginsCVar, 0) != 0) {
                                         X_Margins_SKC = Left_HUD_Margin;
                                     };
                                     PosX_SKC = OTRGetDimensionFromLeftEdge(
-                                        CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.PosX"), 0) + X_Margins_SKC);
-                                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.PosType"), 0) == ANCHOR_RIGHT) {
-                                    if (CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.UseMargins"), 0) != 0) {
+                                        CVarHandle_GetInteger(&sHUDSmallKeyPosXCVar, 0) + X_Margins_SKC);
+                                } else if (CVarHandle_GetInteger(&sHUDSmallKeyPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                                    if (CVarHandle_GetInteger(&sHUDSmallKeyUseMarginsCVar, 0) != 0) {
                                         X_Margins_SKC = Right_HUD_Margin;
                                     };
                                     PosX_SKC = OTRGetDimensionFromRightEdge(
-                                        CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.PosX"), 0) + X_Margins_SKC);
-                                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.PosType"), 0) == ANCHOR_NONE) {
-                                    PosX_SKC = CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.PosX"), 0);
-                                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.SmallKey.PosType"), 0) == HIDDEN) {
+                                        CVarHandle_GetInteger(&sHUDSmallKeyPosXCVar, 0) + X_Margins_SKC);
+                                } else if (CVarHandle_GetInteger(&sHUDSmallKeyPosTypeCVar, 0) == ANCHOR_NONE) {
+                                    PosX_SKC = CVarHandle_GetInteger(&sHUDSmallKeyPosXCVar, 0);
+                                } else if (CVarHandle_GetInteger(&sHUDSmallKeyPosTypeCVar, 0) == HIDDEN) {
                                     PosX_SKC = -9999;
                                 }
                             } else {
@@ -5395,7 +5503,7 @@ void Interface_Draw(PlayState* play) {
             gDPSetEnvColor(OVERLAY_DISP++, 0, 0, 0, 0);
         }
 
-        if (CVarGetInteger(CVAR_ENHANCEMENT("DrawLineupTick"), 0)) {
+        if (CVarHandle_GetInteger(&sDrawLineupTickCVar, 0)) {
             Interface_DrawLineupTick(play);
         }
 
@@ -5406,18 +5514,18 @@ void Interface_Draw(PlayState* play) {
         Minimap_Draw(play);
 
         if ((R_PAUSE_MENU_MODE != 2) && (R_PAUSE_MENU_MODE != 3)) {
-            if (CVarGetInteger(CVAR_ENHANCEMENT("MirroredWorld"), 0)) {
+            if (CVarHandle_GetInteger(&sMirroredWorldCVar, 0)) {
                 gSPMatrix(OVERLAY_DISP++, interfaceCtx->view.projectionFlippedPtr,
                           G_MTX_NOPUSH | G_MTX_LOAD | G_MTX_PROJECTION);
             }
             func_8002C124(&play->actorCtx.targetCtx, play); // Draw Z-Target
-            if (CVarGetInteger(CVAR_ENHANCEMENT("MirroredWorld"), 0)) {
+            if (CVarHandle_GetInteger(&sMirroredWorldCVar, 0)) {
                 gSPMatrix(OVERLAY_DISP++, interfaceCtx->view.projectionPtr,
                           G_MTX_NOPUSH | G_MTX_LOAD | G_MTX_PROJECTION);
             }
 
             // Render enemy health bar after Z-target to leverage set variables
-            if (CVarGetInteger(CVAR_ENHANCEMENT("EnemyHealthBar"), 0)) {
+            if (CVarHandle_GetInteger(&sEnemyHealthBarCVar, 0)) {
                 Interface_DrawEnemyHealthBar(&play->actorCtx.targetCtx, play);
             }
         }
@@ -5471,8 +5579,8 @@ void Interface_Draw(PlayState* play) {
             s16 BbtnPosY;
             s16 X_Margins_BtnB_label;
             s16 Y_Margins_BtnB_label;
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ORIGINAL_LOCATION) {
+            if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
+                if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ORIGINAL_LOCATION) {
                     X_Margins_BtnB_label = Right_HUD_Margin;
                 };
                 Y_Margins_BtnB_label = (Top_HUD_Margin * -1);
@@ -5480,23 +5588,23 @@ void Interface_Draw(PlayState* play) {
                 X_Margins_BtnB_label = 0;
                 Y_Margins_BtnB_label = 0;
             }
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) != ORIGINAL_LOCATION) {
-                BbtnPosY = CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosY"), 0) + Y_Margins_BtnB_label + PosY_adjust;
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_LEFT) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
+            if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+                BbtnPosY = CVarHandle_GetInteger(&sHUDBButtonPosYCVar, 0) + Y_Margins_BtnB_label + PosY_adjust;
+                if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+                    if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
                         X_Margins_BtnB_label = Left_HUD_Margin;
                     };
-                    BbtnPosX = OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0) +
+                    BbtnPosX = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0) +
                                                            X_Margins_BtnB_label + PosX_adjust);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_RIGHT) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.UseMargins"), 0) != 0) {
+                } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                    if (CVarHandle_GetInteger(&sHUDBButtonUseMarginsCVar, 0) != 0) {
                         X_Margins_BtnB_label = Right_HUD_Margin;
                     };
-                    BbtnPosX = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0) +
+                    BbtnPosX = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0) +
                                                             X_Margins_BtnB_label + PosX_adjust);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == ANCHOR_NONE) {
-                    BbtnPosX = CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosX"), 0) + PosX_adjust;
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.BButton.PosType"), 0) == HIDDEN) {
+                } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+                    BbtnPosX = CVarHandle_GetInteger(&sHUDBButtonPosXCVar, 0) + PosX_adjust;
+                } else if (CVarHandle_GetInteger(&sHUDBButtonPosTypeCVar, 0) == HIDDEN) {
                     BbtnPosX = -9999;
                 }
             } else {
@@ -5557,7 +5665,7 @@ void Interface_Draw(PlayState* play) {
             Interface_DrawAmmoCount(play, 3, interfaceCtx->cRightAlpha);
         }
 
-        if (CVarGetInteger(CVAR_ENHANCEMENT("DpadEquips"), 0) != 0) {
+        if (CVarHandle_GetInteger(&sDpadEquipsCVar, 0) != 0) {
             // DPad is only greyed-out when all 4 DPad directions are too
             uint16_t dpadAlpha =
                 MAX(MAX(MAX(interfaceCtx->dpadUpAlpha, interfaceCtx->dpadDownAlpha), interfaceCtx->dpadLeftAlpha),
@@ -5568,8 +5676,8 @@ void Interface_Draw(PlayState* play) {
             s16 DpadPosY;
             s16 X_Margins_Dpad;
             s16 Y_Margins_Dpad;
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.UseMargins"), 0) != 0) {
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ORIGINAL_LOCATION) {
+            if (CVarHandle_GetInteger(&sHUDDpadUseMarginsCVar, 0) != 0) {
+                if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ORIGINAL_LOCATION) {
                     X_Margins_Dpad = Right_HUD_Margin;
                 };
                 Y_Margins_Dpad = (Top_HUD_Margin * -1);
@@ -5577,23 +5685,23 @@ void Interface_Draw(PlayState* play) {
                 Y_Margins_Dpad = 0;
                 X_Margins_Dpad = 0;
             }
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) != ORIGINAL_LOCATION) {
-                DpadPosY = CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosY"), 0) + Y_Margins_Dpad;
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ANCHOR_LEFT) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.UseMargins"), 0) != 0) {
+            if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+                DpadPosY = CVarHandle_GetInteger(&sHUDDpadPosYCVar, 0) + Y_Margins_Dpad;
+                if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ANCHOR_LEFT) {
+                    if (CVarHandle_GetInteger(&sHUDDpadUseMarginsCVar, 0) != 0) {
                         X_Margins_Dpad = Left_HUD_Margin;
                     };
                     DpadPosX =
-                        OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) + X_Margins_Dpad);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ANCHOR_RIGHT) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.UseMargins"), 0) != 0) {
+                        OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) + X_Margins_Dpad);
+                } else if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                    if (CVarHandle_GetInteger(&sHUDDpadUseMarginsCVar, 0) != 0) {
                         X_Margins_Dpad = Right_HUD_Margin;
                     };
-                    DpadPosX = OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0) +
+                    DpadPosX = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0) +
                                                             X_Margins_Dpad);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == ANCHOR_NONE) {
-                    DpadPosX = CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosX"), 0);
-                } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Dpad.PosType"), 0) == HIDDEN) {
+                } else if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == ANCHOR_NONE) {
+                    DpadPosX = CVarHandle_GetInteger(&sHUDDpadPosXCVar, 0);
+                } else if (CVarHandle_GetInteger(&sHUDDpadPosTypeCVar, 0) == HIDDEN) {
                     DpadPosX = -9999;
                 }
             } else {
@@ -5661,7 +5769,7 @@ void Interface_Draw(PlayState* play) {
         Gfx_SetupDL_42Overlay(play->state.gfxCtx);
         s16 X_Margins_BtnA;
         s16 Y_Margins_BtnA;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.AButton.UseMargins"), 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDAButtonUseMarginsCVar, 0) != 0) {
             X_Margins_BtnA = Right_HUD_Margin;
             Y_Margins_BtnA = (Top_HUD_Margin * -1);
         } else {
@@ -5676,29 +5784,27 @@ void Interface_Draw(PlayState* play) {
         s16 PosY_BtnA;
         s16 rAIconX;
         s16 rAIconY;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosType"), 0) != ORIGINAL_LOCATION) {
-            PosY_BtnA = CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosY"), 0) + Y_Margins_BtnA;
+        if (CVarHandle_GetInteger(&sHUDAButtonPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+            PosY_BtnA = CVarHandle_GetInteger(&sHUDAButtonPosYCVar, 0) + Y_Margins_BtnA;
             rAIconY = 98.0f - PosY_BtnA;
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosType"), 0) == ANCHOR_LEFT) {
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.AButton.UseMargins"), 0) != 0) {
+            if (CVarHandle_GetInteger(&sHUDAButtonPosTypeCVar, 0) == ANCHOR_LEFT) {
+                if (CVarHandle_GetInteger(&sHUDAButtonUseMarginsCVar, 0) != 0) {
                     X_Margins_BtnA = Left_HUD_Margin;
                 };
                 PosX_BtnA =
-                    OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosX"), 0) + X_Margins_BtnA);
-                rAIconX =
-                    OTRGetDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosX"), 0) + X_Margins_BtnA);
-            } else if (CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosType"), 0) == ANCHOR_RIGHT) {
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.AButton.UseMargins"), 0) != 0) {
+                    OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDAButtonPosXCVar, 0) + X_Margins_BtnA);
+                rAIconX = OTRGetDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDAButtonPosXCVar, 0) + X_Margins_BtnA);
+            } else if (CVarHandle_GetInteger(&sHUDAButtonPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                if (CVarHandle_GetInteger(&sHUDAButtonUseMarginsCVar, 0) != 0) {
                     X_Margins_BtnA = Right_HUD_Margin;
                 };
                 PosX_BtnA =
-                    OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosX"), 0) + X_Margins_BtnA);
-                rAIconX =
-                    OTRGetDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosX"), 0) + X_Margins_BtnA);
-            } else if (CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosType"), 0) == ANCHOR_NONE) {
-                PosX_BtnA = CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosX"), 0);
-                rAIconX = CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosX"), 0);
-            } else if (CVarGetInteger(CVAR_COSMETIC("HUD.AButton.PosType"), 0) == HIDDEN) {
+                    OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDAButtonPosXCVar, 0) + X_Margins_BtnA);
+                rAIconX = OTRGetDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDAButtonPosXCVar, 0) + X_Margins_BtnA);
+            } else if (CVarHandle_GetInteger(&sHUDAButtonPosTypeCVar, 0) == ANCHOR_NONE) {
+                PosX_BtnA = CVarHandle_GetInteger(&sHUDAButtonPosXCVar, 0);
+                rAIconX = CVarHandle_GetInteger(&sHUDAButtonPosXCVar, 0);
+            } else if (CVarHandle_GetInteger(&sHUDAButtonPosTypeCVar, 0) == HIDDEN) {
                 PosX_BtnA = -9999;
                 rAIconX = -9999;
             }
@@ -5791,7 +5897,7 @@ void Interface_Draw(PlayState* play) {
         if ((play->pauseCtx.state == 0) && (play->pauseCtx.debugState == 0)) {
             if (gSaveContext.minigameState != 1) {
                 // Carrots rendering if the action corresponds to riding a horse
-                if (interfaceCtx->unk_1EE == 8 && !CVarGetInteger(CVAR_CHEAT("InfiniteEponaBoost"), 0)) {
+                if (interfaceCtx->unk_1EE == 8 && !CVarHandle_GetInteger(&sInfiniteEponaBoostCVar, 0)) {
                     // Load Carrot Icon
                     gDPLoadTextureBlock(OVERLAY_DISP++, gCarrotIconTex, G_IM_FMT_RGBA, G_IM_SIZ_32b, 16, 16, 0,
                                         G_TX_NOMIRROR | G_TX_WRAP, G_TX_NOMIRROR | G_TX_WRAP, G_TX_NOMASK, G_TX_NOMASK,
@@ -5801,23 +5907,23 @@ void Interface_Draw(PlayState* play) {
                     s16 CarrotsPosX = ZREG(14);
                     s16 CarrotsPosY = ZREG(15);
                     s16 CarrotsMargins_X = 0;
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.Carrots.PosType"), 0) != ORIGINAL_LOCATION) {
-                        CarrotsPosY = CVarGetInteger(CVAR_COSMETIC("HUD.Carrots.PosY"), 0);
-                        if (CVarGetInteger(CVAR_COSMETIC("HUD.Carrots.PosType"), 0) == ANCHOR_LEFT) {
-                            if (CVarGetInteger(CVAR_COSMETIC("HUD.Carrots.UseMargins"), 0) != 0) {
+                    if (CVarHandle_GetInteger(&sHUDCarrotsPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+                        CarrotsPosY = CVarHandle_GetInteger(&sHUDCarrotsPosYCVar, 0);
+                        if (CVarHandle_GetInteger(&sHUDCarrotsPosTypeCVar, 0) == ANCHOR_LEFT) {
+                            if (CVarHandle_GetInteger(&sHUDCarrotsUseMarginsCVar, 0) != 0) {
                                 CarrotsMargins_X = Left_HUD_Margin;
                             };
                             CarrotsPosX = OTRGetDimensionFromLeftEdge(
-                                CVarGetInteger(CVAR_COSMETIC("HUD.Carrots.PosX"), 0) + CarrotsMargins_X);
-                        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Carrots.PosType"), 0) == ANCHOR_RIGHT) {
-                            if (CVarGetInteger(CVAR_COSMETIC("HUD.Carrots.UseMargins"), 0) != 0) {
+                                CVarHandle_GetInteger(&sHUDCarrotsPosXCVar, 0) + CarrotsMargins_X);
+                        } else if (CVarHandle_GetInteger(&sHUDCarrotsPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                            if (CVarHandle_GetInteger(&sHUDCarrotsUseMarginsCVar, 0) != 0) {
                                 CarrotsMargins_X = Right_HUD_Margin;
                             };
                             CarrotsPosX = OTRGetDimensionFromRightEdge(
-                                CVarGetInteger(CVAR_COSMETIC("HUD.Carrots.PosX"), 0) + CarrotsMargins_X);
-                        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Carrots.PosType"), 0) == ANCHOR_NONE) {
-                            CarrotsPosX = CVarGetInteger(CVAR_COSMETIC("HUD.Carrots.PosX"), 0);
-                        } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Carrots.PosType"), 0) == HIDDEN) {
+                                CVarHandle_GetInteger(&sHUDCarrotsPosXCVar, 0) + CarrotsMargins_X);
+                        } else if (CVarHandle_GetInteger(&sHUDCarrotsPosTypeCVar, 0) == ANCHOR_NONE) {
+                            CarrotsPosX = CVarHandle_GetInteger(&sHUDCarrotsPosXCVar, 0);
+                        } else if (CVarHandle_GetInteger(&sHUDCarrotsPosTypeCVar, 0) == HIDDEN) {
                             CarrotsPosX = -9999;
                         }
                     }
@@ -5836,8 +5942,8 @@ void Interface_Draw(PlayState* play) {
             } else {
                 // Score for the Horseback Archery
                 s32 X_Margins_Archery;
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.UseMargins"), 0) != 0) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.PosType"), 0) == ORIGINAL_LOCATION) {
+                if (CVarHandle_GetInteger(&sHUDArcheryScoreUseMarginsCVar, 0) != 0) {
+                    if (CVarHandle_GetInteger(&sHUDArcheryScorePosTypeCVar, 0) == ORIGINAL_LOCATION) {
                         X_Margins_Archery = Right_HUD_Margin;
                     };
                 } else {
@@ -5846,24 +5952,23 @@ void Interface_Draw(PlayState* play) {
                 s16 ArcheryPos_Y = ZREG(15);
                 s16 ArcheryPos_X = OTRGetRectDimensionFromRightEdge(WREG(32) + X_Margins_Archery);
 
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.PosType"), 0) != ORIGINAL_LOCATION) {
-                    ArcheryPos_Y = CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.PosY"), 0);
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.PosType"), 0) == ANCHOR_LEFT) {
-                        if (CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.UseMargins"), 0) != 0) {
+                if (CVarHandle_GetInteger(&sHUDArcheryScorePosTypeCVar, 0) != ORIGINAL_LOCATION) {
+                    ArcheryPos_Y = CVarHandle_GetInteger(&sHUDArcheryScorePosYCVar, 0);
+                    if (CVarHandle_GetInteger(&sHUDArcheryScorePosTypeCVar, 0) == ANCHOR_LEFT) {
+                        if (CVarHandle_GetInteger(&sHUDArcheryScoreUseMarginsCVar, 0) != 0) {
                             X_Margins_Archery = Left_HUD_Margin;
                         };
                         ArcheryPos_X = OTRGetRectDimensionFromLeftEdge(
-                            CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.PosX"), 0) + X_Margins_Archery);
-                    } else if (CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.PosType"), 0) == ANCHOR_RIGHT) {
-                        if (CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.UseMargins"), 0) != 0) {
+                            CVarHandle_GetInteger(&sHUDArcheryScorePosXCVar, 0) + X_Margins_Archery);
+                    } else if (CVarHandle_GetInteger(&sHUDArcheryScorePosTypeCVar, 0) == ANCHOR_RIGHT) {
+                        if (CVarHandle_GetInteger(&sHUDArcheryScoreUseMarginsCVar, 0) != 0) {
                             X_Margins_Archery = Right_HUD_Margin;
                         };
                         ArcheryPos_X = OTRGetRectDimensionFromRightEdge(
-                            CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.PosX"), 0) + X_Margins_Archery);
-                    } else if (CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.PosType"), 0) == ANCHOR_NONE) {
-                        ArcheryPos_X =
-                            CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.PosX"), 0) + 204 + X_Margins_Archery;
-                    } else if (CVarGetInteger(CVAR_COSMETIC("HUD.ArcheryScore.PosType"), 0) == HIDDEN) {
+                            CVarHandle_GetInteger(&sHUDArcheryScorePosXCVar, 0) + X_Margins_Archery);
+                    } else if (CVarHandle_GetInteger(&sHUDArcheryScorePosTypeCVar, 0) == ANCHOR_NONE) {
+                        ArcheryPos_X = CVarHandle_GetInteger(&sHUDArcheryScorePosXCVar, 0) + 204 + X_Margins_Archery;
+                    } else if (CVarHandle_GetInteger(&sHUDArcheryScorePosTypeCVar, 0) == HIDDEN) {
                         ArcheryPos_X = -9999;
                     }
                 }
@@ -6294,8 +6399,8 @@ void Interface_Draw(PlayState* play) {
                 gDPSetPrimColor(OVERLAY_DISP++, 0, 0, 255, 255, 255, 255);
                 gDPSetEnvColor(OVERLAY_DISP++, 0, 0, 0, 0);
                 s32 X_Margins_Timer;
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.Timers.UseMargins"), 0) != 0) {
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.Timers.PosType"), 0) == ORIGINAL_LOCATION) {
+                if (CVarHandle_GetInteger(&sHUDTimersUseMarginsCVar, 0) != 0) {
+                    if (CVarHandle_GetInteger(&sHUDTimersPosTypeCVar, 0) == ORIGINAL_LOCATION) {
                         X_Margins_Timer = Left_HUD_Margin;
                     };
                 } else {
@@ -6303,23 +6408,23 @@ void Interface_Draw(PlayState* play) {
                 }
                 svar5 = OTRGetRectDimensionFromLeftEdge(gSaveContext.timerX[svar6] + X_Margins_Timer);
                 svar2 = gSaveContext.timerY[svar6];
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.Timers.PosType"), 0) != ORIGINAL_LOCATION) {
-                    svar2 = (CVarGetInteger(CVAR_COSMETIC("HUD.Timers.PosY"), 0));
-                    if (CVarGetInteger(CVAR_COSMETIC("HUD.Timers.PosType"), 0) == ANCHOR_LEFT) {
-                        if (CVarGetInteger(CVAR_COSMETIC("HUD.Timers.UseMargins"), 0) != 0) {
+                if (CVarHandle_GetInteger(&sHUDTimersPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+                    svar2 = (CVarHandle_GetInteger(&sHUDTimersPosYCVar, 0));
+                    if (CVarHandle_GetInteger(&sHUDTimersPosTypeCVar, 0) == ANCHOR_LEFT) {
+                        if (CVarHandle_GetInteger(&sHUDTimersUseMarginsCVar, 0) != 0) {
                             X_Margins_Timer = Left_HUD_Margin;
                         };
-                        svar5 = OTRGetRectDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Timers.PosX"), 0) +
+                        svar5 = OTRGetRectDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDTimersPosXCVar, 0) +
                                                                 X_Margins_Timer);
-                    } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Timers.PosType"), 0) == ANCHOR_RIGHT) {
-                        if (CVarGetInteger(CVAR_COSMETIC("HUD.Timers.UseMargins"), 0) != 0) {
+                    } else if (CVarHandle_GetInteger(&sHUDTimersPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                        if (CVarHandle_GetInteger(&sHUDTimersUseMarginsCVar, 0) != 0) {
                             X_Margins_Timer = Right_HUD_Margin;
                         };
-                        svar5 = OTRGetRectDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.Timers.PosX"), 0) +
+                        svar5 = OTRGetRectDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDTimersPosXCVar, 0) +
                                                                  X_Margins_Timer);
-                    } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Timers.PosType"), 0) == ANCHOR_NONE) {
-                        svar5 = CVarGetInteger(CVAR_COSMETIC("HUD.Timers.PosX"), 0) + 204 + X_Margins_Timer;
-                    } else if (CVarGetInteger(CVAR_COSMETIC("HUD.Timers.PosType"), 0) == HIDDEN) {
+                    } else if (CVarHandle_GetInteger(&sHUDTimersPosTypeCVar, 0) == ANCHOR_NONE) {
+                        svar5 = CVarHandle_GetInteger(&sHUDTimersPosXCVar, 0) + 204 + X_Margins_Timer;
+                    } else if (CVarHandle_GetInteger(&sHUDTimersPosTypeCVar, 0) == HIDDEN) {
                         svar5 = -9999;
                     }
                 }
@@ -6377,34 +6482,34 @@ void Interface_Draw(PlayState* play) {
 void Interface_DrawTotalGameplayTimer(PlayState* play) {
     // Draw timer based on the Gameplay Stats total time.
     if (GameInteractor_Should(VB_SHOW_GAMEPLAY_TIMER,
-                              CVarGetInteger(CVAR_GAMEPLAY_STATS("ShowIngameTimer"), 0) && gSaveContext.fileNum >= 0 &&
+                              CVarHandle_GetInteger(&sShowIngameTimerCVar, 0) && gSaveContext.fileNum >= 0 &&
                                   gSaveContext.fileNum <= 2,
                               play)) {
         s32 X_Margins_Timer = 0;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.IGT.UseMargins"), 0) != 0) {
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.IGT.PosType"), 0) == ORIGINAL_LOCATION) {
+        if (CVarHandle_GetInteger(&sHUDIGTUseMarginsCVar, 0) != 0) {
+            if (CVarHandle_GetInteger(&sHUDIGTPosTypeCVar, 0) == ORIGINAL_LOCATION) {
                 X_Margins_Timer = Left_HUD_Margin;
             };
         }
         s32 rectLeftOri = OTRGetRectDimensionFromLeftEdge(24 + X_Margins_Timer);
         s32 rectTopOri = 73;
-        if (CVarGetInteger(CVAR_COSMETIC("HUD.IGT.PosType"), 0) != ORIGINAL_LOCATION) {
-            rectTopOri = (CVarGetInteger(CVAR_COSMETIC("HUD.IGT.PosY"), 0));
-            if (CVarGetInteger(CVAR_COSMETIC("HUD.IGT.PosType"), 0) == ANCHOR_LEFT) {
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.IGT.UseMargins"), 0) != 0) {
+        if (CVarHandle_GetInteger(&sHUDIGTPosTypeCVar, 0) != ORIGINAL_LOCATION) {
+            rectTopOri = (CVarHandle_GetInteger(&sHUDIGTPosYCVar, 0));
+            if (CVarHandle_GetInteger(&sHUDIGTPosTypeCVar, 0) == ANCHOR_LEFT) {
+                if (CVarHandle_GetInteger(&sHUDIGTUseMarginsCVar, 0) != 0) {
                     X_Margins_Timer = Left_HUD_Margin;
                 };
                 rectLeftOri =
-                    OTRGetRectDimensionFromLeftEdge(CVarGetInteger(CVAR_COSMETIC("HUD.IGT.PosX"), 0) + X_Margins_Timer);
-            } else if (CVarGetInteger(CVAR_COSMETIC("HUD.IGT.PosType"), 0) == ANCHOR_RIGHT) {
-                if (CVarGetInteger(CVAR_COSMETIC("HUD.IGT.UseMargins"), 0) != 0) {
+                    OTRGetRectDimensionFromLeftEdge(CVarHandle_GetInteger(&sHUDIGTPosXCVar, 0) + X_Margins_Timer);
+            } else if (CVarHandle_GetInteger(&sHUDIGTPosTypeCVar, 0) == ANCHOR_RIGHT) {
+                if (CVarHandle_GetInteger(&sHUDIGTUseMarginsCVar, 0) != 0) {
                     X_Margins_Timer = Right_HUD_Margin;
                 };
-                rectLeftOri = OTRGetRectDimensionFromRightEdge(CVarGetInteger(CVAR_COSMETIC("HUD.IGT.PosX"), 0) +
+                rectLeftOri = OTRGetRectDimensionFromRightEdge(CVarHandle_GetInteger(&sHUDIGTPosXCVar, 0) +
                                                                X_Margins_Timer);
-            } else if (CVarGetInteger(CVAR_COSMETIC("HUD.IGT.PosType"), 0) == ANCHOR_NONE) {
-                rectLeftOri = CVarGetInteger(CVAR_COSMETIC("HUD.IGT.PosX"), 0) + 204 + X_Margins_Timer;
-            } else if (CVarGetInteger(CVAR_COSMETIC("HUD.IGT.PosType"), 0) == HIDDEN) {
+            } else if (CVarHandle_GetInteger(&sHUDIGTPosTypeCVar, 0) == ANCHOR_NONE) {
+                rectLeftOri = CVarHandle_GetInteger(&sHUDIGTPosXCVar, 0) + 204 + X_Margins_Timer;
+            } else if (CVarHandle_GetInteger(&sHUDIGTPosTypeCVar, 0) == HIDDEN) {
                 rectLeftOri = -9999;
             }
         }
@@ -6492,10 +6597,10 @@ void Interface_Update(PlayState* play) {
     u16 action;
     Input* debugInput = &play->state.input[2];
 
-    Top_HUD_Margin = CVarGetInteger(CVAR_COSMETIC("HUD.Margin.T"), 0);
-    Left_HUD_Margin = CVarGetInteger(CVAR_COSMETIC("HUD.Margin.L"), 0);
-    Right_HUD_Margin = CVarGetInteger(CVAR_COSMETIC("HUD.Margin.R"), 0);
-    Bottom_HUD_Margin = CVarGetInteger(CVAR_COSMETIC("HUD.Margin.B"), 0);
+    Top_HUD_Margin = CVarHandle_GetInteger(&sHUDMarginTCVar, 0);
+    Left_HUD_Margin = CVarHandle_GetInteger(&sHUDMarginLCVar, 0);
+    Right_HUD_Margin = CVarHandle_GetInteger(&sHUDMarginRCVar, 0);
+    Bottom_HUD_Margin = CVarHandle_GetInteger(&sHUDMarginBCVar, 0);
 
     GameInteractor_ExecuteOnInterfaceUpdate();
 
@@ -6654,12 +6759,12 @@ void Interface_Update(PlayState* play) {
 
     if (D_80125A58 == 1) {
         if (CUR_EQUIP_VALUE(EQUIP_TYPE_TUNIC) == EQUIP_VALUE_TUNIC_GORON ||
-            CVarGetInteger(CVAR_CHEAT("SuperTunic"), 0) != 0) {
+            CVarHandle_GetInteger(&sSuperTunicCVar, 0) != 0) {
             D_80125A58 = 0;
         }
     } else if ((Player_GetEnvironmentalHazard(play) >= 2) && (Player_GetEnvironmentalHazard(play) < 5)) {
         if (CUR_EQUIP_VALUE(EQUIP_TYPE_TUNIC) == EQUIP_VALUE_TUNIC_ZORA ||
-            CVarGetInteger(CVAR_CHEAT("SuperTunic"), 0) != 0) {
+            CVarHandle_GetInteger(&sSuperTunicCVar, 0) != 0) {
             D_80125A58 = 0;
         }
     }
@@ -15,6 +15,8 @@
 #include "soh/ResourceManagerHelpers.h"
 #include "soh/SaveManager.h"
 #include "soh/framebuffer_effects.h"
+#include "soh/Enhancements/debugger/frameProfiler.h"
+#include "soh/Enhancements/debugger/replayHarness.h"
 
 #include <libultraship/libultraship.h>
 
@@ -1197,10 +1199,14 @@ void Play_Update(PlayState* play) {
                     func_800973FC(play, &play->roomCtx);
 
                     PLAY_LOG(3612);
+                    FRAME_PROFILER_BEGIN("CollisionCheck_AT");
                     CollisionCheck_AT(play, &play->colChkCtx);
+                    FRAME_PROFILER_END();
 
                     PLAY_LOG(3618);
+                    FRAME_PROFILER_BEGIN("CollisionCheck_OC");
                     CollisionCheck_OC(play, &play->colChkCtx);
+                    FRAME_PROFILER_END();
 
                     PLAY_LOG(3624);
                     CollisionCheck_Damage(play, &play->colChkCtx);
@@ -1211,7 +1217,9 @@ void Play_Update(PlayState* play) {
                     PLAY_LOG(3637);
 
                     if (!play->unk_11DE9) {
+                        FRAME_PROFILER_BEGIN("Actor_UpdateAll");
                         Actor_UpdateAll(play, &play->actorCtx);
+                        FRAME_PROFILER_END();
                     }
 
                     PLAY_LOG(3643);
@@ -1563,7 +1571,9 @@ void Play_Draw(PlayState* play) {
         }
 
         if ((HREG(80) != 10) || (HREG(85) != 0)) {
+            FRAME_PROFILER_BEGIN("func_800315AC");
             func_800315AC(play, &play->actorCtx);
+            FRAME_PROFILER_END();
         }
 
         if ((HREG(80) != 10) || (HREG(86) != 0)) {
@@ -1721,13 +1731,21 @@ void Play_Main(GameState* thisx) {
     }
 
     if ((HREG(80) != 10) || (HREG(81) != 0)) {
+        FRAME_PROFILER_BEGIN("Play_Update");
+        ReplayHarness_BeginPhase(REPLAY_PHASE_UPDATE);
         Play_Update(play);
+        ReplayHarness_EndPhase(REPLAY_PHASE_UPDATE);
+        FRAME_PROFILER_END();
     }
 
     PLAY_LOG(4583);
 
     FrameInterpolation_StartRecord();
+    FRAME_PROFILER_BEGIN("Play_Draw");
+    ReplayHarness_BeginPhase(REPLAY_PHASE_DRAW);
     Play_Draw(play);
+    ReplayHarness_EndPhase(REPLAY_PHASE_DRAW);
+    FRAME_PROFILER_END();
     FrameInterpolation_StopRecord();
 
     PLAY_LOG(4587);
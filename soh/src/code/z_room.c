@@ -234,16 +234,15 @@ void func_80095D04(PlayState* play, Room* room, u32 flags) {
 s32 swapAndConvertJPEG(void* data) {
     OSTime time;
     if (BE32SWAP(*(u32*)data) == JPEG_MARKER) {
-        size_t size = 320 * 240 * 2;
-
-        char* decodedJpeg = ResourceMgr_LoadJPEG(data, size);
-
         osSyncPrintf("Expanding jpeg data\n");
         osSyncPrintf("Work buffer address (Z buffer) %08x\n", gZBuffer);
 
         time = osGetTime();
 
-        memcpy(data, decodedJpeg, size);
+        // Decodes (or fetches the cached decode of) the JPEG and writes it back over the original buffer
+        if (!ResourceMgr_LoadJPEG(data, BACKGROUND_BUFFER_SIZE, data, BACKGROUND_BUFFER_SIZE)) {
+            return 0;
+        }
         time = osGetTime() - time;
 
         osSyncPrintf("Success... I think. time = %6.3f ms", OS_CYCLES_TO_USEC(time) / 1000.0f);
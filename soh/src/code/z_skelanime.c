@@ -5,9 +5,13 @@
 #include <assert.h>
 #include "soh/ResourceManagerHelpers.h"
 #include "soh/Enhancements/game-interactor/GameInteractor_Hooks.h"
+#include "soh/CVarHandle.h"
 
 #define ANIM_INTERP 1
 
+// Read on every LOD skeleton draw
+static CVarHandle sDisableLODCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("DisableLOD"));
+
 s32 LinkAnimation_Loop(PlayState* play, SkelAnime* skelAnime);
 s32 LinkAnimation_Once(PlayState* play, SkelAnime* skelAnime);
 s32 SkelAnime_LoopFull(SkelAnime* skelAnime);
@@ -80,7 +84,7 @@ void SkelAnime_DrawLod(PlayState* play, void** skeleton, Vec3s* jointTable, Over
     Vec3f pos;
     Vec3s rot;
 
-    if (CVarGetInteger(CVAR_ENHANCEMENT("DisableLOD"), 0)) {
+    if (CVarHandle_GetInteger(&sDisableLODCVar, 0)) {
         lod = 0;
     }
 
@@ -198,7 +202,7 @@ void SkelAnime_DrawFlexLod(PlayState* play, void** skeleton, Vec3s* jointTable,
     Vec3s rot;
     Mtx* mtx = Graph_Alloc(play->state.gfxCtx, dListCount * sizeof(Mtx));
 
-    if (CVarGetInteger(CVAR_ENHANCEMENT("DisableLOD"), 0)) {
+    if (CVarHandle_GetInteger(&sDisableLODCVar, 0)) {
         lod = 0;
     }
 
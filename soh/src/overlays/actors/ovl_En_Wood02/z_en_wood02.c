@@ -7,6 +7,7 @@
 #include "z_en_wood02.h"
 #include "objects/object_wood02/object_wood02.h"
 #include "soh/Enhancements/game-interactor/GameInteractor_Hooks.h"
+#include "soh/CVarHandle.h"
 
 #define FLAGS 0
 
@@ -99,14 +100,18 @@ static f32 sSpawnCos;
 
 static f32 sSpawnSin;
 
+// Read for every tree of a spawner on every update, so resolved once through CVarHandle
+static CVarHandle sDisableDrawDistanceCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("DisableDrawDistance"));
+static CVarHandle sWidescreenActorCullingCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("WidescreenActorCulling"));
+
 s32 EnWood02_SpawnZoneCheck(EnWood02* this, PlayState* play, Vec3f* pos) {
     f32 phi_f12;
 
     SkinMatrix_Vec3fMtxFMultXYZW(&play->viewProjectionMtxF, pos, &this->actor.projectedPos, &this->actor.projectedW);
 
     // #region SOH [Enhancement] Use the extended culling calculation
-    if (CVarGetInteger(CVAR_ENHANCEMENT("DisableDrawDistance"), 1) > 1 ||
-        CVarGetInteger(CVAR_ENHANCEMENT("WidescreenActorCulling"), 0)) {
+    if (CVarHandle_GetInteger(&sDisableDrawDistanceCVar, 1) > 1 ||
+        CVarHandle_GetInteger(&sWidescreenActorCullingCVar, 0)) {
         bool shipShouldDraw = false;
         bool shipShouldUpdate = false;
         return Ship_CalcShouldDrawAndUpdate(play, &this->actor, &this->actor.projectedPos, this->actor.projectedW,
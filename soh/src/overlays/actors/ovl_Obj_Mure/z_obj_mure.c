@@ -5,6 +5,7 @@
  */
 
 #include "z_obj_mure.h"
+#include "soh/CVarHandle.h"
 
 #define FLAGS 0
 
@@ -53,6 +54,9 @@ static s16 sSpawnActorIds[] = { ACTOR_EN_KUSA, 0, ACTOR_EN_FISH, ACTOR_EN_INSECT
 
 static s16 sSpawnParams[] = { 0, 2, -1, 0, -1 };
 
+// Read on every update, so resolved once through CVarHandle
+static CVarHandle sDisableDrawDistanceCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("DisableDrawDistance"));
+
 static InitChainEntry sInitChain[] = {
     ICHAIN_F32(uncullZoneForward, 1200, ICHAIN_CONTINUE),
     ICHAIN_F32(uncullZoneScale, 200, ICHAIN_CONTINUE),
@@ -275,7 +279,7 @@ void ObjMure_InitialAction(ObjMure* this, PlayState* play) {
 
 void ObjMure_CulledState(ObjMure* this, PlayState* play) {
     // #region SOH [Enhancements] Extended draw distance
-    s32 distanceMultiplier = CVarGetInteger(CVAR_ENHANCEMENT("DisableDrawDistance"), 1);
+    s32 distanceMultiplier = CVarHandle_GetInteger(&sDisableDrawDistanceCVar, 1);
     distanceMultiplier = MAX(distanceMultiplier, 1);
 
     if (fabsf(this->actor.projectedPos.z) < sZClip[this->type] * distanceMultiplier) {
@@ -404,7 +408,7 @@ void ObjMure_ActiveState(ObjMure* this, PlayState* play) {
     ObjMure_CheckChildren(this, play);
 
     // #region SOH [Enhancements] Extended draw distance
-    s32 distanceMultiplier = CVarGetInteger(CVAR_ENHANCEMENT("DisableDrawDistance"), 1);
+    s32 distanceMultiplier = CVarHandle_GetInteger(&sDisableDrawDistanceCVar, 1);
     distanceMultiplier = MAX(distanceMultiplier, 1);
 
     if ((sZClip[this->type] + 40.0f) * distanceMultiplier <= fabsf(this->actor.projectedPos.z)) {
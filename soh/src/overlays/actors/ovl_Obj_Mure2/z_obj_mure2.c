@@ -6,6 +6,7 @@
 
 #include "z_obj_mure2.h"
 #include "soh/OTRGlobals.h"
+#include "soh/CVarHandle.h"
 
 #define FLAGS 0
 
@@ -50,6 +51,10 @@ static s16 D_80B9A818[] = { 9, 12, 8 };
 
 static s16 sActorSpawnIDs[] = { ACTOR_EN_KUSA, ACTOR_EN_KUSA, ACTOR_EN_ISHI };
 
+// Read on every update, so resolved once through CVarHandle
+static CVarHandle sDisableDrawDistanceCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("DisableDrawDistance"));
+static CVarHandle sWidescreenActorCullingCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("WidescreenActorCulling"));
+
 void ObjMure2_SetPosShrubCircle(Vec3f* vec, ObjMure2* this) {
     s32 i;
 
@@ -222,8 +227,8 @@ void ObjMure2_Update(Actor* thisx, PlayState* play) {
     }
 
     // SOH [Enhancements] Extended draw distance
-    s32 distanceMultiplier = CVarGetInteger(CVAR_ENHANCEMENT("DisableDrawDistance"), 1);
-    if (CVarGetInteger(CVAR_ENHANCEMENT("WidescreenActorCulling"), 0) || distanceMultiplier > 1) {
+    s32 distanceMultiplier = CVarHandle_GetInteger(&sDisableDrawDistanceCVar, 1);
+    if (CVarHandle_GetInteger(&sWidescreenActorCullingCVar, 0) || distanceMultiplier > 1) {
         f32 originalAspectRatio = 4.0f / 3.0f;
         f32 currentAspectRatio = OTRGetAspectRatio();
         // Adjust ratio difference based on field of view testing
@@ -36,11 +36,15 @@
 #include "soh/OTRGlobals.h"
 #include "soh/ResourceManagerHelpers.h"
 #include "soh/ActorDB.h"
+#include "soh/CVarHandle.h"
 
 #include <string.h>
 #include <stdlib.h>
 #include <assert.h>
 
+// Read on every draw of the player, so resolved once through CVarHandle
+static CVarHandle sDisableLODCVar = CVAR_HANDLE_INIT(CVAR_ENHANCEMENT("DisableLOD"));
+
 extern bool Fuse_ShieldHasNegateKnockback(PlayState* play, int* outMaterialId, int* outDurabilityCur,
                                           int* outDurabilityMax, uint8_t* outLevel);
 extern bool Fuse_ShieldHasStun(PlayState* play, int* outMaterialId, int* outDurabilityCur, int* outDurabilityMax,
@@ -13004,7 +13008,7 @@ void Player_Draw(Actor* thisx, PlayState* play2) {
             lod = 1;
         }
 
-        if (CVarGetInteger(CVAR_ENHANCEMENT("DisableLOD"), 0)) {
+        if (CVarHandle_GetInteger(&sDisableLODCVar, 0)) {
             lod = 0;
         }
 